@@ -50,6 +50,7 @@ extern "C" {
 #endif
 
 extern const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity;
+extern const NSUInteger kGTMDefaultETaggedDataCacheDiskCapacity;
 
 #ifdef __cplusplus
 }
@@ -57,11 +58,14 @@ extern const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity;
 
 // forward declarations
 @class GTMURLCache;
+@class GTMURLDiskCache;
 @class GTMCookieStorage;
 
 @interface GTMHTTPFetchHistory : NSObject <GTMHTTPFetchHistoryProtocol> {
  @private
   GTMURLCache *etaggedDataCache_;
+  GTMURLDiskCache *etaggedDataDiskCache_;
+  NSUInteger diskCapacity_;
   BOOL shouldRememberETags_;
   BOOL shouldCacheETaggedData_;        // if NO, then only headers are cached
   GTMCookieStorage *cookieStorage_;
@@ -76,6 +80,15 @@ extern const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity;
 // the default ETag data cache capacity is kGTMDefaultETaggedDataCacheMemoryCapacity
 @property (assign) NSUInteger memoryCapacity;
 
+// Setting a directory path adds a disk tier behind the memory cache, so
+// remembered ETags (and cached data, when shouldCacheETaggedData is set)
+// survive relaunches of the app.  Responses found only on disk are moved back
+// into the memory cache when used.
+//
+// The default disk capacity is kGTMDefaultETaggedDataCacheDiskCapacity.
+@property (copy) NSString *diskCachePath;   // default: nil, no disk tier
+@property (assign) NSUInteger diskCapacity;
+
 @property (NS_NONATOMIC_IOSONLY, readonly, strong) id<GTMCookieStorageProtocol> cookieStorage;
 
 - (instancetype)initWithMemoryCapacity:(NSUInteger)totalBytes
@@ -105,6 +118,12 @@ extern const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity;
   NSData *data_;
   NSDate *useDate_;         // date this response was last saved or used
   NSDate *reservationDate_; // date this response's ETag was used
+
+  // Links for the least-recently-used list of the GTMURLCache holding this
+  // response; not retained, as the cache's responses_ dictionary holds it.
+  GTMCachedURLResponse *olderResponse_;
+  GTMCachedURLResponse *newerResponse_;
+  NSURL *cacheKey_;         // the key in the holding cache
 }
 
 @property (readonly) NSURLResponse* response;
@@ -119,8 +138,14 @@ extern const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity;
 - (instancetype)initWithResponse:(NSURLResponse *)response data:(NSData *)data NS_DESIGNATED_INITIALIZER;
 @end
 
+// The cache keeps its responses in a doubly-linked list from least to most
+// recently used, threaded through the responses themselves, so lookups and
+// pruning don't need to sort the responses.  A GTMCachedURLResponse should be
+// stored in only one cache at a time.
 @interface GTMURLCache : NSObject {
   NSMutableDictionary *responses_; // maps request URL to GTMCachedURLResponse
+  GTMCachedURLResponse *oldestResponse_; // head of the LRU list; not retained
+  GTMCachedURLResponse *newestResponse_; // tail of the LRU list; not retained
   NSUInteger memoryCapacity_;      // capacity of NSDatas in the responses
   NSUInteger totalDataSize_;       // sum of sizes of NSDatas of all responses
   NSTimeInterval reservationInterval_; // reservation expiration interval
@@ -141,6 +166,43 @@ extern const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity;
 @property (NS_NONATOMIC_IOSONLY, readonly) NSUInteger totalDataSize;
 @end
 
+// GTMURLDiskCache keeps responses in an append-only log file in a directory,
+// with an index of the log kept in memory.  Every record carries a checksum,
+// and on opening, the log is read up to the first incomplete or damaged record
+// and truncated there, so a crash mid-write loses at most that record.  When
+// superseded records make up most of the log, the live records are copied to
+// a new log that atomically replaces the old one.
+//
+// The capacity bounds the total size of the live records; the least recently
+// used responses are dropped to stay within it.
+@interface GTMURLDiskCache : NSObject {
+ @private
+  NSString *path_;
+  NSFileHandle *fileHandle_;
+  NSMutableDictionary *entries_;    // maps URL string to a log entry
+  NSMutableOrderedSet *recentKeys_; // URL strings, least recently used first
+  NSUInteger diskCapacity_;
+  unsigned long long logLength_;    // bytes in the log file
+  unsigned long long liveLength_;   // bytes of records still in use
+}
+
+@property (readonly) NSString *path;
+@property (assign) NSUInteger diskCapacity;
+
+// Returns nil if the directory can't be created or the log can't be opened.
+- (instancetype)initWithPath:(NSString *)path
+                diskCapacity:(NSUInteger)totalBytes NS_DESIGNATED_INITIALIZER;
+
+- (GTMCachedURLResponse *)cachedResponseForRequest:(NSURLRequest *)request;
+- (void)storeCachedResponse:(GTMCachedURLResponse *)cachedResponse forRequest:(NSURLRequest *)request;
+- (void)removeCachedResponseForRequest:(NSURLRequest *)request;
+- (void)removeAllCachedResponses;
+
+// for unit testing
+@property (NS_NONATOMIC_IOSONLY, readonly) NSUInteger responseCount;
+@property (NS_NONATOMIC_IOSONLY, readonly) unsigned long long logLength;
+@end
+
 @interface GTMCookieStorage : NSObject <GTMCookieStorageProtocol> {
  @private
   // The cookie storage object manages an array holding cookies, but the array
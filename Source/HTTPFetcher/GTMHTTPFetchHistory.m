@@ -19,6 +19,8 @@
 
 #import "GTMHTTPFetchHistory.h"
 
+#include <stdio.h>
+
 static const NSTimeInterval kCachedURLReservationInterval = 60.0; // 1 minute
 static NSString* const kGTMIfNoneMatchHeader = @"If-None-Match";
 static NSString* const kGTMETagHeader = @"Etag";
@@ -31,6 +33,9 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 1 * 1024 * 1024;
 const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
 #endif
 
+// up to 50MB on disk
+const NSUInteger kGTMDefaultETaggedDataCacheDiskCapacity = 50 * 1024 * 1024;
+
 
 @implementation GTMCookieStorage
 
@@ -212,12 +217,22 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
 // GTMCachedURLResponse
 //
 
+@interface GTMCachedURLResponse ()
+// Accessed only by GTMURLCache, inside its @synchronized blocks.
+@property (nonatomic, assign) GTMCachedURLResponse *olderResponse;
+@property (nonatomic, assign) GTMCachedURLResponse *newerResponse;
+@property (nonatomic, retain) NSURL *cacheKey;
+@end
+
 @implementation GTMCachedURLResponse
 
 @synthesize response = response_;
 @synthesize data = data_;
 @synthesize reservationDate = reservationDate_;
 @synthesize useDate = useDate_;
+@synthesize olderResponse = olderResponse_;
+@synthesize newerResponse = newerResponse_;
+@synthesize cacheKey = cacheKey_;
 
 - (instancetype)init {
     NSURLResponse *response = [[NSURLResponse alloc] init];
@@ -241,6 +256,7 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
   [data_ release];
   [useDate_ release];
   [reservationDate_ release];
+  [cacheKey_ release];
   [super dealloc];
 }
 
@@ -255,10 +271,6 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
           reservationStr];
 }
 
-- (NSComparisonResult)compareUseDate:(GTMCachedURLResponse *)other {
-  return [useDate_ compare:other.useDate];
-}
-
 @end
 
 //
@@ -286,6 +298,7 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
 }
 
 - (void)dealloc {
+  [self removeAllCachedResponses];
   [responses_ release];
   [super dealloc];
 }
@@ -295,22 +308,59 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
           [self class], self, responses_.allValues];
 }
 
+// LRU list support; these must be called inside @synchronized(self).
+
+- (void)unlinkResponse:(GTMCachedURLResponse *)response {
+  GTMCachedURLResponse *older = response.olderResponse;
+  GTMCachedURLResponse *newer = response.newerResponse;
+  if (older) {
+    older.newerResponse = newer;
+  } else {
+    oldestResponse_ = newer;
+  }
+  if (newer) {
+    newer.olderResponse = older;
+  } else {
+    newestResponse_ = older;
+  }
+  response.olderResponse = nil;
+  response.newerResponse = nil;
+}
+
+- (void)linkNewestResponse:(GTMCachedURLResponse *)response {
+  response.olderResponse = newestResponse_;
+  response.newerResponse = nil;
+  if (newestResponse_) {
+    newestResponse_.newerResponse = response;
+  } else {
+    oldestResponse_ = response;
+  }
+  newestResponse_ = response;
+}
+
+- (void)removeResponse:(GTMCachedURLResponse *)response {
+  totalDataSize_ -= response.data.length;
+  [self unlinkResponse:response];
+
+  // Removing it from the dictionary may release the response, so do that
+  // last.
+  NSURL *key = [[response.cacheKey retain] autorelease];
+  response.cacheKey = nil;
+  [responses_ removeObjectForKey:key];
+}
+
 // Setters/getters
 
 - (void)pruneCacheResponses {
   // Internal routine to remove the least-recently-used responses when the
   // cache has grown too large
-  if (memoryCapacity_ >= totalDataSize_) return;
-
-  // Sort keys by date
-  SEL sel = @selector(compareUseDate:);
-  NSArray *sortedKeys = [responses_ keysSortedByValueUsingSelector:sel];
-
-  // The least-recently-used keys are at the beginning of the sorted array;
-  // remove those (except ones still reserved) until the total data size is
-  // reduced sufficiently
-  for (NSURL *key in sortedKeys) {
-    GTMCachedURLResponse *response = responses_[key];
+  //
+  // The least-recently-used responses are at the head of the list; remove
+  // those (except ones still reserved) until the total data size is reduced
+  // sufficiently
+  GTMCachedURLResponse *response = oldestResponse_;
+  while (response != nil && memoryCapacity_ < totalDataSize_) {
+    GTMCachedURLResponse *newer = response.newerResponse;
 
     NSDate *resDate = response.reservationDate;
     BOOL isResponseReserved = (resDate != nil)
@@ -318,28 +368,36 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
 
     if (!isResponseReserved) {
       // We can remove this response from the cache
-      NSUInteger storedSize = response.data.length;
-      totalDataSize_ -= storedSize;
-      [responses_ removeObjectForKey:key];
+      [self removeResponse:response];
     }
-
-    // If we've removed enough response data, then we're done
-    if (memoryCapacity_ >= totalDataSize_) break;
+    response = newer;
   }
 }
 
 - (void)storeCachedResponse:(GTMCachedURLResponse *)cachedResponse
                  forRequest:(NSURLRequest *)request {
   @synchronized(self) {
+    // The response may already be in the cache, so keep it alive while it is
+    // removed and re-added
+    [[cachedResponse retain] autorelease];
+
     // Remove any previous entry for this request
     [self removeCachedResponseForRequest:request];
 
+    // The response may also be here for another request
+    NSURL *previousKey = cachedResponse.cacheKey;
+    if (previousKey && responses_[previousKey] == cachedResponse) {
+      [self removeResponse:cachedResponse];
+    }
+
     // cache this one only if it's not bigger than our cache
     NSUInteger storedSize = cachedResponse.data.length;
     if (storedSize < memoryCapacity_) {
 
       NSURL *key = request.URL;
       responses_[key] = cachedResponse;
+      cachedResponse.cacheKey = key;
+      [self linkNewestResponse:cachedResponse];
       totalDataSize_ += storedSize;
 
       [self pruneCacheResponses];
@@ -354,8 +412,14 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
     NSURL *key = request.URL;
     response = [[responses_[key] retain] autorelease];
 
-    // Touch the date to indicate this was recently retrieved
-    response.useDate = [NSDate date];
+    if (response) {
+      // Move it to the end of the list to indicate this was recently retrieved
+      if (response != newestResponse_) {
+        [self unlinkResponse:response];
+        [self linkNewestResponse:response];
+      }
+      response.useDate = [NSDate date];
+    }
   }
   return response;
 }
@@ -363,13 +427,28 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
 - (void)removeCachedResponseForRequest:(NSURLRequest *)request {
   @synchronized(self) {
     NSURL *key = request.URL;
-    totalDataSize_ -= [responses_[key] data].length;
-    [responses_ removeObjectForKey:key];
+    GTMCachedURLResponse *response = responses_[key];
+    if (response) {
+      [self removeResponse:response];
+    }
   }
 }
 
 - (void)removeAllCachedResponses {
   @synchronized(self) {
+    // Clear the links so responses held elsewhere aren't left pointing at
+    // each other
+    GTMCachedURLResponse *response = oldestResponse_;
+    while (response != nil) {
+      GTMCachedURLResponse *newer = response.newerResponse;
+      response.olderResponse = nil;
+      response.newerResponse = nil;
+      response.cacheKey = nil;
+      response = newer;
+    }
+    oldestResponse_ = nil;
+    newestResponse_ = nil;
+
     [responses_ removeAllObjects];
     totalDataSize_ = 0;
   }
@@ -405,11 +484,548 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
 
 @end
 
+//
+// GTMURLDiskCache
+//
+
+static NSString *const kGTMURLDiskCacheLogName = @"responses.log";
+static NSString *const kGTMURLDiskCacheStatusKey = @"status";
+static NSString *const kGTMURLDiskCacheHeadersKey = @"headers";
+
+// Log records are a fixed header followed by the URL string, the response info
+// (a binary plist of the status and headers) and the response data.  The
+// checksum covers everything after the header.  Values are little-endian.
+enum {
+  kGTMURLDiskCacheRecordMagic = 0x434D5447,  // "GTMC"
+  kGTMURLDiskCacheRecordStore = 1,
+  kGTMURLDiskCacheRecordRemove = 2
+};
+
+typedef struct {
+  uint32_t magic;
+  uint32_t type;
+  uint32_t keyLength;
+  uint32_t infoLength;
+  uint64_t dataLength;
+  uint32_t checksum;
+  uint32_t reserved;
+} GTMURLDiskCacheRecordHeader;
+
+// Start rewriting the log once it holds this much beyond twice the live data.
+static const unsigned long long kGTMURLDiskCacheCompactionSlack = 256 * 1024;
+
+// FNV-1a; enough to spot torn or damaged records.
+static uint32_t DiskCacheChecksum(uint32_t hash, const void *bytes, NSUInteger length) {
+  const uint8_t *ptr = bytes;
+  for (NSUInteger idx = 0; idx < length; idx++) {
+    hash ^= ptr[idx];
+    hash *= 16777619U;
+  }
+  return hash;
+}
+
+static const uint32_t kDiskCacheChecksumSeed = 2166136261U;
+
+// Where a stored response lives in the log.
+@interface GTMURLDiskCacheEntry : NSObject {
+ @public
+  unsigned long long recordOffset_;
+  unsigned long long recordLength_;
+  NSInteger statusCode_;
+  NSDictionary *headers_;
+}
+@end
+
+@implementation GTMURLDiskCacheEntry
+- (void)dealloc {
+  [headers_ release];
+  [super dealloc];
+}
+@end
+
+@interface GTMURLDiskCache ()
+- (BOOL)openLog;
+- (void)closeLog;
+- (void)compactLog;
+@end
+
+@implementation GTMURLDiskCache
+
+@synthesize path = path_;
+
+@dynamic diskCapacity;
+
+- (instancetype)init {
+  return [self initWithPath:nil diskCapacity:kGTMDefaultETaggedDataCacheDiskCapacity];
+}
+
+- (instancetype)initWithPath:(NSString *)path diskCapacity:(NSUInteger)totalBytes {
+  self = [super init];
+  if (self != nil) {
+    path_ = [path copy];
+    diskCapacity_ = totalBytes;
+    entries_ = [[NSMutableDictionary alloc] init];
+    recentKeys_ = [[NSMutableOrderedSet alloc] init];
+
+    if (![self openLog]) {
+      [self release];
+      return nil;
+    }
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [self closeLog];
+  [path_ release];
+  [entries_ release];
+  [recentKeys_ release];
+  [super dealloc];
+}
+
+- (NSString *)description {
+  return [NSString stringWithFormat:@"%@ %p: {path:%@ responses:%u log:%llu bytes}",
+          [self class], self, path_, (unsigned int)entries_.count, logLength_];
+}
+
+- (NSString *)logPath {
+  return [path_ stringByAppendingPathComponent:kGTMURLDiskCacheLogName];
+}
+
+#pragma mark Records
+
++ (NSData *)recordWithType:(uint32_t)type
+                       key:(NSString *)key
+                      info:(NSData *)info
+                      data:(NSData *)data {
+  NSData *keyData = [key dataUsingEncoding:NSUTF8StringEncoding];
+
+  uint32_t checksum = kDiskCacheChecksumSeed;
+  checksum = DiskCacheChecksum(checksum, keyData.bytes, keyData.length);
+  checksum = DiskCacheChecksum(checksum, info.bytes, info.length);
+  checksum = DiskCacheChecksum(checksum, data.bytes, data.length);
+
+  GTMURLDiskCacheRecordHeader header;
+  header.magic = NSSwapHostIntToLittle(kGTMURLDiskCacheRecordMagic);
+  header.type = NSSwapHostIntToLittle(type);
+  header.keyLength = NSSwapHostIntToLittle((uint32_t)keyData.length);
+  header.infoLength = NSSwapHostIntToLittle((uint32_t)info.length);
+  header.dataLength = NSSwapHostLongLongToLittle(data.length);
+  header.checksum = NSSwapHostIntToLittle(checksum);
+  header.reserved = 0;
+
+  NSMutableData *record =
+    [NSMutableData dataWithCapacity:sizeof(header) + keyData.length + info.length + data.length];
+  [record appendBytes:&header length:sizeof(header)];
+  [record appendData:keyData];
+  if (info) [record appendData:info];
+  if (data) [record appendData:data];
+  return record;
+}
+
+// Checks the record at the start of the bytes; returns NO if it is incomplete
+// or damaged.
+static BOOL ReadDiskCacheRecordHeader(const uint8_t *bytes, unsigned long long available,
+                                      GTMURLDiskCacheRecordHeader *outHeader,
+                                      unsigned long long *outRecordLength) {
+  if (available < sizeof(GTMURLDiskCacheRecordHeader)) return NO;
+
+  GTMURLDiskCacheRecordHeader header;
+  memcpy(&header, bytes, sizeof(header));
+  header.magic = NSSwapLittleIntToHost(header.magic);
+  header.type = NSSwapLittleIntToHost(header.type);
+  header.keyLength = NSSwapLittleIntToHost(header.keyLength);
+  header.infoLength = NSSwapLittleIntToHost(header.infoLength);
+  header.dataLength = NSSwapLittleLongLongToHost(header.dataLength);
+  header.checksum = NSSwapLittleIntToHost(header.checksum);
+  if (header.magic != kGTMURLDiskCacheRecordMagic) return NO;
+
+  unsigned long long bodyLength =
+    (unsigned long long)header.keyLength + header.infoLength + header.dataLength;
+  if (bodyLength > available - sizeof(header)) return NO;
+
+  uint32_t checksum = DiskCacheChecksum(kDiskCacheChecksumSeed,
+                                        bytes + sizeof(header), (NSUInteger)bodyLength);
+  if (checksum != header.checksum) return NO;
+
+  *outHeader = header;
+  *outRecordLength = sizeof(header) + bodyLength;
+  return YES;
+}
+
+- (BOOL)appendRecord:(NSData *)record {
+  // Must be called inside @synchronized(self).
+  if (fileHandle_ == nil) return NO;
+
+  @try {
+    [fileHandle_ seekToFileOffset:logLength_];
+    [fileHandle_ writeData:record];
+    logLength_ += record.length;
+  }
+  @catch (NSException *exc) {
+    // Couldn't write to the file, probably due to a full disk; drop back to
+    // what was known to be written and stop using the log.
+    @try {
+      [fileHandle_ truncateFileAtOffset:logLength_];
+    }
+    @catch (NSException *truncateExc) {
+      // The next open will drop the partial record.
+    }
+    [self closeLog];
+    [entries_ removeAllObjects];
+    [recentKeys_ removeAllObjects];
+    liveLength_ = 0;
+    return NO;
+  }
+  return YES;
+}
+
+#pragma mark Index
+
+- (void)forgetKey:(NSString *)key {
+  GTMURLDiskCacheEntry *entry = entries_[key];
+  if (entry) {
+    liveLength_ -= entry->recordLength_;
+    [entries_ removeObjectForKey:key];
+    [recentKeys_ removeObject:key];
+  }
+}
+
+- (void)indexRecordAtOffset:(unsigned long long)offset
+                     length:(unsigned long long)recordLength
+                        key:(NSString *)key
+                       info:(NSData *)info {
+  NSDictionary *infoDict = [NSPropertyListSerialization propertyListWithData:info
+                                                                     options:NSPropertyListImmutable
+                                                                      format:NULL
+                                                                       error:NULL];
+  [self forgetKey:key];
+  if (![infoDict isKindOfClass:[NSDictionary class]]) return;
+
+  GTMURLDiskCacheEntry *entry = [[[GTMURLDiskCacheEntry alloc] init] autorelease];
+  entry->recordOffset_ = offset;
+  entry->recordLength_ = recordLength;
+  entry->statusCode_ = [infoDict[kGTMURLDiskCacheStatusKey] integerValue];
+  entry->headers_ = [infoDict[kGTMURLDiskCacheHeadersKey] retain];
+  entries_[key] = entry;
+  [recentKeys_ addObject:key];
+  liveLength_ += recordLength;
+}
+
+- (void)pruneToCapacity {
+  // Must be called inside @synchronized(self).
+  while (liveLength_ > diskCapacity_ && recentKeys_.count > 0) {
+    NSString *oldestKey = [[recentKeys_.firstObject retain] autorelease];
+    [self forgetKey:oldestKey];
+    NSData *record = [[self class] recordWithType:kGTMURLDiskCacheRecordRemove
+                                              key:oldestKey
+                                             info:nil
+                                             data:nil];
+    if (![self appendRecord:record]) return;
+  }
+}
+
+- (void)compactIfNeeded {
+  // Must be called inside @synchronized(self).
+  if (logLength_ > 2 * liveLength_ + kGTMURLDiskCacheCompactionSlack) {
+    [self compactLog];
+  }
+}
+
+#pragma mark Log file
+
+- (BOOL)openLog {
+  if (path_.length == 0) return NO;
+
+  NSFileManager *fileMgr = [NSFileManager defaultManager];
+  if (![fileMgr createDirectoryAtPath:path_
+          withIntermediateDirectories:YES
+                           attributes:nil
+                                error:NULL]) {
+    return NO;
+  }
+
+  NSString *logPath = [self logPath];
+  if (![fileMgr fileExistsAtPath:logPath]) {
+    if (![fileMgr createFileAtPath:logPath contents:nil attributes:nil]) {
+      return NO;
+    }
+  }
+
+  // Read the records up to the first one which is incomplete or damaged.
+  NSData *logData = [NSData dataWithContentsOfFile:logPath
+                                           options:NSDataReadingMappedIfSafe
+                                             error:NULL];
+  const uint8_t *bytes = logData.bytes;
+  unsigned long long length = logData.length;
+  unsigned long long offset = 0;
+  GTMURLDiskCacheRecordHeader header;
+  unsigned long long recordLength;
+  while (ReadDiskCacheRecordHeader(bytes + offset, length - offset, &header, &recordLength)) {
+    const uint8_t *body = bytes + offset + sizeof(header);
+    NSString *key = [[[NSString alloc] initWithBytes:body
+                                              length:header.keyLength
+                                            encoding:NSUTF8StringEncoding] autorelease];
+    if (key == nil) break;
+
+    if (header.type == kGTMURLDiskCacheRecordStore) {
+      NSData *info = [NSData dataWithBytes:(body + header.keyLength)
+                                    length:header.infoLength];
+      [self indexRecordAtOffset:offset
+                         length:recordLength
+                            key:key
+                           info:info];
+    } else {
+      [self forgetKey:key];
+    }
+    offset += recordLength;
+  }
+
+  fileHandle_ = [[NSFileHandle fileHandleForUpdatingAtPath:logPath] retain];
+  if (fileHandle_ == nil) {
+    [entries_ removeAllObjects];
+    [recentKeys_ removeAllObjects];
+    liveLength_ = 0;
+    return NO;
+  }
+  logLength_ = offset;
+  if (offset < length) {
+    // Drop the tail left by an interrupted write.
+    @try {
+      [fileHandle_ truncateFileAtOffset:offset];
+    }
+    @catch (NSException *exc) {
+      [self closeLog];
+      return NO;
+    }
+  }
+
+  [self pruneToCapacity];
+  [self compactIfNeeded];
+  return YES;
+}
+
+- (void)closeLog {
+  [fileHandle_ closeFile];
+  [fileHandle_ release];
+  fileHandle_ = nil;
+}
+
+- (void)compactLog {
+  // Must be called inside @synchronized(self).
+  //
+  // Copy the live records, least recently used first so the order survives a
+  // relaunch, into a new file, then move it over the old log.
+  NSString *logPath = [self logPath];
+  NSString *tempPath = [logPath stringByAppendingPathExtension:@"tmp"];
+  NSFileManager *fileMgr = [NSFileManager defaultManager];
+  if (![fileMgr createFileAtPath:tempPath contents:nil attributes:nil]) return;
+
+  NSFileHandle *tempHandle = [NSFileHandle fileHandleForWritingAtPath:tempPath];
+  NSMutableDictionary *newOffsets = [NSMutableDictionary dictionaryWithCapacity:entries_.count];
+  unsigned long long newLength = 0;
+  BOOL didSucceed = (tempHandle != nil);
+  @try {
+    for (NSString *key in recentKeys_) {
+      if (!didSucceed) break;
+      GTMURLDiskCacheEntry *entry = entries_[key];
+      [fileHandle_ seekToFileOffset:entry->recordOffset_];
+      NSData *record = [fileHandle_ readDataOfLength:(NSUInteger)entry->recordLength_];
+      if (record.length != entry->recordLength_) {
+        didSucceed = NO;
+        break;
+      }
+      [tempHandle writeData:record];
+      newOffsets[key] = @(newLength);
+      newLength += record.length;
+    }
+    [tempHandle synchronizeFile];
+  }
+  @catch (NSException *exc) {
+    didSucceed = NO;
+  }
+  [tempHandle closeFile];
+
+  // rename() replaces the log atomically, so a crash leaves either the old
+  // log or the new one.
+  if (!didSucceed
+      || rename(tempPath.fileSystemRepresentation, logPath.fileSystemRepresentation) != 0) {
+    [fileMgr removeItemAtPath:tempPath error:NULL];
+    return;
+  }
+
+  [self closeLog];
+  fileHandle_ = [[NSFileHandle fileHandleForUpdatingAtPath:logPath] retain];
+  for (NSString *key in newOffsets) {
+    GTMURLDiskCacheEntry *entry = entries_[key];
+    entry->recordOffset_ = [newOffsets[key] unsignedLongLongValue];
+  }
+  logLength_ = newLength;
+  if (fileHandle_ == nil) {
+    [entries_ removeAllObjects];
+    [recentKeys_ removeAllObjects];
+    liveLength_ = 0;
+  }
+}
+
+#pragma mark Public methods
+
+- (GTMCachedURLResponse *)cachedResponseForRequest:(NSURLRequest *)request {
+  @synchronized(self) {
+    NSURL *url = request.URL;
+    NSString *key = url.absoluteString;
+    GTMURLDiskCacheEntry *entry = key ? entries_[key] : nil;
+    if (entry == nil || fileHandle_ == nil) return nil;
+
+    NSData *record = nil;
+    @try {
+      [fileHandle_ seekToFileOffset:entry->recordOffset_];
+      record = [fileHandle_ readDataOfLength:(NSUInteger)entry->recordLength_];
+    }
+    @catch (NSException *exc) {
+      record = nil;
+    }
+
+    GTMURLDiskCacheRecordHeader header;
+    unsigned long long recordLength;
+    if (!ReadDiskCacheRecordHeader(record.bytes, record.length, &header, &recordLength)) {
+      // The record was damaged after it was written; stop returning it.
+      [self forgetKey:key];
+      return nil;
+    }
+
+    NSUInteger dataOffset = sizeof(header) + header.keyLength + header.infoLength;
+    NSData *data = nil;
+    if (header.dataLength > 0) {
+      data = [record subdataWithRange:NSMakeRange(dataOffset, (NSUInteger)header.dataLength)];
+    }
+
+    NSHTTPURLResponse *response =
+      [[[NSHTTPURLResponse alloc] initWithURL:url
+                                   statusCode:entry->statusCode_
+                                  HTTPVersion:@"HTTP/1.1"
+                                 headerFields:entry->headers_] autorelease];
+    GTMCachedURLResponse *cachedResponse =
+      [[[GTMCachedURLResponse alloc] initWithResponse:response
+                                                 data:data] autorelease];
+
+    [recentKeys_ removeObject:key];
+    [recentKeys_ addObject:key];
+    return cachedResponse;
+  }
+}
+
+- (void)storeCachedResponse:(GTMCachedURLResponse *)cachedResponse
+                 forRequest:(NSURLRequest *)request {
+  NSURLResponse *response = cachedResponse.response;
+  if (![response respondsToSelector:@selector(allHeaderFields)]) return;
+
+  NSString *key = request.URL.absoluteString;
+  if (key == nil) return;
+
+  NSDictionary *infoDict = @{
+    kGTMURLDiskCacheStatusKey : @(((NSHTTPURLResponse *)response).statusCode),
+    kGTMURLDiskCacheHeadersKey : ((NSHTTPURLResponse *)response).allHeaderFields
+  };
+  NSData *info = [NSPropertyListSerialization dataWithPropertyList:infoDict
+                                                            format:NSPropertyListBinaryFormat_v1_0
+                                                           options:0
+                                                             error:NULL];
+  if (info == nil) return;
+
+  NSData *record = [[self class] recordWithType:kGTMURLDiskCacheRecordStore
+                                            key:key
+                                           info:info
+                                           data:cachedResponse.data];
+  @synchronized(self) {
+    // cache this one only if it's not bigger than our cache; a new record
+    // for the URL supersedes any earlier one, so that needs no removal record
+    if (record.length >= diskCapacity_) {
+      [self removeCachedResponseForRequest:request];
+      return;
+    }
+
+    unsigned long long offset = logLength_;
+    if ([self appendRecord:record]) {
+      [self indexRecordAtOffset:offset
+                         length:record.length
+                            key:key
+                           info:info];
+      [self pruneToCapacity];
+      [self compactIfNeeded];
+    }
+  }
+}
+
+- (void)removeCachedResponseForRequest:(NSURLRequest *)request {
+  @synchronized(self) {
+    NSString *key = request.URL.absoluteString;
+    if (key && entries_[key]) {
+      [self forgetKey:key];
+      NSData *record = [[self class] recordWithType:kGTMURLDiskCacheRecordRemove
+                                                key:key
+                                               info:nil
+                                               data:nil];
+      [self appendRecord:record];
+      [self compactIfNeeded];
+    }
+  }
+}
+
+- (void)removeAllCachedResponses {
+  @synchronized(self) {
+    [entries_ removeAllObjects];
+    [recentKeys_ removeAllObjects];
+    liveLength_ = 0;
+    @try {
+      [fileHandle_ truncateFileAtOffset:0];
+      logLength_ = 0;
+    }
+    @catch (NSException *exc) {
+      [self closeLog];
+    }
+  }
+}
+
+- (NSUInteger)diskCapacity {
+  @synchronized(self) {
+    return diskCapacity_;
+  }
+}
+
+- (void)setDiskCapacity:(NSUInteger)totalBytes {
+  @synchronized(self) {
+    BOOL didShrink = (totalBytes < diskCapacity_);
+    diskCapacity_ = totalBytes;
+
+    if (didShrink) {
+      [self pruneToCapacity];
+      [self compactIfNeeded];
+    }
+  }
+}
+
+// Methods for unit testing.
+- (NSUInteger)responseCount {
+  @synchronized(self) {
+    return entries_.count;
+  }
+}
+
+- (unsigned long long)logLength {
+  @synchronized(self) {
+    return logLength_;
+  }
+}
+
+@end
+
 //
 // GTMHTTPFetchHistory
 //
 
 @interface GTMHTTPFetchHistory ()
+- (GTMCachedURLResponse *)cachedResponseForRequest:(NSURLRequest *)request;
 - (NSString *)cachedETagForRequest:(NSURLRequest *)request;
 - (void)removeCachedDataForRequest:(NSURLRequest *)request;
 @end
@@ -421,6 +1037,8 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
 @dynamic shouldRememberETags;
 @dynamic shouldCacheETaggedData;
 @dynamic memoryCapacity;
+@dynamic diskCachePath;
+@dynamic diskCapacity;
 
 - (instancetype)init {
  return [self initWithMemoryCapacity:kGTMDefaultETaggedDataCacheMemoryCapacity
@@ -434,6 +1052,7 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
     etaggedDataCache_ = [[GTMURLCache alloc] initWithMemoryCapacity:totalBytes];
     shouldRememberETags_ = shouldCacheETaggedData;
     shouldCacheETaggedData_ = shouldCacheETaggedData;
+    diskCapacity_ = kGTMDefaultETaggedDataCacheDiskCapacity;
     cookieStorage_ = [[GTMCookieStorage alloc] init];
   }
   return self;
@@ -441,6 +1060,7 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
 
 - (void)dealloc {
   [etaggedDataCache_ release];
+  [etaggedDataDiskCache_ release];
   [cookieStorage_ release];
   [super dealloc];
 }
@@ -508,17 +1128,35 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
                                                                       data:dataToStore] autorelease];
         [etaggedDataCache_ storeCachedResponse:cachedResponse
                                   forRequest:request];
+        [etaggedDataDiskCache_ storeCachedResponse:cachedResponse
+                                        forRequest:request];
       } else {
         [etaggedDataCache_ removeCachedResponseForRequest:request];
+        [etaggedDataDiskCache_ removeCachedResponseForRequest:request];
       }
     }
   }
 }
 
-- (NSString *)cachedETagForRequest:(NSURLRequest *)request {
+- (GTMCachedURLResponse *)cachedResponseForRequest:(NSURLRequest *)request {
   // Internal routine.
   GTMCachedURLResponse *cachedResponse;
   cachedResponse = [etaggedDataCache_ cachedResponseForRequest:request];
+  if (cachedResponse == nil && etaggedDataDiskCache_ != nil) {
+    // Bring a response saved by an earlier run back into memory, where its
+    // reservation can be tracked.
+    cachedResponse = [etaggedDataDiskCache_ cachedResponseForRequest:request];
+    if (cachedResponse) {
+      [etaggedDataCache_ storeCachedResponse:cachedResponse
+                                  forRequest:request];
+    }
+  }
+  return cachedResponse;
+}
+
+- (NSString *)cachedETagForRequest:(NSURLRequest *)request {
+  // Internal routine.
+  GTMCachedURLResponse *cachedResponse = [self cachedResponseForRequest:request];
 
   NSURLResponse *response = cachedResponse.response;
   NSDictionary *headers = ((NSHTTPURLResponse *)response).allHeaderFields;
@@ -538,8 +1176,7 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
 
 - (NSData *)cachedDataForRequest:(NSURLRequest *)request {
   @synchronized(self) {
-    GTMCachedURLResponse *cachedResponse;
-    cachedResponse = [etaggedDataCache_ cachedResponseForRequest:request];
+    GTMCachedURLResponse *cachedResponse = [self cachedResponseForRequest:request];
 
     NSData *cachedData = cachedResponse.data;
 
@@ -554,12 +1191,14 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
 - (void)removeCachedDataForRequest:(NSURLRequest *)request {
   @synchronized(self) {
     [etaggedDataCache_ removeCachedResponseForRequest:request];
+    [etaggedDataDiskCache_ removeCachedResponseForRequest:request];
   }
 }
 
 - (void)clearETaggedDataCache {
   @synchronized(self) {
     [etaggedDataCache_ removeAllCachedResponses];
+    [etaggedDataDiskCache_ removeAllCachedResponses];
   }
 }
 
@@ -616,4 +1255,38 @@ const NSUInteger kGTMDefaultETaggedDataCacheMemoryCapacity = 15 * 1024 * 1024;
   etaggedDataCache_.memoryCapacity = totalBytes;
 }
 
+- (NSString *)diskCachePath {
+  @synchronized(self) {
+    return [[etaggedDataDiskCache_.path retain] autorelease];
+  }
+}
+
+- (void)setDiskCachePath:(NSString *)path {
+  @synchronized(self) {
+    if ((path == nil && etaggedDataDiskCache_ == nil)
+        || [path isEqual:etaggedDataDiskCache_.path]) {
+      return;
+    }
+    [etaggedDataDiskCache_ release];
+    etaggedDataDiskCache_ = nil;
+    if (path) {
+      etaggedDataDiskCache_ = [[GTMURLDiskCache alloc] initWithPath:path
+                                                       diskCapacity:diskCapacity_];
+    }
+  }
+}
+
+- (NSUInteger)diskCapacity {
+  @synchronized(self) {
+    return diskCapacity_;
+  }
+}
+
+- (void)setDiskCapacity:(NSUInteger)totalBytes {
+  @synchronized(self) {
+    diskCapacity_ = totalBytes;
+    etaggedDataDiskCache_.diskCapacity = totalBytes;
+  }
+}
+
 @end
@@ -507,6 +507,7 @@ NSString *GTMApplicationIdentifier(NSBundle *bundle);
 #if NS_BLOCKS_AVAILABLE
   void (^completionBlock_)(NSData *, NSError *);
   void (^receivedDataBlock_)(NSData *);
+  void (^accumulateDataBlock_)(NSData *);
   void (^sentDataBlock_)(NSInteger, NSInteger, NSInteger);
   BOOL (^retryBlock_)(BOOL, NSError *);
 #elif !__LP64__
@@ -514,6 +515,7 @@ NSString *GTMApplicationIdentifier(NSBundle *bundle);
   // the same with and without blocks
   id completionPlaceholder_;
   id receivedDataPlaceholder_;
+  id accumulateDataPlaceholder_;
   id sentDataPlaceholder_;
   id retryPlaceholder_;
 #endif
@@ -538,6 +540,11 @@ NSString *GTMApplicationIdentifier(NSBundle *bundle);
   id <GTMHTTPFetcherServiceProtocol> service_;
   NSString *serviceHost_;
   NSInteger servicePriority_;
+  NSString *serviceClient_;
+  NSTimeInterval serviceWaitTime_;
+  NSDate *connectionStartDate_;     // cleared at the connection's first response
+  NSTimeInterval responseTime_;
+  BOOL didTimeOut_;
   NSThread *thread_;
 
   BOOL isRetryEnabled_;             // user wants auto-retry
@@ -639,6 +646,26 @@ NSString *GTMApplicationIdentifier(NSBundle *bundle);
 // fetchers that are being delayed by a fetcher service.
 @property (assign) NSInteger servicePriority;
 
+// The logical client, if any, sharing the fetcher service's host limit
+//
+// Delayed fetchers of equal priority are started in turn by client, in
+// proportion to the clients' weights in the fetcher service, rather than
+// strictly in the order they were begun.  Fetchers without a client share
+// a default client.
+@property (copy) NSString *serviceClient;
+
+// Seconds this fetcher waited to be started by the fetcher service; zero if
+// it was not delayed
+@property (assign) NSTimeInterval serviceWaitTime;
+
+// Seconds from the start of the latest connection to its first response,
+// excluding any wait for a retry and the download of the body; zero until
+// the connection gets a response
+@property (readonly) NSTimeInterval responseTime;
+
+// YES if the latest connection failed by timing out
+@property (readonly) BOOL didTimeOut;
+
 // The thread used to run this fetcher in the fetcher service when no operation
 // queue is provided.
 @property (retain) NSThread *thread;
@@ -673,7 +700,8 @@ NSString *GTMApplicationIdentifier(NSBundle *bundle);
 //       receivedData:(NSData *)dataReceivedSoFar;
 //
 // The dataReceived argument will be nil when downloading to a path or to a
-// file handle.
+// file handle, and empty while an accumulateDataBlock is taking the data;
+// use the fetcher's downloadedLength to follow the progress of those fetches.
 //
 // Applications should not use this method to accumulate the received data;
 // the callback method or block supplied to the beginFetch call will have
@@ -687,8 +715,22 @@ NSString *GTMApplicationIdentifier(NSBundle *bundle);
 @property (copy) void (^sentDataBlock)(NSInteger bytesSent, NSInteger totalBytesSent, NSInteger bytesExpectedToSend);
 
 // The dataReceived argument will be nil when downloading to a path or to
-// a file handle
+// a file handle, and empty while an accumulateDataBlock is taking the data
 @property (copy) void (^receivedDataBlock)(NSData *dataReceivedSoFar);
+
+// If set, received data is passed to the block as it arrives rather than
+// being accumulated in the downloadedData property, so the caller can
+// process a large response without the fetcher holding a copy of it.
+//
+// The block is called with each buffer of a successful response;
+// downloadedData will be empty when the fetch completes.  The body of an
+// unsuccessful response is still kept in downloadedData, so it is available
+// to the status error and to the fetcher service.
+//
+// ETagged data for the request will not be saved in the fetch history's
+// cache, and the fetch will not send a remembered ETag, since a Not Modified
+// response would have no data to hand to the block.
+@property (copy) void (^accumulateDataBlock)(NSData *buffer);
 #endif
 
 // retrying; see comments at the top of the file.  Calling
@@ -214,6 +214,7 @@ static NSString *const kCallbackError = @"error";
 #if NS_BLOCKS_AVAILABLE
   [completionBlock_ release];
   [receivedDataBlock_ release];
+  [accumulateDataBlock_ release];
   [sentDataBlock_ release];
   [retryBlock_ release];
 #endif
@@ -226,6 +227,8 @@ static NSString *const kCallbackError = @"error";
   [authorizer_ release];
   [service_ release];
   [serviceHost_ release];
+  [serviceClient_ release];
+  [connectionStartDate_ release];
   [thread_ release];
   [retryTimer_ release];
   [initialRequestDate_ release];
@@ -380,7 +383,14 @@ static NSString *const kCallbackError = @"error";
     }
   }
 
-  [fetchHistory_ updateRequest:request_ isHTTPGet:isEffectiveHTTPGet];
+  // Data handed to the client as it arrives isn't cached, so a remembered
+  // ETag could only lead to a Not Modified status with no data to return
+  BOOL isAccumulatingData = NO;
+#if NS_BLOCKS_AVAILABLE
+  isAccumulatingData = (accumulateDataBlock_ != nil);
+#endif
+  [fetchHistory_ updateRequest:request_
+                     isHTTPGet:(isEffectiveHTTPGet && !isAccumulatingData)];
 
   // set the default upload or download retry interval, if necessary
   if (isRetryEnabled_
@@ -447,6 +457,10 @@ static NSString *const kCallbackError = @"error";
   }
 
   hasConnectionEnded_ = NO;
+  [connectionStartDate_ release];
+  connectionStartDate_ = [[NSDate alloc] init];
+  responseTime_ = 0;
+  didTimeOut_ = NO;
   if (runLoopModes_.count == 0 && delegateQueue == nil) {
     // No custom callback modes or queue were specified, so start the connection
     // on the current run loop in the current mode
@@ -755,6 +769,7 @@ CannotBeginFetch:
   self.completionBlock = nil;
   self.sentDataBlock = nil;
   self.receivedDataBlock = nil;
+  self.accumulateDataBlock = nil;
   self.retryBlock = nil;
 #endif
 }
@@ -953,6 +968,12 @@ CannotBeginFetch:
 
     self.response = response;
 
+    if (connectionStartDate_ != nil) {
+      responseTime_ = -connectionStartDate_.timeIntervalSinceNow;
+      [connectionStartDate_ release];
+      connectionStartDate_ = nil;
+    }
+
     // Save cookies from the response
     [self handleCookiesForResponse:response];
   }
@@ -1247,6 +1268,14 @@ totalBytesExpectedToWrite:(NSInteger)totalBytesExpectedToWrite {
         [self connection:connection didFailWithError:error];
         return;
       }
+#if NS_BLOCKS_AVAILABLE
+    } else if (accumulateDataBlock_ && self.statusCode < 300) {
+      // hand the data to the client rather than accumulating it; the body
+      // of an unsuccessful response is kept, since it describes the error
+      accumulateDataBlock_(data);
+
+      downloadedLength_ += data.length;
+#endif
     } else {
       // append to mutable data
       [downloadedData_ appendData:data];
@@ -1304,6 +1333,11 @@ totalBytesExpectedToWrite:(NSInteger)totalBytesExpectedToWrite {
         // Failed to write data, likely due to lack of disk space
         status = kGTMHTTPFetcherErrorFileHandleException;
       }
+#if NS_BLOCKS_AVAILABLE
+    } else if (accumulateDataBlock_) {
+      accumulateDataBlock_(cachedData);
+      downloadedLength_ = cachedData.length;
+#endif
     } else {
       [downloadedData_ setData:cachedData];
       downloadedLength_ = cachedData.length;
@@ -1327,7 +1361,12 @@ totalBytesExpectedToWrite:(NSInteger)totalBytesExpectedToWrite {
     hasConnectionEnded_ = YES;
 
     // Skip caching ETagged results when the data is being saved to a file
-    if (downloadFileHandle_ == nil) {
+    // or handed to the client as it arrives
+    BOOL isAccumulatingData = NO;
+#if NS_BLOCKS_AVAILABLE
+    isAccumulatingData = (accumulateDataBlock_ != nil);
+#endif
+    if (downloadFileHandle_ == nil && !isAccumulatingData) {
       [fetchHistory_ updateFetchHistoryWithRequest:request_
                                           response:response_
                                     downloadedData:downloadedData_];
@@ -1447,6 +1486,9 @@ totalBytesExpectedToWrite:(NSInteger)totalBytesExpectedToWrite {
     // We no longer need to cancel the connection
     hasConnectionEnded_ = YES;
 
+    didTimeOut_ = (error.code == NSURLErrorTimedOut
+                   && [error.domain isEqual:NSURLErrorDomain]);
+
     [self logNowWithError:error];
   }
 
@@ -1744,6 +1786,10 @@ totalBytesExpectedToWrite:(NSInteger)totalBytesExpectedToWrite {
             service = service_,
             serviceHost = serviceHost_,
             servicePriority = servicePriority_,
+            serviceClient = serviceClient_,
+            serviceWaitTime = serviceWaitTime_,
+            responseTime = responseTime_,
+            didTimeOut = didTimeOut_,
             thread = thread_,
             sentDataSelector = sentDataSel_,
             receivedDataSelector = receivedDataSel_,
@@ -1765,6 +1811,7 @@ totalBytesExpectedToWrite:(NSInteger)totalBytesExpectedToWrite {
 @synthesize completionBlock = completionBlock_,
             sentDataBlock = sentDataBlock_,
             receivedDataBlock = receivedDataBlock_,
+            accumulateDataBlock = accumulateDataBlock_,
             retryBlock = retryBlock_;
 #endif
 
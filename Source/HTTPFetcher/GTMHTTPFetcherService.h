@@ -41,6 +41,20 @@
   NSMutableDictionary *runningHosts_;
   NSUInteger maxRunningFetchersPerHost_;
 
+  NSMutableDictionary *clientWeights_;     // client -> weight
+  NSMutableDictionary *hostClientTimes_;   // host -> (client -> virtual time)
+  NSMutableDictionary *hostVirtualTimes_;  // host -> virtual time
+  NSMapTable *delayDates_;                 // fetcher -> date it was delayed
+  NSMutableDictionary *waitTimeTotals_;    // priority -> seconds waited
+  NSMutableDictionary *waitCounts_;        // priority -> fetchers started
+
+  BOOL shouldAdaptRunningFetchersPerHost_;
+  NSUInteger maxAdaptiveRunningFetchersPerHost_;
+  NSMutableDictionary *hostLimits_;        // host -> adapted running limit
+  NSMutableDictionary *hostLatencies_;     // host -> smoothed seconds
+  NSMutableDictionary *hostCutDates_;      // host -> date the limit was cut
+  NSMapTable *startDates_;                 // fetcher -> date it was started
+
   GTMHTTPFetchHistory *fetchHistory_;
   NSOperationQueue *delegateQueue_;
   NSArray *runLoopModes_;
@@ -81,8 +95,47 @@
 @property (retain, readonly) NSDictionary *delayedHosts;
 @property (retain, readonly) NSDictionary *runningHosts;
 
+// Adaptive host limits
+//
+// When enabled, the number of fetchers run at once for each host adapts to
+// how the host responds.  A host's limit starts at maxRunningFetchersPerHost
+// and grows by about one for each limit's worth of fetches that complete,
+// up to maxAdaptiveRunningFetchersPerHost.  The limit is halved, though not
+// below one, when a fetch gets status 429 or 503, a 403 rate limit error,
+// or times out, or when its response takes more than twice the host's usual
+// time to arrive; fetches begun before the limit was last halved do not
+// halve it again.
+//
+// Adaptation has no effect when maxRunningFetchersPerHost is 0.
+//
+// The default is NO, and the default maximum is 32.
+@property (assign) BOOL shouldAdaptRunningFetchersPerHost;
+@property (assign) NSUInteger maxAdaptiveRunningFetchersPerHost;
+
+// The number of fetchers that may run at once for the host
+- (NSUInteger)runningFetcherLimitForHost:(NSString *)host;
+
 - (BOOL)isDelayingFetcher:(GTMHTTPFetcher *)fetcher;
 
+// Fair sharing of each host
+//
+// Delayed fetchers are started in order of their servicePriority, so a
+// fetcher begun with a higher priority than the fetchers already waiting for
+// its host starts ahead of them.  Among waiting fetchers of equal priority,
+// each serviceClient is given a share of the fetches started proportional to
+// its weight, so that a client with many fetchers cannot starve the others;
+// a client's own fetchers start in the order they were begun.
+//
+// The default weight of each client is 1; weights of 0 are treated as 1.
+- (void)setWeight:(NSUInteger)weight forServiceClient:(NSString *)client;
+- (NSUInteger)weightForServiceClient:(NSString *)client;
+
+// Number of fetchers of a priority now waiting to be started, and the average
+// number of seconds fetchers of that priority have waited before starting,
+// including those started without delay
+- (NSUInteger)numberOfDelayedFetchersWithPriority:(NSInteger)priority;
+- (NSTimeInterval)averageWaitTimeForPriority:(NSInteger)priority;
+
 @property (NS_NONATOMIC_IOSONLY, readonly) NSUInteger numberOfFetchers;        // running + delayed fetchers
 @property (NS_NONATOMIC_IOSONLY, readonly) NSUInteger numberOfRunningFetchers;
 @property (NS_NONATOMIC_IOSONLY, readonly) NSUInteger numberOfDelayedFetchers;
@@ -112,6 +165,12 @@
 @property (assign) NSInteger cookieStorageMethod;
 @property (assign) BOOL shouldRememberETags;      // default: NO
 @property (assign) BOOL shouldCacheETaggedData;   // default: NO
+@property (assign) NSUInteger ETaggedDataCacheCapacity;
+
+// Setting a directory path keeps the ETag cache on disk as well, so it
+// survives relaunches; see GTMHTTPFetchHistory's diskCachePath.
+@property (copy) NSString *ETaggedDataDiskCachePath;     // default: nil
+@property (assign) NSUInteger ETaggedDataDiskCacheCapacity;
 
 - (void)clearETaggedDataCache;
 - (void)clearHistory;
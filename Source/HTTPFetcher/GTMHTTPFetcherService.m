@@ -19,6 +19,40 @@
 
 #import "GTMHTTPFetcherService.h"
 
+// Key for fetchers that have no serviceClient
+static NSString *const kDefaultServiceClient = @"";
+
+static const NSUInteger kDefaultMaxAdaptiveRunningFetchersPerHost = 32;
+
+// Per-fetcher dates are keyed by the fetcher itself, retained and compared by
+// identity, so an entry can't be picked up by a later fetcher at the same
+// address
+static const NSPointerFunctionsOptions kFetcherKeyOptions =
+  NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality;
+
+// Weight of each new response time in a host's smoothed response time, and how
+// much longer than that a response must take to be counted as a latency spike
+static const double kLatencySmoothingFactor = 0.2;
+static const double kLatencySpikeFactor = 2.0;
+static const NSTimeInterval kMinLatencySpike = 0.1;
+
+// Servers throttle with status 429 (too many requests) or 503 (service
+// unavailable); Google APIs also report exceeded rate limits as status 403
+// with a reason such as rateLimitExceeded or userRateLimitExceeded
+static BOOL IsThrottledResponse(NSInteger status, NSData *data) {
+  if (status == 429 || status == 503) return YES;
+  if (status != 403 || data.length == 0) return NO;
+
+  for (NSString *reason in @[ @"rateLimitExceeded", @"RateLimitExceeded" ]) {
+    NSData *reasonData = [reason dataUsingEncoding:NSUTF8StringEncoding];
+    NSRange range = [data rangeOfData:reasonData
+                              options:0
+                                range:NSMakeRange(0, data.length)];
+    if (range.location != NSNotFound) return YES;
+  }
+  return NO;
+}
+
 @interface GTMHTTPFetcher (ServiceMethods)
 - (BOOL)beginFetchMayDelay:(BOOL)mayDelay
               mayAuthorize:(BOOL)mayAuthorize;
@@ -44,6 +78,8 @@
             shouldFetchInBackground = shouldFetchInBackground_,
             allowedInsecureSchemes = allowedInsecureSchemes_,
             allowLocalhostRequest = allowLocalhostRequest_,
+            shouldAdaptRunningFetchersPerHost = shouldAdaptRunningFetchersPerHost_,
+            maxAdaptiveRunningFetchersPerHost = maxAdaptiveRunningFetchersPerHost_,
             fetchHistory = fetchHistory_;
 
 - (instancetype)init {
@@ -52,9 +88,24 @@
     fetchHistory_ = [[GTMHTTPFetchHistory alloc] init];
     delayedHosts_ = [[NSMutableDictionary alloc] init];
     runningHosts_ = [[NSMutableDictionary alloc] init];
+    clientWeights_ = [[NSMutableDictionary alloc] init];
+    hostClientTimes_ = [[NSMutableDictionary alloc] init];
+    hostVirtualTimes_ = [[NSMutableDictionary alloc] init];
+    delayDates_ = [[NSMapTable alloc] initWithKeyOptions:kFetcherKeyOptions
+                                            valueOptions:NSPointerFunctionsStrongMemory
+                                                capacity:0];
+    waitTimeTotals_ = [[NSMutableDictionary alloc] init];
+    waitCounts_ = [[NSMutableDictionary alloc] init];
+    hostLimits_ = [[NSMutableDictionary alloc] init];
+    hostLatencies_ = [[NSMutableDictionary alloc] init];
+    hostCutDates_ = [[NSMutableDictionary alloc] init];
+    startDates_ = [[NSMapTable alloc] initWithKeyOptions:kFetcherKeyOptions
+                                            valueOptions:NSPointerFunctionsStrongMemory
+                                                capacity:0];
     cookieStorageMethod_ = kGTMHTTPFetcherCookieStorageMethodFetchHistory;
 
     maxRunningFetchersPerHost_ = 10;
+    maxAdaptiveRunningFetchersPerHost_ = kDefaultMaxAdaptiveRunningFetchersPerHost;
 }
   return self;
 }
@@ -64,6 +115,16 @@
 
   [delayedHosts_ release];
   [runningHosts_ release];
+  [clientWeights_ release];
+  [hostClientTimes_ release];
+  [hostVirtualTimes_ release];
+  [delayDates_ release];
+  [waitTimeTotals_ release];
+  [waitCounts_ release];
+  [hostLimits_ release];
+  [hostLatencies_ release];
+  [hostCutDates_ release];
+  [startDates_ release];
   [fetchHistory_ release];
   [userAgent_ release];
   [delegateQueue_ release];
@@ -123,8 +184,118 @@
 
 #pragma mark Queue Management
 
+// Hosts are shared among clients by start-time fair queuing: a client's next
+// fetcher is tagged with the later of the client's virtual time and the host's,
+// and the fetcher with the earliest tag is started first.  Starting a fetcher
+// advances its client's virtual time by the inverse of the client's weight.
+- (double)startTagForFetcher:(GTMHTTPFetcher *)fetcher
+                     forHost:(NSString *)host {
+  NSString *client = fetcher.serviceClient;
+  if (client == nil) client = kDefaultServiceClient;
+
+  double clientTime = [hostClientTimes_[host][client] doubleValue];
+  double hostTime = [hostVirtualTimes_[host] doubleValue];
+  return MAX(clientTime, hostTime);
+}
+
+- (void)recordStartOfFetcher:(GTMHTTPFetcher *)fetcher
+                     forHost:(NSString *)host {
+  NSString *client = fetcher.serviceClient;
+  if (client == nil) client = kDefaultServiceClient;
+
+  double startTag = [self startTagForFetcher:fetcher forHost:host];
+  NSMutableDictionary *clientTimes = hostClientTimes_[host];
+  if (clientTimes == nil) {
+    clientTimes = [NSMutableDictionary dictionary];
+    hostClientTimes_[host] = clientTimes;
+  }
+  NSUInteger weight = [self weightForServiceClient:client];
+  clientTimes[client] = @(startTag + 1.0 / weight);
+  hostVirtualTimes_[host] = @(startTag);
+
+  NSTimeInterval waitTime = 0;
+  NSDate *delayDate = [delayDates_ objectForKey:fetcher];
+  if (delayDate) {
+    waitTime = -delayDate.timeIntervalSinceNow;
+    [delayDates_ removeObjectForKey:fetcher];
+  }
+  fetcher.serviceWaitTime = waitTime;
+
+  NSNumber *priorityKey = @(fetcher.servicePriority);
+  waitTimeTotals_[priorityKey] = @([waitTimeTotals_[priorityKey] doubleValue] + waitTime);
+  waitCounts_[priorityKey] = @([waitCounts_[priorityKey] unsignedIntegerValue] + 1);
+
+  [startDates_ setObject:[NSDate date] forKey:fetcher];
+}
+
+- (NSUInteger)runningFetcherLimitForHost:(NSString *)host {
+  @synchronized(self) {
+    NSNumber *limit = hostLimits_[host];
+    if (!shouldAdaptRunningFetchersPerHost_
+        || maxRunningFetchersPerHost_ == 0
+        || limit == nil) {
+      return maxRunningFetchersPerHost_;
+    }
+    return (NSUInteger)limit.doubleValue;
+  }
+}
+
+// Additive increase, multiplicative decrease of the host's limit, driven by
+// the response to the stopped fetcher and by how long the response took
+- (void)adaptLimitForHost:(NSString *)host
+          toStoppedFetcher:(GTMHTTPFetcher *)fetcher {
+  NSDate *startDate = [[[startDates_ objectForKey:fetcher] retain] autorelease];
+  [startDates_ removeObjectForKey:fetcher];
+
+  if (!shouldAdaptRunningFetchersPerHost_ || maxRunningFetchersPerHost_ == 0) return;
+
+  // A timed out connection is a sign of an overloaded host; other fetchers
+  // stopped before getting a response say nothing about the host
+  NSInteger status = fetcher.statusCode;
+  BOOL didTimeOut = fetcher.didTimeOut;
+  if (startDate == nil || (status == 0 && !didTimeOut)) return;
+
+  NSNumber *limitNum = hostLimits_[host];
+  double limit = (limitNum ? limitNum.doubleValue : maxRunningFetchersPerHost_);
+
+  BOOL isThrottled = (didTimeOut
+                      || IsThrottledResponse(status, fetcher.downloadedData));
+  BOOL isLatencySpike = NO;
+  NSTimeInterval latency = fetcher.responseTime;
+  if (!isThrottled && latency > 0) {
+    // The time to the first response leaves out retry waits and the size of
+    // the body
+    NSNumber *smoothedNum = hostLatencies_[host];
+    if (smoothedNum) {
+      double smoothed = smoothedNum.doubleValue;
+      isLatencySpike = (latency > smoothed * kLatencySpikeFactor
+                        && latency - smoothed > kMinLatencySpike);
+      smoothed += kLatencySmoothingFactor * (latency - smoothed);
+      hostLatencies_[host] = @(smoothed);
+    } else {
+      hostLatencies_[host] = @(latency);
+    }
+  }
+
+  if (isThrottled || isLatencySpike) {
+    // Fetchers begun before the last cut met the same congestion, so they
+    // do not cut the limit again
+    NSDate *cutDate = hostCutDates_[host];
+    if (cutDate == nil || [startDate compare:cutDate] == NSOrderedDescending) {
+      limit = MAX(1.0, floor(limit / 2));
+      hostCutDates_[host] = [NSDate date];
+    }
+  } else {
+    double maxLimit = MAX(maxAdaptiveRunningFetchersPerHost_, maxRunningFetchersPerHost_);
+    limit = MIN(limit + 1.0 / limit, maxLimit);
+  }
+  hostLimits_[host] = @(limit);
+}
+
 - (void)addRunningFetcher:(GTMHTTPFetcher *)fetcher
                   forHost:(NSString *)host {
+  [self recordStartOfFetcher:fetcher forHost:host];
+
   // Add to the array of running fetchers for this host, creating the array
   // if needed
   NSMutableArray *runningForHost = runningHosts_[host];
@@ -147,6 +318,31 @@
   } else {
     [delayedForHost addObject:fetcher];
   }
+
+  [delayDates_ setObject:[NSDate date] forKey:fetcher];
+}
+
+- (GTMHTTPFetcher *)nextDelayedFetcherForHost:(NSString *)host {
+  // Only fetchers of the highest priority waiting may start, defaulting to
+  // FIFO for equal priorities within a client
+  NSArray *delayedForHost = delayedHosts_[host];
+  NSInteger minPriority = NSIntegerMax;
+  for (GTMHTTPFetcher *delayedFetcher in delayedForHost) {
+    minPriority = MIN(minPriority, delayedFetcher.servicePriority);
+  }
+
+  GTMHTTPFetcher *nextFetcher = nil;
+  double nextStartTag = 0;
+  for (GTMHTTPFetcher *delayedFetcher in delayedForHost) {
+    if (delayedFetcher.servicePriority != minPriority) continue;
+
+    double startTag = [self startTagForFetcher:delayedFetcher forHost:host];
+    if (nextFetcher == nil || startTag < nextStartTag) {
+      nextFetcher = delayedFetcher;
+      nextStartTag = startTag;
+    }
+  }
+  return nextFetcher;
 }
 
 - (BOOL)isDelayingFetcher:(GTMHTTPFetcher *)fetcher {
@@ -193,8 +389,8 @@
     fetcher.serviceHost = host;
     fetcher.thread = [NSThread currentThread];
 
-    if (maxRunningFetchersPerHost_ == 0
-        || maxRunningFetchersPerHost_ > runningForHost.count) {
+    NSUInteger limit = [self runningFetcherLimitForHost:host];
+    if (limit == 0 || limit > runningForHost.count) {
       [self addRunningFetcher:fetcher forHost:host];
       return YES;
     } else {
@@ -253,24 +449,19 @@
       return;
     }
 
+    [self adaptLimitForHost:host toStoppedFetcher:fetcher];
+
     NSMutableArray *runningForHost = runningHosts_[host];
     [runningForHost removeObject:fetcher];
 
     NSMutableArray *delayedForHost = delayedHosts_[host];
     [delayedForHost removeObject:fetcher];
+    [delayDates_ removeObjectForKey:fetcher];
 
     while (delayedForHost.count > 0
-           && runningForHost.count < maxRunningFetchersPerHost_) {
-      // Start another delayed fetcher running, scanning for the minimum
-      // priority value, defaulting to FIFO for equal priorities
-      GTMHTTPFetcher *nextFetcher = nil;
-      for (GTMHTTPFetcher *delayedFetcher in delayedForHost) {
-        if (nextFetcher == nil
-            || delayedFetcher.servicePriority < nextFetcher.servicePriority) {
-          nextFetcher = delayedFetcher;
-        }
-      }
-
+           && runningForHost.count < [self runningFetcherLimitForHost:host]) {
+      // Start another delayed fetcher running
+      GTMHTTPFetcher *nextFetcher = [self nextDelayedFetcherForHost:host];
       if (nextFetcher) {
         [self addRunningFetcher:nextFetcher forHost:host];
         runningForHost = runningHosts_[host];
@@ -289,6 +480,12 @@
       [delayedHosts_ removeObjectForKey:host];
     }
 
+    if (runningForHost.count == 0 && delayedForHost.count == 0) {
+      // The host is idle, so no client is owed a share of it
+      [hostClientTimes_ removeObjectForKey:host];
+      [hostVirtualTimes_ removeObjectForKey:host];
+    }
+
     // The fetcher is no longer in the running or the delayed array,
     // so remove its host and thread properties
     fetcher.serviceHost = nil;
@@ -326,6 +523,49 @@
   }
 }
 
+- (NSUInteger)numberOfDelayedFetchersWithPriority:(NSInteger)priority {
+  @synchronized(self) {
+    NSUInteger sum = 0;
+    for (NSString *host in delayedHosts_) {
+      for (GTMHTTPFetcher *fetcher in delayedHosts_[host]) {
+        if (fetcher.servicePriority == priority) sum++;
+      }
+    }
+    return sum;
+  }
+}
+
+- (NSTimeInterval)averageWaitTimeForPriority:(NSInteger)priority {
+  @synchronized(self) {
+    NSNumber *priorityKey = @(priority);
+    NSUInteger count = [waitCounts_[priorityKey] unsignedIntegerValue];
+    if (count == 0) return 0;
+
+    return [waitTimeTotals_[priorityKey] doubleValue] / count;
+  }
+}
+
+- (void)setWeight:(NSUInteger)weight forServiceClient:(NSString *)client {
+  @synchronized(self) {
+    if (client == nil) client = kDefaultServiceClient;
+
+    if (weight <= 1) {
+      [clientWeights_ removeObjectForKey:client];
+    } else {
+      clientWeights_[client] = @(weight);
+    }
+  }
+}
+
+- (NSUInteger)weightForServiceClient:(NSString *)client {
+  @synchronized(self) {
+    if (client == nil) client = kDefaultServiceClient;
+
+    NSUInteger weight = [clientWeights_[client] unsignedIntegerValue];
+    return (weight > 0 ? weight : 1);
+  }
+}
+
 - (NSArray *)issuedFetchersWithRequestURL:(NSURL *)requestURL {
   @synchronized(self) {
     NSMutableArray *array = nil;
@@ -365,6 +605,8 @@
     // starting more fetchers running as a side effect of stopping one
     NSArray *delayedForHosts = delayedHosts_.allValues;
     [delayedHosts_ removeAllObjects];
+    [delayDates_ removeAllObjects];
+    [startDates_ removeAllObjects];
 
     for (NSArray *delayedForHost in delayedForHosts) {
       for (GTMHTTPFetcher *fetcher in delayedForHost) {
@@ -403,6 +645,22 @@
   return self.fetchHistory.memoryCapacity;
 }
 
+- (void)setETaggedDataDiskCachePath:(NSString *)path {
+  self.fetchHistory.diskCachePath = path;
+}
+
+- (NSString *)ETaggedDataDiskCachePath {
+  return self.fetchHistory.diskCachePath;
+}
+
+- (void)setETaggedDataDiskCacheCapacity:(NSUInteger)totalBytes {
+  self.fetchHistory.diskCapacity = totalBytes;
+}
+
+- (NSUInteger)ETaggedDataDiskCacheCapacity {
+  return self.fetchHistory.diskCapacity;
+}
+
 - (void)setShouldRememberETags:(BOOL)flag {
   self.fetchHistory.shouldRememberETags = flag;
 }
@@ -45,6 +45,16 @@
 - (void)setReservationInterval:(NSTimeInterval)secs;
 @end
 
+@interface GTMURLDiskCache : NSObject
+- (id)initWithPath:(NSString *)path diskCapacity:(NSUInteger)totalBytes;
+- (GTMCachedURLResponse *)cachedResponseForRequest:(NSURLRequest *)request;
+- (void)storeCachedResponse:(GTMCachedURLResponse *)cachedResponse forRequest:(NSURLRequest *)request;
+- (void)removeCachedResponseForRequest:(NSURLRequest *)request;
+- (void)removeAllCachedResponses;
+- (NSUInteger)responseCount;
+- (unsigned long long)logLength;
+@end
+
 @interface GTMCookieStorage : NSObject
 - (void)setCookies:(NSArray *)newCookies;
 - (NSArray *)cookiesForURL:(NSURL *)theURL;
@@ -187,6 +197,137 @@
   XCTAssertNotNil(foundResponse, @"huge was not cached");
 }
 
+- (void)testURLCacheRecentUse {
+  // a cache holding three 10-byte responses
+  GTMURLCache *cache = [[[GTMURLCache alloc] initWithMemoryCapacity:35] autorelease];
+
+  NSMutableArray *requests = [NSMutableArray array];
+  NSMutableArray *cachedResponses = [NSMutableArray array];
+  NSData *data = [@"1234567890" dataUsingEncoding:NSUTF8StringEncoding];
+  for (int idx = 0; idx < 5; idx++) {
+    NSString *urlStr = [NSString stringWithFormat:@"http://example.com/%d", idx];
+    NSURL *url = [NSURL URLWithString:urlStr];
+    [requests addObject:[NSURLRequest requestWithURL:url]];
+
+    NSURLResponse *response =
+      [[[NSURLResponse alloc] initWithURL:url
+                                 MIMEType:@"text/xml"
+                    expectedContentLength:-1
+                         textEncodingName:nil] autorelease];
+    GTMCachedURLResponse *cachedResponse =
+      [[[GTMCachedURLResponse alloc] initWithResponse:response
+                                                 data:data] autorelease];
+    [cachedResponses addObject:cachedResponse];
+  }
+
+  for (int idx = 0; idx < 3; idx++) {
+    [cache storeCachedResponse:cachedResponses[idx] forRequest:requests[idx]];
+  }
+  XCTAssertEqual([cache totalDataSize], (NSUInteger)30);
+
+  // reading the oldest response makes the second one the least recently used
+  XCTAssertEqualObjects([cache cachedResponseForRequest:requests[0]],
+                        cachedResponses[0]);
+  [cache storeCachedResponse:cachedResponses[3] forRequest:requests[3]];
+  XCTAssertNil([cache cachedResponseForRequest:requests[1]]);
+  XCTAssertNotNil([cache cachedResponseForRequest:requests[2]]);
+  XCTAssertNotNil([cache cachedResponseForRequest:requests[0]]);
+
+  // re-storing a response moves it rather than adding a second copy
+  [cache storeCachedResponse:cachedResponses[3] forRequest:requests[4]];
+  XCTAssertEqual([[cache responses] count], (NSUInteger)3);
+  XCTAssertEqual([cache totalDataSize], (NSUInteger)30);
+  XCTAssertNil([cache cachedResponseForRequest:requests[3]]);
+  XCTAssertEqualObjects([cache cachedResponseForRequest:requests[4]],
+                        cachedResponses[3]);
+
+  // shrinking the cache evicts from the least recently used end; request 2
+  // is now the oldest, then 0, then 4
+  [cache setMemoryCapacity:20];
+  XCTAssertEqual([[cache responses] count], (NSUInteger)2);
+  XCTAssertNil([cache cachedResponseForRequest:requests[2]]);
+
+  [cache removeAllCachedResponses];
+  XCTAssertEqual([cache totalDataSize], (NSUInteger)0);
+  [cache storeCachedResponse:cachedResponses[0] forRequest:requests[0]];
+  XCTAssertEqualObjects([cache cachedResponseForRequest:requests[0]],
+                        cachedResponses[0]);
+}
+
+- (void)testURLDiskCache {
+  NSString *dirPath = [NSTemporaryDirectory() stringByAppendingPathComponent:
+                       [NSString stringWithFormat:@"GTMURLDiskCacheTest-%u", arc4random()]];
+  NSString *logPath = [dirPath stringByAppendingPathComponent:@"responses.log"];
+
+  NSMutableArray *requests = [NSMutableArray array];
+  NSMutableArray *cachedResponses = [NSMutableArray array];
+  for (int idx = 0; idx < 3; idx++) {
+    NSString *urlStr = [NSString stringWithFormat:@"http://example.com/%d", idx];
+    NSURL *url = [NSURL URLWithString:urlStr];
+    [requests addObject:[NSURLRequest requestWithURL:url]];
+
+    NSString *etag = [NSString stringWithFormat:@"\"etag%d\"", idx];
+    NSHTTPURLResponse *response =
+      [[[NSHTTPURLResponse alloc] initWithURL:url
+                                   statusCode:200
+                                  HTTPVersion:@"HTTP/1.1"
+                                 headerFields:@{ @"Etag" : etag }] autorelease];
+    NSString *body = [NSString stringWithFormat:@"response body %d", idx];
+    NSData *data = [body dataUsingEncoding:NSUTF8StringEncoding];
+    GTMCachedURLResponse *cachedResponse =
+      [[[GTMCachedURLResponse alloc] initWithResponse:response
+                                                 data:data] autorelease];
+    [cachedResponses addObject:cachedResponse];
+  }
+
+  GTMURLDiskCache *cache =
+    [[[GTMURLDiskCache alloc] initWithPath:dirPath diskCapacity:100000] autorelease];
+  XCTAssertNotNil(cache);
+  for (int idx = 0; idx < 3; idx++) {
+    [cache storeCachedResponse:cachedResponses[idx] forRequest:requests[idx]];
+  }
+  [cache removeCachedResponseForRequest:requests[1]];
+  XCTAssertEqual([cache responseCount], (NSUInteger)2);
+
+  // a new cache on the same directory sees what the first one saved
+  cache = [[[GTMURLDiskCache alloc] initWithPath:dirPath diskCapacity:100000] autorelease];
+  XCTAssertEqual([cache responseCount], (NSUInteger)2);
+  GTMCachedURLResponse *found = [cache cachedResponseForRequest:requests[0]];
+  XCTAssertEqualObjects([found data], [cachedResponses[0] data]);
+  NSDictionary *headers = [(NSHTTPURLResponse *)[found response] allHeaderFields];
+  XCTAssertEqualObjects(headers[@"Etag"], @"\"etag0\"");
+  XCTAssertNil([cache cachedResponseForRequest:requests[1]]);
+  XCTAssertNotNil([cache cachedResponseForRequest:requests[2]]);
+
+  // a partly-written record at the end of the log is dropped
+  unsigned long long goodLength = [cache logLength];
+  cache = nil;
+  NSFileHandle *handle = [NSFileHandle fileHandleForWritingAtPath:logPath];
+  [handle seekToEndOfFile];
+  [handle writeData:[@"GTMC partial record" dataUsingEncoding:NSUTF8StringEncoding]];
+  [handle closeFile];
+
+  cache = [[[GTMURLDiskCache alloc] initWithPath:dirPath diskCapacity:100000] autorelease];
+  XCTAssertEqual([cache responseCount], (NSUInteger)2);
+  XCTAssertEqual([cache logLength], goodLength);
+  XCTAssertNotNil([cache cachedResponseForRequest:requests[2]]);
+
+  // shrinking the capacity drops the least recently used responses; the log
+  // holds three same-sized responses and a removal record, so a third of it
+  // has room for only one response
+  cache = [[[GTMURLDiskCache alloc] initWithPath:dirPath
+                                    diskCapacity:(NSUInteger)(goodLength / 3)] autorelease];
+  XCTAssertEqual([cache responseCount], (NSUInteger)1);
+  XCTAssertNil([cache cachedResponseForRequest:requests[0]]);
+  XCTAssertNotNil([cache cachedResponseForRequest:requests[2]]);
+
+  [cache removeAllCachedResponses];
+  XCTAssertEqual([cache responseCount], (NSUInteger)0);
+  XCTAssertEqual([cache logLength], (unsigned long long)0);
+
+  [[NSFileManager defaultManager] removeItemAtPath:dirPath error:NULL];
+}
+
 - (void)testCookieStorage {
   GTMCookieStorage *cookieStorage = [[[GTMCookieStorage alloc] init] autorelease];
   NSArray *foundCookies;
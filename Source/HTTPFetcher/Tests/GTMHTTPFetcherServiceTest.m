@@ -263,6 +263,183 @@ static NSString *const kValidFileName = @"gettysburgaddress.txt";
                  @"service non-empty");
 }
 
+- (void)testFairFetcherScheduling {
+  if (!isServerRunning_) return;
+
+  GTMHTTPFetcherService *service = [[[GTMHTTPFetcherService alloc] init] autorelease];
+  service.maxRunningFetchersPerHost = 1;
+  service.fetchHistory.shouldRememberETags = NO;
+  service.allowLocalhostRequest = YES;
+
+  NSURL *validFileURL = [testServer_ localURLForFile:kValidFileName];
+  NSNotificationCenter *nc = [NSNotificationCenter defaultCenter];
+  NSMutableArray *observers = [NSMutableArray array];
+  NSMutableArray *startOrder = [NSMutableArray array];
+
+  // Client "sync" begins five fetchers, then client "ui" begins two, and
+  // finally a fetcher of the highest priority is begun; it still waits for
+  // the running fetcher
+  NSArray *names = @[ @"sync1", @"sync2", @"sync3", @"sync4", @"sync5",
+                      @"ui1", @"ui2", @"urgent" ];
+  NSMutableArray *fetchers = [NSMutableArray array];
+  for (NSString *name in names) {
+    GTMHTTPFetcher *fetcher = [service fetcherWithURL:validFileURL];
+    if ([name isEqual:@"urgent"]) {
+      fetcher.servicePriority = NSIntegerMin;
+    } else {
+      fetcher.serviceClient = [name substringToIndex:name.length - 1];
+    }
+    [fetchers addObject:fetcher];
+
+    id observer = [nc addObserverForName:kGTMHTTPFetcherStartedNotification
+                                  object:fetcher
+                                   queue:nil
+                              usingBlock:^(NSNotification *note) {
+                                [startOrder addObject:name];
+                              }];
+    [observers addObject:observer];
+
+    [fetcher beginFetchWithCompletionHandler:^(NSData *fetchData, NSError *fetchError) {
+      XCTAssertNil(fetchError);
+    }];
+  }
+
+  XCTAssertEqual([service numberOfDelayedFetchersWithPriority:0], (NSUInteger)6);
+  XCTAssertEqual([service numberOfDelayedFetchersWithPriority:NSIntegerMin], (NSUInteger)1);
+
+  [service waitForCompletionOfAllFetchersWithTimeout:10];
+
+  for (id observer in observers) {
+    [nc removeObserver:observer];
+  }
+
+  // The urgent fetcher goes first, and the clients then take turns
+  NSArray *expected = @[ @"sync1", @"urgent", @"ui1", @"sync2", @"ui2",
+                         @"sync3", @"sync4", @"sync5" ];
+  XCTAssertEqualObjects(startOrder, expected);
+
+  XCTAssertEqual([service numberOfDelayedFetchersWithPriority:0], (NSUInteger)0);
+  XCTAssertEqual([fetchers[0] serviceWaitTime], 0.0);
+  XCTAssertGreaterThan([fetchers[4] serviceWaitTime], 0.0);
+  XCTAssertGreaterThan([service averageWaitTimeForPriority:0], 0.0);
+  XCTAssertGreaterThan([service averageWaitTimeForPriority:NSIntegerMin], 0.0);
+  XCTAssertEqual([service averageWaitTimeForPriority:1], 0.0);
+  XCTAssertEqual([service numberOfFetchers], (NSUInteger)0);
+
+  //
+  // A client with twice the weight starts two fetchers for each of another's
+  //
+  [service setWeight:2 forServiceClient:@"ui"];
+  XCTAssertEqual([service weightForServiceClient:@"ui"], (NSUInteger)2);
+  XCTAssertEqual([service weightForServiceClient:nil], (NSUInteger)1);
+
+  [startOrder removeAllObjects];
+  [observers removeAllObjects];
+  names = @[ @"sync1", @"sync2", @"sync3", @"ui1", @"ui2", @"ui3", @"ui4" ];
+  for (NSString *name in names) {
+    GTMHTTPFetcher *fetcher = [service fetcherWithURL:validFileURL];
+    fetcher.serviceClient = [name substringToIndex:name.length - 1];
+
+    id observer = [nc addObserverForName:kGTMHTTPFetcherStartedNotification
+                                  object:fetcher
+                                   queue:nil
+                              usingBlock:^(NSNotification *note) {
+                                [startOrder addObject:name];
+                              }];
+    [observers addObject:observer];
+
+    [fetcher beginFetchWithCompletionHandler:^(NSData *fetchData, NSError *fetchError) {
+      XCTAssertNil(fetchError);
+    }];
+  }
+
+  [service waitForCompletionOfAllFetchersWithTimeout:10];
+
+  for (id observer in observers) {
+    [nc removeObserver:observer];
+  }
+
+  expected = @[ @"sync1", @"ui1", @"ui2", @"sync2", @"ui3", @"ui4", @"sync3" ];
+  XCTAssertEqualObjects(startOrder, expected);
+}
+
+- (void)testAdaptiveFetchersPerHost {
+  if (!isServerRunning_) return;
+
+  GTMHTTPFetcherService *service = [[[GTMHTTPFetcherService alloc] init] autorelease];
+  service.maxRunningFetchersPerHost = 4;
+  service.maxAdaptiveRunningFetchersPerHost = 6;
+  service.fetchHistory.shouldRememberETags = NO;
+  service.allowLocalhostRequest = YES;
+
+  NSURL *validFileURL = [testServer_ localURLForFile:kValidFileName];
+  NSString *host = [validFileURL host];
+
+  // The test server throttles requests with a status parameter, and delays
+  // requests with a sleep parameter
+  NSURL *(^URLWithQuery)(NSString *) = ^(NSString *query) {
+    NSString *fileName = [kValidFileName stringByAppendingFormat:@"?%@", query];
+    return [testServer_ localURLForFile:fileName];
+  };
+
+  void (^Fetch)(NSArray *) = ^(NSArray *URLs) {
+    for (NSURL *url in URLs) {
+      GTMHTTPFetcher *fetcher = [service fetcherWithURL:url];
+      [fetcher beginFetchWithCompletionHandler:^(NSData *fetchData, NSError *fetchError) {}];
+    }
+    [service waitForCompletionOfAllFetchersWithTimeout:10];
+  };
+
+  // Without adaptation, the limit is fixed
+  Fetch(@[ URLWithQuery(@"status=503") ]);
+  XCTAssertEqual([service runningFetcherLimitForHost:host], (NSUInteger)4);
+
+  service.shouldAdaptRunningFetchersPerHost = YES;
+
+  // Completed fetches grow the limit, up to the maximum
+  for (int idx = 0; idx < 5; idx++) {
+    Fetch(@[ validFileURL ]);
+  }
+  XCTAssertEqual([service runningFetcherLimitForHost:host], (NSUInteger)5);
+
+  for (int idx = 0; idx < 20; idx++) {
+    Fetch(@[ validFileURL ]);
+  }
+  XCTAssertEqual([service runningFetcherLimitForHost:host], (NSUInteger)6);
+
+  // Throttled fetches running together halve the limit once
+  Fetch(@[ URLWithQuery(@"status=429"), URLWithQuery(@"status=503") ]);
+  XCTAssertEqual([service runningFetcherLimitForHost:host], (NSUInteger)3);
+
+  // A fetch taking far longer than usual halves it again
+  Fetch(@[ URLWithQuery(@"sleep=0.5") ]);
+  XCTAssertEqual([service runningFetcherLimitForHost:host], (NSUInteger)1);
+
+  Fetch(@[ URLWithQuery(@"status=503") ]);
+  XCTAssertEqual([service runningFetcherLimitForHost:host], (NSUInteger)1);
+
+  // and it recovers as fetches complete
+  Fetch(@[ validFileURL ]);
+  XCTAssertEqual([service runningFetcherLimitForHost:host], (NSUInteger)2);
+
+  // A fetch that times out without a response halves it too
+  NSURLRequest *timingOutRequest =
+    [NSURLRequest requestWithURL:URLWithQuery(@"sleep=1")
+                     cachePolicy:NSURLRequestReloadIgnoringCacheData
+                 timeoutInterval:0.25];
+  GTMHTTPFetcher *timingOutFetcher = [service fetcherWithRequest:timingOutRequest];
+  [timingOutFetcher beginFetchWithCompletionHandler:^(NSData *fetchData, NSError *fetchError) {
+    XCTAssertEqual(fetchError.code, (NSInteger)NSURLErrorTimedOut);
+  }];
+  [service waitForCompletionOfAllFetchersWithTimeout:10];
+  XCTAssertTrue(timingOutFetcher.didTimeOut);
+  XCTAssertEqual(timingOutFetcher.responseTime, 0.0);
+  XCTAssertEqual([service runningFetcherLimitForHost:host], (NSUInteger)1);
+
+  // Other hosts are unaffected
+  XCTAssertEqual([service runningFetcherLimitForHost:@"127.0.0.1"], (NSUInteger)4);
+}
+
 - (void)testStopAllFetchers {
   if (!isServerRunning_) return;
 
@@ -29,6 +29,8 @@
   BOOL skipAuthorization_;
   NSDictionary *additionalHTTPHeaders_;
   NSDictionary *urlQueryParameters_;
+  NSString *fetcherServiceClient_;
+  NSInteger fetcherServicePriority_;
   GTLQueryTestBlock testBlock_;
 }
 
@@ -48,6 +50,11 @@
 // services).
 @property (NS_NONATOMIC_IOSONLY, copy) NSDictionary<NSString *,NSString *> *urlQueryParameters;
 
+// The client and priority given to the batch's fetcher, in place of the
+// ticket's; these of the queries in the batch are ignored.
+@property (NS_NONATOMIC_IOSONLY, copy) NSString *fetcherServiceClient;
+@property (NS_NONATOMIC_IOSONLY) NSInteger fetcherServicePriority;
+
 // Apps may provide a test block on the query or service to avoid network activity
 // during testing.
 //
@@ -24,6 +24,8 @@
 @synthesize shouldSkipAuthorization = skipAuthorization_,
             additionalHTTPHeaders = additionalHTTPHeaders_,
             urlQueryParameters = urlQueryParameters_,
+            fetcherServiceClient = fetcherServiceClient_,
+            fetcherServicePriority = fetcherServicePriority_,
             testBlock = testBlock_;
 
 + (instancetype)batchQuery {
@@ -45,6 +47,8 @@
   newBatch.queries = copiesOfQueries;
   newBatch.shouldSkipAuthorization = self.shouldSkipAuthorization;
   newBatch.additionalHTTPHeaders = self.additionalHTTPHeaders;
+  newBatch.fetcherServiceClient = self.fetcherServiceClient;
+  newBatch.fetcherServicePriority = self.fetcherServicePriority;
   newBatch.testBlock = self.testBlock;
   return newBatch;
 }
@@ -53,6 +57,7 @@
   [queries_ release];
   [additionalHTTPHeaders_ release];
   [urlQueryParameters_ release];
+  [fetcherServiceClient_ release];
   [requestIDMap_ release];
   [testBlock_ release];
 
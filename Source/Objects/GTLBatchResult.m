@@ -26,8 +26,9 @@
 @synthesize successes = successes_,
             failures = failures_;
 
-- (id)copyWithZone:(NSZone *)zone {
-  GTLBatchResult* newObject = [super copyWithZone:zone];
+- (id)copyWithZone:(NSZone *)zone sharingNestedJSON:(BOOL)shouldShareNestedJSON {
+  GTLBatchResult* newObject = [super copyWithZone:zone
+                                sharingNestedJSON:shouldShareNestedJSON];
   newObject.successes = [[self.successes mutableCopyWithZone:zone] autorelease];
   newObject.failures = [[self.failures mutableCopyWithZone:zone] autorelease];
   return newObject;
@@ -49,7 +50,52 @@
 
 #pragma mark -
 
+// Batches with fewer responses are decoded on the calling thread.
+static const NSUInteger kMinResponsesForParallelDecoding = 16;
+
+// The number of responses each worker decodes at a time.
+static const NSUInteger kResponsesPerWorkItem = 8;
+
+// Returns a new object for one JSON-RPC response of the batch: a
+// GTLErrorObject for a failure, or else the result object or NSNull.
++ (id)newObjectForRPCResponse:(NSDictionary *)rpcResponse
+                   surrogates:(NSDictionary *)surrogates
+                batchClassMap:(NSDictionary *)batchClassMap
+                    operation:(NSOperation *)operation
+                    isFailure:(BOOL *)outIsFailure {
+  NSMutableDictionary *errorJSON = rpcResponse[@"error"];
+  if (errorJSON) {
+    *outIsFailure = YES;
+    return [[GTLErrorObject objectWithJSON:errorJSON] retain];
+  }
+
+  *outIsFailure = NO;
+  NSString *responseID = rpcResponse[@"id"];
+  NSMutableDictionary *resultJSON = rpcResponse[@"result"];
+  Class defaultClass = batchClassMap[responseID];
+
+  id resultObject = [self objectForJSON:resultJSON
+                           defaultClass:defaultClass
+                             surrogates:surrogates
+                          batchClassMap:nil];
+  if (resultObject == nil) {
+    // methods like delete return no object
+    resultObject = [NSNull null];
+  } else if ([resultObject isKindOfClass:[GTLCollectionObject class]]
+             && !operation.isCancelled) {
+    // Create the items now, while on a decoding thread.
+    [resultObject performSelector:@selector(items)];
+  }
+  return [resultObject retain];
+}
+
 - (void)createItemsWithClassMap:(NSDictionary *)batchClassMap {
+  [self createItemsWithClassMap:batchClassMap
+                      operation:nil];
+}
+
+- (void)createItemsWithClassMap:(NSDictionary *)batchClassMap
+                      operation:(NSOperation *)operation {
   // This is called by GTLObject objectForJSON:defaultClass:
   // JSON is defined to be a dictionary, but for batch results, it really
   // is any array.
@@ -57,34 +103,63 @@
   GTL_DEBUG_ASSERT([json isKindOfClass:[NSArray class]],
                    @"didn't get an array for the batch results");
   NSArray *jsonArray = json;
+  NSUInteger count = jsonArray.count;
+
+  // Each response is decoded into its own slot, so the results are merged
+  // below in the order of the response regardless of which threads decoded
+  // them.
+  id *objects = calloc(count > 0 ? count : 1, sizeof(id));
+  BOOL *isFailures = calloc(count > 0 ? count : 1, sizeof(BOOL));
+  NSDictionary *surrogates = self.surrogates;
+  Class selfClass = [self class];
+
+  // Once the operation is cancelled, work items and responses not yet
+  // started are skipped, leaving their objects nil.
+  void (^decodeResponses)(size_t) = ^(size_t workItem) {
+    NSUInteger first = workItem * kResponsesPerWorkItem;
+    NSUInteger last = MIN(first + kResponsesPerWorkItem, count);
+    for (NSUInteger idx = first; idx < last; idx++) {
+      if (operation.isCancelled) return;
+
+      @autoreleasepool {
+        objects[idx] = [selfClass newObjectForRPCResponse:jsonArray[idx]
+                                               surrogates:surrogates
+                                            batchClassMap:batchClassMap
+                                                operation:operation
+                                                isFailure:&isFailures[idx]];
+      }
+    }
+  };
+
+  size_t numberOfWorkItems =
+    (count + kResponsesPerWorkItem - 1) / kResponsesPerWorkItem;
+  if (count >= kMinResponsesForParallelDecoding) {
+    // dispatch_apply runs the work items on the global queue's threads,
+    // bounded by the number of processors, and returns when all are done.
+    dispatch_queue_t queue =
+      dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+    dispatch_apply(numberOfWorkItems, queue, decodeResponses);
+  } else {
+    for (size_t workItem = 0; workItem < numberOfWorkItems; workItem++) {
+      decodeResponses(workItem);
+    }
+  }
 
-  NSMutableDictionary *successes = [NSMutableDictionary dictionary];
+  BOOL isCancelled = operation.isCancelled;
+  NSMutableDictionary *successes = [NSMutableDictionary dictionaryWithCapacity:count];
   NSMutableDictionary *failures = [NSMutableDictionary dictionary];
-
-  for (NSMutableDictionary *rpcResponse in jsonArray) {
-    NSString *responseID = rpcResponse[@"id"];
-
-    NSMutableDictionary *errorJSON = rpcResponse[@"error"];
-    if (errorJSON) {
-      GTLErrorObject *errorObject = [GTLErrorObject objectWithJSON:errorJSON];
-      [failures setValue:errorObject forKey:responseID];
-    } else {
-      NSMutableDictionary *resultJSON = rpcResponse[@"result"];
-
-      NSDictionary *surrogates = self.surrogates;
-      Class defaultClass = batchClassMap[responseID];
-
-      id resultObject = [[self class] objectForJSON:resultJSON
-                                       defaultClass:defaultClass
-                                         surrogates:surrogates
-                                      batchClassMap:nil];
-      if (resultObject == nil) {
-        // methods like delete return no object
-        resultObject = [NSNull null];
-      }
-      [successes setValue:resultObject forKey:responseID];
+  for (NSUInteger idx = 0; idx < count; idx++) {
+    if (!isCancelled) {
+      NSString *responseID = jsonArray[idx][@"id"];
+      NSMutableDictionary *target = isFailures[idx] ? failures : successes;
+      [target setValue:objects[idx] forKey:responseID];
     }
+    [objects[idx] release];
   }
+  free(objects);
+  free(isFailures);
+  if (isCancelled) return;
+
   self.successes = successes;
   self.failures = failures;
 }
@@ -24,6 +24,14 @@
 #import "GTLDefines.h"
 
 @interface GTLDateTime : NSObject <NSCopying> {
+  // The fields of the date and time; each may be NSUndefinedDateComponent.
+  // dateComponents_ is created from them when first asked for.
+  NSInteger year_;
+  NSInteger month_;
+  NSInteger day_;
+  NSInteger hour_;
+  NSInteger minute_;
+  NSInteger second_;
   NSDateComponents *dateComponents_;
   NSInteger milliseconds_; // This is only for the fraction of a second 0-999
   NSInteger offsetSeconds_; // may be NSUndefinedDateComponent
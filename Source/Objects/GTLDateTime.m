@@ -32,12 +32,259 @@ static const NSInteger kGTLUndefinedDateComponent = NSDateComponentUndefined;
 static const NSInteger kGTLUndefinedDateComponent = NSUndefinedDateComponent;
 #endif
 
+// Dates in this range of years are converted to and from seconds directly;
+// others, like those before the Gregorian calendar was adopted, are converted
+// by NSCalendar.
+static const NSInteger kMinDirectlyConvertedYear = 1583;
+static const NSInteger kMaxDirectlyConvertedYear = 9999;
+
+typedef struct {
+  NSInteger year;
+  NSInteger month;
+  NSInteger day;
+  NSInteger hour;
+  NSInteger minute;
+  NSInteger second;
+  NSInteger milliseconds;
+  NSInteger offsetSeconds;
+  BOOL isUniversalTime;
+} GTLDateTimeFields;
+
+// Returns the number of days from 1970-01-01 to the date in the proleptic
+// Gregorian calendar.  The month may be 1 to 12, and later days of a month
+// roll over into the following month.
+//
+// See http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+static int64_t DaysFromCivil(int64_t year, NSInteger month, NSInteger day) {
+  year -= (month <= 2);
+  int64_t era = (year >= 0 ? year : year - 399) / 400;
+  int64_t yearOfEra = year - era * 400;
+  int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + dayOfEra - 719468;
+}
+
+static BOOL ParseDigits(const char *bytes, NSUInteger count, NSInteger *outValue) {
+  NSInteger value = 0;
+  for (NSUInteger idx = 0; idx < count; idx++) {
+    char c = bytes[idx];
+    if (c < '0' || c > '9') return NO;
+    value = value * 10 + (c - '0');
+  }
+  *outValue = value;
+  return YES;
+}
+
+// Parses the fixed formats the servers use, like 2006-11-17T15:10:46.123-08:00,
+// 2006-11-17T15:10:46Z and 2006-11-17, returning NO for anything else.
+static BOOL ParseRFC3339Bytes(const char *bytes, NSUInteger length,
+                              GTLDateTimeFields *fields) {
+  fields->hour = kGTLUndefinedDateComponent;
+  fields->minute = kGTLUndefinedDateComponent;
+  fields->second = kGTLUndefinedDateComponent;
+  fields->milliseconds = 0;
+  fields->offsetSeconds = 0;
+  fields->isUniversalTime = YES;
+
+  // yyyy-mm-dd
+  if (length < 10
+      || !ParseDigits(bytes, 4, &fields->year) || bytes[4] != '-'
+      || !ParseDigits(bytes + 5, 2, &fields->month) || bytes[7] != '-'
+      || !ParseDigits(bytes + 8, 2, &fields->day)) {
+    return NO;
+  }
+  if (length == 10) return YES;
+
+  // Thh:mm:ss
+  char separator = bytes[10];
+  if (length < 19
+      || (separator != 'T' && separator != 't' && separator != ' ')
+      || !ParseDigits(bytes + 11, 2, &fields->hour) || bytes[13] != ':'
+      || !ParseDigits(bytes + 14, 2, &fields->minute) || bytes[16] != ':'
+      || !ParseDigits(bytes + 17, 2, &fields->second)) {
+    return NO;
+  }
+  NSUInteger idx = 19;
+
+  // Fractions of a second are rounded to milliseconds.
+  if (idx < length && bytes[idx] == '.') {
+    idx++;
+    NSUInteger firstDigit = idx;
+    NSInteger milliseconds = 0;
+    while (idx < length && bytes[idx] >= '0' && bytes[idx] <= '9') {
+      NSUInteger position = idx - firstDigit;
+      if (position < 3) {
+        milliseconds = milliseconds * 10 + (bytes[idx] - '0');
+      } else if (position == 3 && bytes[idx] >= '5') {
+        milliseconds++;
+      }
+      idx++;
+    }
+    if (idx == firstDigit) return NO;
+
+    for (NSUInteger position = idx - firstDigit; position < 3; position++) {
+      milliseconds *= 10;
+    }
+    fields->milliseconds = milliseconds;
+  }
+
+  // Z, +hh:mm, or nothing for universal time.
+  if (idx == length) return YES;
+
+  char sign = bytes[idx];
+  if ((sign == 'Z' || sign == 'z') && idx + 1 == length) return YES;
+
+  NSInteger offsetHour, offsetMinute;
+  if ((sign != '+' && sign != '-')
+      || idx + 6 != length
+      || !ParseDigits(bytes + idx + 1, 2, &offsetHour) || bytes[idx + 3] != ':'
+      || !ParseDigits(bytes + idx + 4, 2, &offsetMinute)) {
+    return NO;
+  }
+  fields->isUniversalTime = NO;
+
+  NSInteger totalOffset = (60 * offsetMinute) + (60 * 60 * offsetHour);
+  if (sign == '-') {
+    // special case: offset of -00:00 means undefined offset
+    totalOffset = (totalOffset == 0) ? kGTLUndefinedDateComponent : -totalOffset;
+  }
+  fields->offsetSeconds = totalOffset;
+  return YES;
+}
+
+// Scans less regular strings.
+static void ScanRFC3339String(NSString *str, GTLDateTimeFields *fields) {
+  static NSCharacterSet *gDashSet;
+  static NSCharacterSet *gTSet;
+  static NSCharacterSet *gColonSet;
+  static NSCharacterSet *gPlusMinusZSet;
+
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    gDashSet = [[NSCharacterSet characterSetWithCharactersInString:@"-"] retain];
+    gTSet = [[NSCharacterSet characterSetWithCharactersInString:@"Tt "] retain];
+    gColonSet = [[NSCharacterSet characterSetWithCharactersInString:@":"] retain];
+    gPlusMinusZSet = [[NSCharacterSet characterSetWithCharactersInString:@"+-zZ"] retain];
+  });
+
+  NSInteger year = kGTLUndefinedDateComponent;
+  NSInteger month = kGTLUndefinedDateComponent;
+  NSInteger day = kGTLUndefinedDateComponent;
+  NSInteger hour = kGTLUndefinedDateComponent;
+  NSInteger minute = kGTLUndefinedDateComponent;
+  NSInteger sec = kGTLUndefinedDateComponent;
+  NSInteger milliseconds = 0;
+  double secDouble = -1.0;
+  NSString* sign = nil;
+  NSInteger offsetHour = 0;
+  NSInteger offsetMinute = 0;
+
+  if (str.length > 0) {
+    NSScanner* scanner = [NSScanner scannerWithString:str];
+    // There should be no whitespace, so no skip characters.
+    [scanner setCharactersToBeSkipped:nil];
+
+    // for example, scan 2006-11-17T15:10:46-08:00
+    //                or 2006-11-17T15:10:46Z
+    if (// yyyy-mm-dd
+        [scanner scanInteger:&year] &&
+        [scanner scanCharactersFromSet:gDashSet intoString:NULL] &&
+        [scanner scanInteger:&month] &&
+        [scanner scanCharactersFromSet:gDashSet intoString:NULL] &&
+        [scanner scanInteger:&day] &&
+        // Thh:mm:ss
+        [scanner scanCharactersFromSet:gTSet intoString:NULL] &&
+        [scanner scanInteger:&hour] &&
+        [scanner scanCharactersFromSet:gColonSet intoString:NULL] &&
+        [scanner scanInteger:&minute] &&
+        [scanner scanCharactersFromSet:gColonSet intoString:NULL] &&
+        [scanner scanDouble:&secDouble]) {
+
+      // At this point we got secDouble, pull it apart.
+      sec = (NSInteger)secDouble;
+      double worker = secDouble - ((double)sec);
+      milliseconds = (NSInteger)round(worker * 1000.0);
+
+      // Finish parsing, now the offset info.
+      if (// Z or +hh:mm
+          [scanner scanCharactersFromSet:gPlusMinusZSet intoString:&sign] &&
+          [scanner scanInteger:&offsetHour] &&
+          [scanner scanCharactersFromSet:gColonSet intoString:NULL] &&
+          [scanner scanInteger:&offsetMinute]) {
+      }
+    }
+  }
+
+  fields->year = year;
+  fields->month = month;
+  fields->day = day;
+  fields->hour = hour;
+  fields->minute = minute;
+  fields->second = sec;
+  fields->milliseconds = milliseconds;
+
+  // determine the offset, like from Z, or -08:00:00.0
+
+  NSInteger totalOffset = kGTLUndefinedDateComponent;
+  fields->isUniversalTime = NO;
+
+  if (sign == nil || [sign caseInsensitiveCompare:@"Z"] == NSOrderedSame) {
+
+    fields->isUniversalTime = YES;
+    totalOffset = 0;
+
+  } else {
+
+    totalOffset = (60 * offsetMinute) + (60 * 60 * offsetHour);
+
+    if ([sign isEqual:@"-"]) {
+
+      if (totalOffset == 0) {
+        // special case: offset of -0.00 means undefined offset
+        totalOffset = kGTLUndefinedDateComponent;
+      } else {
+        totalOffset *= -1;
+      }
+    }
+  }
+
+  fields->offsetSeconds = totalOffset;
+}
+
+// Writes the value in decimal, padded with zeros to the width, returning the
+// number of characters written.  The buffer must have room for 21 characters.
+static NSUInteger WriteDigits(char *buffer, NSInteger value, NSUInteger width) {
+  char digits[20];
+  NSUInteger count = 0;
+  BOOL isNegative = (value < 0);
+  unsigned long long magnitude =
+    isNegative ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+  do {
+    digits[count++] = (char)('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude > 0);
+
+  NSUInteger length = 0;
+  if (isNegative) {
+    buffer[length++] = '-';
+  }
+  for (NSUInteger idx = count; idx < width; idx++) {
+    buffer[length++] = '0';
+  }
+  while (count > 0) {
+    buffer[length++] = digits[--count];
+  }
+  return length;
+}
+
 
 @interface GTLDateTime ()
 
 - (void)setFromDate:(NSDate *)date timeZone:(NSTimeZone *)tz;
 - (void)setFromRFC3339String:(NSString *)str;
 
+- (void)setFromFields:(const GTLDateTimeFields *)fields;
+
 @property (nonatomic, retain, readwrite) NSTimeZone *timeZone;
 @property (nonatomic, copy, readwrite) NSDateComponents *dateComponents;
 @property (nonatomic, assign, readwrite) NSInteger milliseconds;
@@ -67,8 +314,7 @@ static const NSInteger kGTLUndefinedDateComponent = NSUndefinedDateComponent;
 @dynamic timeZone;
 @dynamic hasTime;
 
-@synthesize dateComponents = dateComponents_,
-            milliseconds = milliseconds_,
+@synthesize milliseconds = milliseconds_,
             offsetSeconds = offsetSeconds_,
             universalTime = isUniversalTime_;
 
@@ -123,6 +369,19 @@ static const NSInteger kGTLUndefinedDateComponent = NSUndefinedDateComponent;
   return [self dateTimeWithDate:date timeZone:tz];
 }
 
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    year_ = kGTLUndefinedDateComponent;
+    month_ = kGTLUndefinedDateComponent;
+    day_ = kGTLUndefinedDateComponent;
+    hour_ = kGTLUndefinedDateComponent;
+    minute_ = kGTLUndefinedDateComponent;
+    second_ = kGTLUndefinedDateComponent;
+  }
+  return self;
+}
+
 - (void)dealloc {
   [dateComponents_ release];
   [timeZone_ release];
@@ -136,74 +395,26 @@ static const NSInteger kGTLUndefinedDateComponent = NSUndefinedDateComponent;
   return [self retain];
 }
 
-// On 10.9 and iOS 7 (and possibly earlier systems) NSDateComponents isEqual: works; check if
-// we're guaranteed to be running on those systems or later.
-#if (!TARGET_OS_IPHONE && defined(MAC_OS_X_VERSION_10_9) && MAC_OS_X_VERSION_MIN_REQUIRED >= MAC_OS_X_VERSION_10_9) \
-    || (TARGET_OS_IPHONE && defined(__IPHONE_7_0) && __IPHONE_OS_VERSION_MIN_REQUIRED >= __IPHONE_7_0)
-  #define GTL_CAN_TRUST_DATE_COMPONENTS_ISEQUAL 1
-#else
-  #define GTL_CAN_TRUST_DATE_COMPONENTS_ISEQUAL 0
-#endif
-
-// weekOfMonth and weekOfYear are available on 10.7 and iOS 5; check that we're building
-// for at least those systems.
-#if (!TARGET_OS_IPHONE && defined(MAC_OS_X_VERSION_10_7) && MAC_OS_X_VERSION_MIN_REQUIRED >= MAC_OS_X_VERSION_10_7) \
-    || (TARGET_OS_IPHONE && defined(__IPHONE_5_0) && __IPHONE_OS_VERSION_MIN_REQUIRED >= __IPHONE_5_0)
-  #define GTL_HAS_WEEK_OF_MONTH 1
-#else
-  #define GTL_HAS_WEEK_OF_MONTH 0
-#endif
-
-// week is not available starting with 10.10 and iOS 8 SDKs; check that we're not building
-// with those SDKs.
-#if (!TARGET_OS_IPHONE && defined(MAC_OS_X_VERSION_10_10) && MAC_OS_X_VERSION_MAX_ALLOWED >= MAC_OS_X_VERSION_10_10) \
-|| (TARGET_OS_IPHONE && defined(__IPHONE_8_0) && __IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_8_0)
-  #define GTL_HAS_WEEK 0
-#else
-  #define GTL_HAS_WEEK 1
-#endif
-
-// until NSDateComponent implements isEqual, we'll use this
-#if !GTL_CAN_TRUST_DATE_COMPONENTS_ISEQUAL
-- (BOOL)doesDateComponents:(NSDateComponents *)dc1
-       equalDateComponents:(NSDateComponents *)dc2 {
-
-  return dc1.era == dc2.era
-          && dc1.year == dc2.year
-          && dc1.month == dc2.month
-          && dc1.day == dc2.day
-          && dc1.hour == dc2.hour
-          && dc1.minute == dc2.minute
-          && dc1.second == dc2.second
-#if GTL_HAS_WEEK_OF_MONTH
-          && dc1.weekOfMonth == dc2.weekOfMonth
-          && dc1.weekOfYear == dc2.weekOfYear
-#endif
-#if GTL_HAS_WEEK
-          && [dc1 week] == [dc2 week]
-#endif
-          && dc1.weekday == dc2.weekday
-
-          && dc1.weekdayOrdinal == dc2.weekdayOrdinal;
-
-}
-#endif  // !GTL_CAN_TRUST_DATE_COMPONENTS_ISEQUAL
-
 - (BOOL)isEqual:(GTLDateTime *)other {
   if (self == other) return YES;
   if (![other isKindOfClass:[GTLDateTime class]]) return NO;
 
-#if GTL_CAN_TRUST_DATE_COMPONENTS_ISEQUAL
-  BOOL areDateComponentsEqual = [self.dateComponents isEqual:other.dateComponents];
-#else
-  BOOL areDateComponentsEqual = [self doesDateComponents:self.dateComponents
-                                     equalDateComponents:other.dateComponents];
-#endif
-  if (!areDateComponentsEqual) return NO;
-
-  NSTimeZone *tz1 = self.timeZone;
-  NSTimeZone *tz2 = other.timeZone;
-  BOOL areTimeZonesEqual = (tz1 == tz2 || (tz2 && [tz1 isEqual:tz2]));
+  BOOL areFieldsEqual = (year_ == other->year_
+                         && month_ == other->month_
+                         && day_ == other->day_
+                         && hour_ == other->hour_
+                         && minute_ == other->minute_
+                         && second_ == other->second_);
+  if (!areFieldsEqual) return NO;
+
+  // Without named time zones, the time zones are made from the offsets
+  // compared below.
+  BOOL areTimeZonesEqual = YES;
+  if (timeZone_ != nil || other->timeZone_ != nil) {
+    NSTimeZone *tz1 = self.timeZone;
+    NSTimeZone *tz2 = other.timeZone;
+    areTimeZonesEqual = (tz1 == tz2 || (tz2 && [tz1 isEqual:tz2]));
+  }
 
   return areTimeZonesEqual
     && self.offsetSeconds == other.offsetSeconds
@@ -289,6 +500,60 @@ static const NSInteger kGTLUndefinedDateComponent = NSUndefinedDateComponent;
     if (cachedDate_) return cachedDate_;
   }
 
+  NSDate *date = [self directlyConvertedDate];
+  if (date == nil) {
+    date = [self calendarConvertedDate];
+  }
+
+  @synchronized(self) {
+    [cachedDate_ release];
+    cachedDate_ = [date retain];
+  }
+  return date;
+}
+
+// Returns the date computed from the fields, or nil if the fields are
+// outside the range that can be converted directly.
+- (NSDate *)directlyConvertedDate {
+  BOOL hasTime = self.hasTime;
+  if (year_ < kMinDirectlyConvertedYear || year_ > kMaxDirectlyConvertedYear
+      || month_ < 1 || month_ > 12
+      || day_ < 1 || day_ > 31) {
+    return nil;
+  }
+
+  // Like calendarConvertedDate, a date without a time is at noon GMT.
+  int64_t seconds = DaysFromCivil(year_, month_, day_) * 86400;
+  NSTimeInterval extraMillisecondsAsSeconds = 0.0;
+  if (!hasTime) {
+    seconds += 12 * 60 * 60;
+  } else {
+    // A named time zone, or an unknown offset, needs a calendar.
+    if (timeZone_ != nil
+        || (offsetSeconds_ == kGTLUndefinedDateComponent && !isUniversalTime_)
+        || hour_ < 0 || hour_ > 24
+        || minute_ < 0 || minute_ > 59
+        || second_ < 0 || second_ > 60) {
+      return nil;
+    }
+    seconds += hour_ * 60 * 60 + minute_ * 60 + second_;
+    if (!isUniversalTime_) {
+      seconds -= offsetSeconds_;
+    }
+    extraMillisecondsAsSeconds = ((NSTimeInterval)milliseconds_) / 1000.0;
+  }
+
+  // As with NSCalendar, the whole seconds are relative to the reference date
+  // before the milliseconds are added.
+  NSTimeInterval interval =
+    (NSTimeInterval)(seconds - (int64_t)NSTimeIntervalSince1970);
+  if (extraMillisecondsAsSeconds > 0.0) {
+    interval += extraMillisecondsAsSeconds;
+  }
+  return [NSDate dateWithTimeIntervalSinceReferenceDate:interval];
+}
+
+- (NSDate *)calendarConvertedDate {
   NSDateComponents *dateComponents = self.dateComponents;
   NSTimeInterval extraMillisecondsAsSeconds = 0.0;
   NSCalendar *cal;
@@ -327,11 +592,6 @@ static const NSInteger kGTLUndefinedDateComponent = NSUndefinedDateComponent;
     date = [date addTimeInterval:extraMillisecondsAsSeconds];
 #endif
   }
-
-  @synchronized(self) {
-    [cachedDate_ release];
-    cachedDate_ = [date retain];
-  }
   return date;
 }
 
@@ -344,45 +604,50 @@ static const NSInteger kGTLUndefinedDateComponent = NSUndefinedDateComponent;
     if (cachedRFC3339String_) return cachedRFC3339String_;
   }
 
-  NSDateComponents *dateComponents = self.dateComponents;
-  NSInteger offset = self.offsetSeconds;
-
-  NSString *timeString = @""; // timeString like "T15:10:46-08:00"
+  // full dateString like "2006-11-17T15:10:46-08:00"
+  char buffer[160];
+  NSUInteger length = WriteDigits(buffer, year_, 4);
+  buffer[length++] = '-';
+  length += WriteDigits(buffer + length, month_, 2);
+  buffer[length++] = '-';
+  length += WriteDigits(buffer + length, day_, 2);
 
   if (self.hasTime) {
+    // time like "T15:10:46.123"
+    buffer[length++] = 'T';
+    length += WriteDigits(buffer + length, hour_, 2);
+    buffer[length++] = ':';
+    length += WriteDigits(buffer + length, minute_, 2);
+    buffer[length++] = ':';
+    length += WriteDigits(buffer + length, second_, 2);
+    if (milliseconds_ > 0) {
+      buffer[length++] = '.';
+      length += WriteDigits(buffer + length, milliseconds_, 3);
+    }
 
-    NSString *timeOffsetString; // timeOffsetString like "-08:00"
-
-    if (self.universalTime) {
-     timeOffsetString = @"Z";
+    // offset like "-08:00"
+    NSInteger offset = offsetSeconds_;
+    if (isUniversalTime_) {
+      buffer[length++] = 'Z';
     } else if (offset == kGTLUndefinedDateComponent) {
       // unknown offset is rendered as -00:00 per
       // http://www.ietf.org/rfc/rfc3339.txt section 4.3
-      timeOffsetString = @"-00:00";
+      memcpy(buffer + length, "-00:00", 6);
+      length += 6;
     } else {
-      NSString *sign = @"+";
+      buffer[length++] = (offset < 0) ? '-' : '+';
       if (offset < 0) {
-        sign = @"-";
         offset = -offset;
       }
-      timeOffsetString = [NSString stringWithFormat:@"%@%02ld:%02ld",
-        sign, (long)(offset/(60*60)) % 24, (long)(offset / 60) % 60];
+      length += WriteDigits(buffer + length, (offset / (60 * 60)) % 24, 2);
+      buffer[length++] = ':';
+      length += WriteDigits(buffer + length, (offset / 60) % 60, 2);
     }
-
-    NSString *fractionalSecondsString = @"";
-    if (self.milliseconds > 0.0) {
-      fractionalSecondsString = [NSString stringWithFormat:@".%03ld", (long)self.milliseconds];
-    }
-
-    timeString = [NSString stringWithFormat:@"T%02ld:%02ld:%02ld%@%@",
-      (long)dateComponents.hour, (long)dateComponents.minute,
-      (long)dateComponents.second, fractionalSecondsString, timeOffsetString];
   }
 
-  // full dateString like "2006-11-17T15:10:46-08:00"
-  NSString *dateString = [NSString stringWithFormat:@"%04ld-%02ld-%02ld%@",
-    (long)dateComponents.year, (long)dateComponents.month,
-    (long)dateComponents.day, timeString];
+  NSString *dateString = [[[NSString alloc] initWithBytes:buffer
+                                                   length:length
+                                                 encoding:NSASCIIStringEncoding] autorelease];
 
   @synchronized(self) {
     [cachedRFC3339String_ release];
@@ -431,113 +696,78 @@ static const NSInteger kGTLUndefinedDateComponent = NSUndefinedDateComponent;
 }
 
 - (void)setFromRFC3339String:(NSString *)str {
-  static NSCharacterSet *gDashSet;
-  static NSCharacterSet *gTSet;
-  static NSCharacterSet *gColonSet;
-  static NSCharacterSet *gPlusMinusZSet;
-
-  static dispatch_once_t onceToken;
-  dispatch_once(&onceToken, ^{
-    gDashSet = [[NSCharacterSet characterSetWithCharactersInString:@"-"] retain];
-    gTSet = [[NSCharacterSet characterSetWithCharactersInString:@"Tt "] retain];
-    gColonSet = [[NSCharacterSet characterSetWithCharactersInString:@":"] retain];
-    gPlusMinusZSet = [[NSCharacterSet characterSetWithCharactersInString:@"+-zZ"] retain];
-  });
-
-  NSInteger year = kGTLUndefinedDateComponent;
-  NSInteger month = kGTLUndefinedDateComponent;
-  NSInteger day = kGTLUndefinedDateComponent;
-  NSInteger hour = kGTLUndefinedDateComponent;
-  NSInteger minute = kGTLUndefinedDateComponent;
-  NSInteger sec = kGTLUndefinedDateComponent;
-  NSInteger milliseconds = 0;
-  double secDouble = -1.0;
-  NSString* sign = nil;
-  NSInteger offsetHour = 0;
-  NSInteger offsetMinute = 0;
-
-  if (str.length > 0) {
-    NSScanner* scanner = [NSScanner scannerWithString:str];
-    // There should be no whitespace, so no skip characters.
-    [scanner setCharactersToBeSkipped:nil];
-
-    // for example, scan 2006-11-17T15:10:46-08:00
-    //                or 2006-11-17T15:10:46Z
-    if (// yyyy-mm-dd
-        [scanner scanInteger:&year] &&
-        [scanner scanCharactersFromSet:gDashSet intoString:NULL] &&
-        [scanner scanInteger:&month] &&
-        [scanner scanCharactersFromSet:gDashSet intoString:NULL] &&
-        [scanner scanInteger:&day] &&
-        // Thh:mm:ss
-        [scanner scanCharactersFromSet:gTSet intoString:NULL] &&
-        [scanner scanInteger:&hour] &&
-        [scanner scanCharactersFromSet:gColonSet intoString:NULL] &&
-        [scanner scanInteger:&minute] &&
-        [scanner scanCharactersFromSet:gColonSet intoString:NULL] &&
-        [scanner scanDouble:&secDouble]) {
-
-      // At this point we got secDouble, pull it apart.
-      sec = (NSInteger)secDouble;
-      double worker = secDouble - ((double)sec);
-      milliseconds = (NSInteger)round(worker * 1000.0);
-
-      // Finish parsing, now the offset info.
-      if (// Z or +hh:mm
-          [scanner scanCharactersFromSet:gPlusMinusZSet intoString:&sign] &&
-          [scanner scanInteger:&offsetHour] &&
-          [scanner scanCharactersFromSet:gColonSet intoString:NULL] &&
-          [scanner scanInteger:&offsetMinute]) {
-      }
-    }
+  // Strings from JSON are usually stored as ASCII, so their bytes are read
+  // in place.
+  GTLDateTimeFields fields;
+  NSUInteger length = str.length;
+  const char *bytes = CFStringGetCStringPtr((CFStringRef)str,
+                                           kCFStringEncodingASCII);
+  char buffer[64];
+  if (bytes == NULL
+      && length < sizeof(buffer)
+      && CFStringGetCString((CFStringRef)str, buffer, sizeof(buffer),
+                            kCFStringEncodingASCII)) {
+    bytes = buffer;
   }
+  if (bytes == NULL
+      || strlen(bytes) != length
+      || !ParseRFC3339Bytes(bytes, length, &fields)) {
+    ScanRFC3339String(str, &fields);
+  }
+  [self setFromFields:&fields];
+}
 
-  NSDateComponents *dateComponents = [[[NSDateComponents alloc] init] autorelease];
-  dateComponents.year = year;
-  dateComponents.month = month;
-  dateComponents.day = day;
-  dateComponents.hour = hour;
-  dateComponents.minute = minute;
-  dateComponents.second = sec;
-
-  self.dateComponents = dateComponents;
-  self.milliseconds = milliseconds;
-
-  // determine the offset, like from Z, or -08:00:00.0
-
-  self.timeZone = nil;
-
-  NSInteger totalOffset = kGTLUndefinedDateComponent;
-  self.universalTime = NO;
-
-  if (sign == nil || [sign caseInsensitiveCompare:@"Z"] == NSOrderedSame) {
-
-    self.universalTime = YES;
-    totalOffset = 0;
-
-  } else {
-
-    totalOffset = (60 * offsetMinute) + (60 * 60 * offsetHour);
+- (void)setFromFields:(const GTLDateTimeFields *)fields {
+  year_ = fields->year;
+  month_ = fields->month;
+  day_ = fields->day;
+  hour_ = fields->hour;
+  minute_ = fields->minute;
+  second_ = fields->second;
+  milliseconds_ = fields->milliseconds;
+  offsetSeconds_ = fields->offsetSeconds;
+  isUniversalTime_ = fields->isUniversalTime;
 
-    if ([sign isEqual:@"-"]) {
+  [dateComponents_ release];
+  dateComponents_ = nil;
+  [timeZone_ release];
+  timeZone_ = nil;
+}
 
-      if (totalOffset == 0) {
-        // special case: offset of -0.00 means undefined offset
-        totalOffset = kGTLUndefinedDateComponent;
-      } else {
-        totalOffset *= -1;
-      }
+// The date components are made from the fields only when asked for.
+- (NSDateComponents *)dateComponents {
+  @synchronized(self) {
+    if (dateComponents_ == nil) {
+      NSDateComponents *dateComponents = [[NSDateComponents alloc] init];
+      dateComponents.year = year_;
+      dateComponents.month = month_;
+      dateComponents.day = day_;
+      dateComponents.hour = hour_;
+      dateComponents.minute = minute_;
+      dateComponents.second = second_;
+      dateComponents_ = dateComponents;
     }
+    return [[dateComponents_ retain] autorelease];
   }
+}
 
-  self.offsetSeconds = totalOffset;
+- (void)setDateComponents:(NSDateComponents *)dateComponents {
+  @synchronized(self) {
+    year_ = dateComponents.year;
+    month_ = dateComponents.month;
+    day_ = dateComponents.day;
+    hour_ = dateComponents.hour;
+    minute_ = dateComponents.minute;
+    second_ = dateComponents.second;
+
+    [dateComponents_ release];
+    dateComponents_ = nil;
+  }
 }
 
 - (BOOL)hasTime {
-  NSDateComponents *dateComponents = self.dateComponents;
-
-  BOOL hasTime = (dateComponents.hour != kGTLUndefinedDateComponent
-                  && dateComponents.minute != kGTLUndefinedDateComponent);
+  BOOL hasTime = (hour_ != kGTLUndefinedDateComponent
+                  && minute_ != kGTLUndefinedDateComponent);
 
   return hasTime;
 }
@@ -548,22 +778,27 @@ static const NSInteger kGTLUndefinedDateComponent = NSUndefinedDateComponent;
   BOOL hadTime = self.hasTime;
 
   if (shouldHaveTime && !hadTime) {
-    dateComponents_.hour = 0;
-    dateComponents_.minute = 0;
-    dateComponents_.second = 0;
+    hour_ = 0;
+    minute_ = 0;
+    second_ = 0;
     milliseconds_ = 0;
     offsetSeconds_ = kGTLUndefinedDateComponent;
     isUniversalTime_ = NO;
 
   } else if (hadTime && !shouldHaveTime) {
-    dateComponents_.hour = kGTLUndefinedDateComponent;
-    dateComponents_.minute = kGTLUndefinedDateComponent;
-    dateComponents_.second = kGTLUndefinedDateComponent;
+    hour_ = kGTLUndefinedDateComponent;
+    minute_ = kGTLUndefinedDateComponent;
+    second_ = kGTLUndefinedDateComponent;
     milliseconds_ = 0;
     offsetSeconds_ = kGTLUndefinedDateComponent;
     isUniversalTime_ = NO;
     self.timeZone = nil;
   }
+
+  @synchronized(self) {
+    [dateComponents_ release];
+    dateComponents_ = nil;
+  }
 }
 
 
@@ -35,6 +35,11 @@
 
 @protocol GTLBatchItemCreationProtocol
 - (void)createItemsWithClassMap:(NSDictionary *__nonnull)batchClassMap;
+@optional
+// Stops creating items soon after the operation is cancelled, leaving the
+// object without items.
+- (void)createItemsWithClassMap:(NSDictionary *__nonnull)batchClassMap
+                      operation:(NSOperation *__nullable)operation;
 @end
 
 @interface GTLObject : NSObject <NSCopying, NSSecureCoding> {
@@ -46,12 +51,25 @@
   
   // Any complex object hung off this object goes into the cache so the
   // next fetch will get the same object back instead of having to recreate
-  // it.
+  // it.  The children of the class's properties are kept in slots, numbered
+  // by the class's slot map; others, such as additional properties, are kept
+  // by JSON key.
+  id *childSlots_;
+  NSUInteger childSlotCount_;  // set when childSlots_ is allocated
+  NSDictionary *childSlotMap_;
   NSMutableDictionary *childCache_;
   
   // Anything defined by the client; retained but not used internally; not
   // copied by copyWithZone:
   NSMutableDictionary *userProperties_;
+
+  // The hash computed from the JSON, or zero if not yet computed.
+  NSUInteger cachedHash_;
+
+  // Set when containers nested in the JSON may be shared with a copy, along
+  // with the keys whose containers have since been copied.
+  BOOL sharesNestedJSON_;
+  NSMutableSet *unsharedJSONKeys_;
 }
 
 @property (nonatomic, retain) GTL_NSMutableDictionaryOf(id, id) *__nullable JSON;
@@ -68,11 +86,22 @@
 + (nonnull instancetype)object;
 + (nonnull instancetype)objectWithJSON:(NSMutableDictionary *__nonnull)dict;
 
+// Copies are deep; the copy's JSON shares no containers with the original's.
 - (nonnull id)copyWithZone:(NSZone *__nullable)zone;
 
+// A copy that shares the JSON nested in the original until objects are made
+// from it, so copying is cheap even for large objects.  Change the copy's (or
+// the original's) JSON through its properties or setJSONValue:forKey: rather
+// than by modifying the nested dictionaries and arrays of its JSON directly.
+- (nonnull id)copySharingNestedJSON;
+
 @property (NS_NONATOMIC_IOSONLY, readonly, copy) NSString *__nullable JSONString;
 
 // generic access to json; also creates it if necessary
+//
+// The object's hash is computed from its JSON and cached.  Setting the JSON
+// property, setJSONValue:forKey:, and the property setters update the hash;
+// after changing the JSON dictionary directly, set the JSON property again.
 - (void)setJSONValue:(id __nullable)obj forKey:(NSString *__nonnull)key  GTL_NONNULL((2));
 - (__nullable id)JSONValueForKey:(NSString *__nonnull)key;
 
@@ -127,6 +156,11 @@
 // These methods are intended for subclasses of GTLObject
 //
 
+// Both copyWithZone: and copySharingNestedJSON call this; subclasses with
+// state of their own override it to copy that state.
+- (nonnull id)copyWithZone:(NSZone *__nullable)zone
+         sharingNestedJSON:(BOOL)shouldShareNestedJSON;
+
 // class registration ("kind" strings) for subclasses
 + (nullable Class)registeredObjectClassForKind:(NSString *__nonnull)kind;
 + (void)registerObjectClassForKind:(NSString *__nonnull)kind;
@@ -137,6 +171,14 @@
                            surrogates:(NSDictionary *__nullable)surrogates
                         batchClassMap:(NSDictionary *__nullable)batchClassMap;
 
+// As above, but returns nil once the operation is cancelled; the objects of
+// a batch stop being created soon after it is cancelled.
++ (GTLObject *__nullable)objectForJSON:(NSMutableDictionary *__nonnull)json
+                          defaultClass:(Class __nonnull)defaultClass
+                            surrogates:(NSDictionary *__nullable)surrogates
+                         batchClassMap:(NSDictionary *__nullable)batchClassMap
+                             operation:(NSOperation *__nullable)operation;
+
 // property-to-key mapping (for JSON keys which are not used as method names)
 + (NSDictionary *__nullable)propertyToJSONKeyMap;
 
@@ -146,6 +188,24 @@
 // The default class for additional JSON keys
 + (nullable Class)classForAdditionalProperties;
 
+// Typed access to the JSON for subclasses that implement their property
+// methods directly rather than declaring the properties @dynamic.  These
+// behave the same as the methods GTLObject creates for dynamic properties,
+// including caching the objects made from the JSON.  Like those methods, the
+// getters return NSNull when the JSON holds null.
+- (nullable NSNumber *)JSONNumberForKey:(NSString *__nonnull)key;
+- (void)setJSONString:(NSString *__nullable)str forKey:(NSString *__nonnull)key;
+- (nullable id)JSONDateTimeForKey:(NSString *__nonnull)key;
+- (void)setJSONDateTime:(GTLDateTime *__nullable)dateTime forKey:(NSString *__nonnull)key;
+- (nullable id)JSONObjectForKey:(NSString *__nonnull)key objectClass:(Class __nonnull)objectClass;
+- (void)setJSONObject:(GTLObject *__nullable)obj forKey:(NSString *__nonnull)key;
+- (nullable id)JSONArrayForKey:(NSString *__nonnull)key itemClass:(Class __nonnull)itemClass;
+- (void)setJSONArray:(NSArray *__nullable)array
+              forKey:(NSString *__nonnull)key
+           itemClass:(Class __nonnull)itemClass;
+- (nullable id)JSONAnyObjectForKey:(NSString *__nonnull)key;
+- (void)setJSONAnyObject:(id __nullable)obj forKey:(NSString *__nonnull)key;
+
 @end
 
 // Collection objects with an "items" property should derive from GTLCollection
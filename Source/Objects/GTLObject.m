@@ -27,6 +27,50 @@ static NSString *const kUserDataPropertyKey = @"_userData";
 
 static NSString *const kGTLObjectJSONCoderKey = @"json";
 
+// Hash contributions of containers nested in an object's JSON.  The contents
+// of nested containers are not hashed, since child objects share them and may
+// change them without the parent object knowing.
+static const NSUInteger kNestedDictionaryHash = 0x5bd1e995;
+static const NSUInteger kNestedArrayHash = 0x27d4eb2f;
+
+static NSUInteger HashForJSONValue(id value) {
+  if ([value isKindOfClass:[NSDictionary class]]) return kNestedDictionaryHash;
+  if ([value isKindOfClass:[NSArray class]]) return kNestedArrayHash;
+  return [value hash];
+}
+
+// Spreads the bits of a hash value (the MurmurHash3 finalizer) so that
+// combining the hashes of several values does not cancel out patterns in them.
+static uint64_t MixHash(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+static NSUInteger HashForJSON(NSDictionary *json) {
+  // Resources identify themselves by id, and by etag for each version, so
+  // those suffice when present.
+  id identifier = json[@"id"];
+  if (identifier != nil) {
+    uint64_t h = MixHash(HashForJSONValue(identifier));
+    h ^= MixHash(HashForJSONValue(json[@"kind"]) + 1);
+    h ^= MixHash(HashForJSONValue(json[@"etag"]) + 2);
+    return (NSUInteger)h;
+  }
+
+  // Otherwise combine the hashes of the top-level entries, by addition so the
+  // result doesn't depend on the order of enumeration.
+  uint64_t h = json.count;
+  for (NSString *key in json) {
+    uint64_t entryHash = (uint64_t)key.hash * 31 + HashForJSONValue(json[key]);
+    h += MixHash(entryHash);
+  }
+  return (NSUInteger)h;
+}
+
 @interface GTLObject () <GTLRuntimeCommon>
 + (NSMutableArray *)allDeclaredProperties;
 + (NSArray *)allKnownKeys;
@@ -36,8 +80,88 @@ static NSString *const kGTLObjectJSONCoderKey = @"json";
 
 + (NSMutableDictionary *)patchDictionaryForJSON:(NSDictionary *)newJSON
                                fromOriginalJSON:(NSDictionary *)originalJSON;
+
+- (id)JSONCopySharingNestedJSON;
+- (void)markNestedJSONShared;
+- (id)childJSON;
+
+- (void)enumerateCachedChildrenUsingBlock:(void (^)(NSString *key, id child))block;
 @end
 
+// The cache key for the items of a GTLResultArray, whose JSON is an array.
+static NSString *const kResultArrayItemsCacheKey = @"result_array_items";
+
+#pragma mark Copy-on-write JSON
+
+// Copies and their originals share the containers nested in their JSON until
+// an object is created from one of those containers; the JSON value for the
+// new object is then copied (see childJSONValueForKey:), so objects never
+// change JSON seen by another object.
+
+static BOOL IsJSONContainer(id value) {
+  return ([value isKindOfClass:[NSDictionary class]]
+          || [value isKindOfClass:[NSArray class]]);
+}
+
+// Copies a dictionary's top level, or an array along with the top level of any
+// containers it holds, as array items may each become an object.
+static id CopyOfJSONContainers(id value) {
+  if ([value isKindOfClass:[NSDictionary class]]) {
+    return [[value mutableCopy] autorelease];
+  }
+  if ([value isKindOfClass:[NSArray class]]) {
+    NSMutableArray *array = [NSMutableArray arrayWithCapacity:[value count]];
+    for (id item in value) {
+      [array addObject:(IsJSONContainer(item) ? CopyOfJSONContainers(item) : item)];
+    }
+    return array;
+  }
+  return value;
+}
+
+static id DeepCopyOfJSON(id value) {
+  CFPropertyListRef ref = CFPropertyListCreateDeepCopy(kCFAllocatorDefault,
+                    value, kCFPropertyListMutableContainers);
+  GTL_DEBUG_ASSERT(ref != NULL, @"GTLObject: copy failed (probably a non-plist type in the JSON)");
+  return [NSMakeCollectable(ref) autorelease];
+}
+
+// Copies the JSON value for a cached child, copying only the containers
+// already owned by objects.  Containers that no object was created from are
+// shared with the copy.
+static id CopyOfJSONSharingNestedJSON(id value, id cachedChild) {
+  if (cachedChild == nil || !IsJSONContainer(value)) {
+    return value;
+  }
+  if ([cachedChild isKindOfClass:[GTLObject class]]) {
+    if ([cachedChild JSON] == value) {
+      return [cachedChild JSONCopySharingNestedJSON];
+    }
+  } else if ([cachedChild isKindOfClass:[NSArray class]]
+             && [value isKindOfClass:[NSArray class]]
+             && [cachedChild count] == [value count]) {
+    NSUInteger count = [value count];
+    NSMutableArray *array = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger idx = 0; idx < count; idx++) {
+      [array addObject:CopyOfJSONSharingNestedJSON(value[idx], cachedChild[idx])];
+    }
+    return array;
+  }
+  // The child doesn't match its JSON (such as after the JSON dictionary was
+  // changed directly), so don't rely on it.
+  return DeepCopyOfJSON(value);
+}
+
+static void MarkNestedJSONShared(id cachedChild) {
+  if ([cachedChild isKindOfClass:[GTLObject class]]) {
+    [cachedChild markNestedJSONShared];
+  } else if ([cachedChild isKindOfClass:[NSArray class]]) {
+    for (id item in cachedChild) {
+      MarkNestedJSONShared(item);
+    }
+  }
+}
+
 @implementation GTLObject
 
 @synthesize JSON = json_,
@@ -81,20 +205,46 @@ static NSString *const kGTLObjectJSONCoderKey = @"json";
 }
 
 // By definition, for two objects to potentially be considered equal,
-// they must have the same hash value.  The hash is mostly ignored,
-// but removeObjectsInArray: in Leopard does seem to check the hash,
-// and NSObject's default hash method just returns the instance pointer.
-// We'll define hash here for all of our GTLObjects.
+// they must have the same hash value.  The hash comes from the JSON that
+// isEqual: compares, so that sets and dictionary keys of many objects don't
+// fall back to comparing every pair.  It is cached until the JSON is set
+// again or changed through setJSONValue:forKey:.
 - (NSUInteger)hash {
-  return (NSUInteger) (void *) [GTLObject class];
+  NSUInteger hash = cachedHash_;
+  if (hash == 0) {
+    hash = HashForJSON(json_);
+    if (hash == 0) {
+      // zero marks the hash as not computed
+      hash = 1;
+    }
+    cachedHash_ = hash;
+  }
+  return hash;
 }
 
 - (id)copyWithZone:(NSZone *)zone {
+  return [self copyWithZone:zone sharingNestedJSON:NO];
+}
+
+- (id)copySharingNestedJSON {
+  return [self copyWithZone:NULL sharingNestedJSON:YES];
+}
+
+- (id)copyWithZone:(NSZone *)zone sharingNestedJSON:(BOOL)shouldShareNestedJSON {
   GTLObject* newObject = [[[self class] allocWithZone:zone] init];
-  CFPropertyListRef ref = CFPropertyListCreateDeepCopy(kCFAllocatorDefault,
-                    json_, kCFPropertyListMutableContainers);
-  GTL_DEBUG_ASSERT(ref != NULL, @"GTLObject: copy failed (probably a non-plist type in the JSON)");
-  newObject.JSON = [NSMakeCollectable(ref) autorelease];
+  if (json_ != nil) {
+    if (shouldShareNestedJSON) {
+      // Rather than deep copying the JSON, the copy shares the containers
+      // nested in it; both objects copy a nested container before creating
+      // an object from it.
+      newObject.JSON = [self JSONCopySharingNestedJSON];
+      newObject->sharesNestedJSON_ = YES;
+      [self markNestedJSONShared];
+    } else {
+      newObject.JSON = DeepCopyOfJSON(json_);
+    }
+    newObject->cachedHash_ = cachedHash_;
+  }
   newObject.surrogates = self.surrogates;
 
   // What we're not copying:
@@ -102,6 +252,67 @@ static NSString *const kGTLObjectJSONCoderKey = @"json";
   return newObject;
 }
 
+// The top level of the JSON is copied, along with the JSON of the objects
+// already created from this one, as those objects may change their JSON.
+- (id)JSONCopySharingNestedJSON {
+  if (![json_ isKindOfClass:[NSDictionary class]]) {
+    // A result array's JSON is an array.
+    id cachedItems = [self cacheChildForKey:kResultArrayItemsCacheKey];
+    id json = CopyOfJSONSharingNestedJSON(json_, cachedItems);
+    return (json == json_ ? [[json_ mutableCopy] autorelease] : json);
+  }
+
+  NSMutableDictionary *json = [[json_ mutableCopy] autorelease];
+  [self enumerateCachedChildrenUsingBlock:^(NSString *key, id child) {
+    id value = json[key];
+    if (value != nil) {
+      json[key] = CopyOfJSONSharingNestedJSON(value, child);
+    }
+  }];
+  return json;
+}
+
+- (void)markNestedJSONShared {
+  sharesNestedJSON_ = YES;
+  // The containers copied since the last copy are now shared with a new one.
+  [unsharedJSONKeys_ removeAllObjects];
+  [self enumerateCachedChildrenUsingBlock:^(NSString *key, id child) {
+    MarkNestedJSONShared(child);
+  }];
+}
+
+// Returns whether the JSON for the key may still be shared with a copy,
+// recording that it won't be once the caller has copied it.
+- (BOOL)shouldCopySharedJSONForKey:(NSString *)key {
+  if (!sharesNestedJSON_ || [unsharedJSONKeys_ containsObject:key]) return NO;
+
+  if (unsharedJSONKeys_ == nil) {
+    unsharedJSONKeys_ = [[NSMutableSet alloc] init];
+  }
+  [unsharedJSONKeys_ addObject:key];
+  return YES;
+}
+
+- (id)childJSONValueForKey:(NSString *)key {
+  id value = json_[key];
+  if (IsJSONContainer(value) && [self shouldCopySharedJSONForKey:key]) {
+    value = CopyOfJSONContainers(value);
+    [json_ setObject:value forKey:key];
+  }
+  return value;
+}
+
+// Like childJSONValueForKey:, for objects whose JSON is itself an array.
+- (id)childJSON {
+  if (IsJSONContainer(json_)
+      && [self shouldCopySharedJSONForKey:kResultArrayItemsCacheKey]) {
+    id json = [CopyOfJSONContainers(json_) retain];
+    [json_ release];
+    json_ = json;
+  }
+  return json_;
+}
+
 - (NSString *)descriptionWithLocale:(id)locale {
   return self.description;
 }
@@ -109,7 +320,9 @@ static NSString *const kGTLObjectJSONCoderKey = @"json";
 - (void)dealloc {
   [json_ release];
   [surrogates_ release];
+  GTLReleaseChildSlots(childSlots_, childSlotCount_);
   [childCache_ release];
+  [unsharedJSONKeys_ release];
   [userProperties_ release];
 
   [super dealloc];
@@ -134,6 +347,15 @@ static NSString *const kGTLObjectJSONCoderKey = @"json";
 
 #pragma mark JSON values
 
+- (void)setJSON:(NSMutableDictionary *)dict {
+  if (json_ != dict) {
+    [json_ release];
+    json_ = [dict retain];
+    [unsharedJSONKeys_ removeAllObjects];
+  }
+  cachedHash_ = 0;
+}
+
 - (void)setJSONValue:(id)obj forKey:(NSString *)key {
   NSMutableDictionary *dict = self.JSON;
   if (dict == nil && obj != nil) {
@@ -141,6 +363,7 @@ static NSString *const kGTLObjectJSONCoderKey = @"json";
     self.JSON = dict;
   }
   [dict setValue:obj forKey:key];
+  cachedHash_ = 0;
 }
 
 - (id)JSONValueForKey:(NSString *)key {
@@ -170,6 +393,60 @@ static NSString *const kGTLObjectJSONCoderKey = @"json";
   return result;
 }
 
+#pragma mark Typed JSON accessors
+
+- (NSNumber *)JSONNumberForKey:(NSString *)key {
+  NSNumber *num = [self JSONValueForKey:key];
+  return GTL_EnsureNSNumber(num);
+}
+
+- (void)setJSONString:(NSString *)str forKey:(NSString *)key {
+  NSString *copiedStr = [str copy];
+  [self setJSONValue:copiedStr forKey:key];
+  [copiedStr release];
+}
+
+- (id)JSONDateTimeForKey:(NSString *)key {
+  return [GTLRuntimeCommon dateTimeForJSONKey:key ofObject:self];
+}
+
+- (void)setJSONDateTime:(GTLDateTime *)dateTime forKey:(NSString *)key {
+  [GTLRuntimeCommon setDateTime:dateTime forJSONKey:key ofObject:self];
+}
+
+- (id)JSONObjectForKey:(NSString *)key objectClass:(Class)objectClass {
+  return [GTLRuntimeCommon objectForJSONKey:key
+                               defaultClass:objectClass
+                                   ofObject:self];
+}
+
+- (void)setJSONObject:(GTLObject *)obj forKey:(NSString *)key {
+  [GTLRuntimeCommon setObject:obj forJSONKey:key ofObject:self];
+}
+
+- (id)JSONArrayForKey:(NSString *)key itemClass:(Class)itemClass {
+  return [GTLRuntimeCommon arrayForJSONKey:key
+                            containedClass:itemClass
+                                  ofObject:self];
+}
+
+- (void)setJSONArray:(NSArray *)array
+              forKey:(NSString *)key
+           itemClass:(Class)itemClass {
+  [GTLRuntimeCommon setArray:array
+                  forJSONKey:key
+              containedClass:itemClass
+                    ofObject:self];
+}
+
+- (id)JSONAnyObjectForKey:(NSString *)key {
+  return [GTLRuntimeCommon anyObjectForJSONKey:key ofObject:self];
+}
+
+- (void)setJSONAnyObject:(id)obj forKey:(NSString *)key {
+  [GTLRuntimeCommon setAnyObject:obj forJSONKey:key ofObject:self];
+}
+
 #pragma mark Partial - Fields
 
 - (NSString *)fieldsDescription {
@@ -309,7 +586,7 @@ static NSString *const kGTLObjectJSONCoderKey = @"json";
   }
 
   Class defaultClass = [[self class] classForAdditionalProperties];
-  id jsonObj = [self JSONValueForKey:name];
+  id jsonObj = [self childJSONValueForKey:name];
   BOOL shouldCache = NO;
   if (jsonObj != nil) {
     NSDictionary *surrogates = self.surrogates;
@@ -352,7 +629,42 @@ static NSString *const kGTLObjectJSONCoderKey = @"json";
 // There is no property for childCache_ as there shouldn't be KVC/KVO
 // support for it, it's an implementation detail.
 
-- (void)setCacheChild:(id)obj forKey:(NSString *)key {
+// The slot map comes from the class, and lives as long as the class, so it
+// isn't retained.
+- (NSDictionary *)childSlotMap {
+  if (childSlotMap_ == nil) {
+    childSlotMap_ = [GTLRuntimeCommon childCacheSlotMapForClass:[self class]];
+  }
+  return childSlotMap_;
+}
+
+- (void)setCacheChild:(id)obj atSlot:(NSUInteger)slot forKey:(NSString *)key {
+  if (sharesNestedJSON_) {
+    // The child's JSON came from this object's, so it too may hold
+    // containers shared with copies.
+    MarkNestedJSONShared(obj);
+  }
+  NSDictionary *slotMap = (childSlots_ == NULL ? [self childSlotMap] : nil);
+  if (!GTLSetChildInSlot(&childSlots_, &childSlotCount_, slotMap, slot, obj)) {
+    // The slot doesn't belong to this class's map, so keep the child by key.
+    GTL_DEBUG_LOG(@"GTLObject: slot %lu out of range for %@",
+                  (unsigned long)slot, [self class]);
+    [self setKeyedCacheChild:obj forKey:key];
+  }
+}
+
+- (id)cacheChildAtSlot:(NSUInteger)slot forKey:(NSString *)key {
+  // Until the slots are allocated, no child is in them.
+  if (slot < childSlotCount_) {
+    return childSlots_[slot];
+  }
+  return childCache_[key];
+}
+
+- (void)setKeyedCacheChild:(id)obj forKey:(NSString *)key {
+  if (sharesNestedJSON_) {
+    MarkNestedJSONShared(obj);
+  }
   if (childCache_ == nil && obj != nil) {
     childCache_ = [[NSMutableDictionary alloc] initWithObjectsAndKeys:
                    obj, key, nil];
@@ -361,11 +673,38 @@ static NSString *const kGTLObjectJSONCoderKey = @"json";
   }
 }
 
+- (void)setCacheChild:(id)obj forKey:(NSString *)key {
+  NSNumber *slot = [self childSlotMap][key];
+  if (slot != nil) {
+    [self setCacheChild:obj atSlot:slot.unsignedIntegerValue forKey:key];
+    return;
+  }
+  [self setKeyedCacheChild:obj forKey:key];
+}
+
 - (id)cacheChildForKey:(NSString *)key {
+  NSNumber *slot = [self childSlotMap][key];
+  if (slot != nil) {
+    return [self cacheChildAtSlot:slot.unsignedIntegerValue forKey:key];
+  }
   id obj = childCache_[key];
   return obj;
 }
 
+- (void)enumerateCachedChildrenUsingBlock:(void (^)(NSString *key, id child))block {
+  if (childSlots_ != NULL) {
+    for (NSString *key in childSlotMap_) {
+      id child = childSlots_[[childSlotMap_[key] unsignedIntegerValue]];
+      if (child != nil) {
+        block(key, child);
+      }
+    }
+  }
+  for (NSString *key in childCache_) {
+    block(key, childCache_[key]);
+  }
+}
+
 #pragma mark userData and user properties
 
 - (void)setUserData:(id)userData {
@@ -508,6 +847,9 @@ static NSMutableDictionary *gKindMap = nil;
 
     Class selfClass = [self class];
 
+    // Parsed JSON will share the kind string.
+    kind = [GTLJSONParser internedString:kind];
+
 #if DEBUG
     // ensure this is a unique registration
     if (gKindMap[kind] != nil ) {
@@ -530,6 +872,20 @@ static NSMutableDictionary *gKindMap = nil;
                 defaultClass:(Class)defaultClass
                   surrogates:(NSDictionary *)surrogates
                batchClassMap:(NSDictionary *)batchClassMap {
+  return [self objectForJSON:json
+                defaultClass:defaultClass
+                  surrogates:surrogates
+               batchClassMap:batchClassMap
+                   operation:nil];
+}
+
++ (GTLObject *)objectForJSON:(NSMutableDictionary *)json
+                defaultClass:(Class)defaultClass
+                  surrogates:(NSDictionary *)surrogates
+               batchClassMap:(NSDictionary *)batchClassMap
+                   operation:(NSOperation *)operation {
+  if (operation.isCancelled) return nil;
+
   if ([json isEqual:[NSNull null]] || json.count == 0) {
     if (json != nil && defaultClass != Nil) {
       // The JSON included an empty dictionary, and a return class
@@ -588,7 +944,13 @@ static NSMutableDictionary *gKindMap = nil;
   if ([parsedObject conformsToProtocol:@protocol(GTLBatchItemCreationProtocol)]) {
     id <GTLBatchItemCreationProtocol> batch =
       (id <GTLBatchItemCreationProtocol>) parsedObject;
-    [batch createItemsWithClassMap:batchClassMap];
+    if ([batch respondsToSelector:@selector(createItemsWithClassMap:operation:)]) {
+      [batch createItemsWithClassMap:batchClassMap
+                           operation:operation];
+    } else {
+      [batch createItemsWithClassMap:batchClassMap];
+    }
+    if (operation.isCancelled) return nil;
   }
 
   return parsedObject;
@@ -707,13 +1069,13 @@ static NSMutableDictionary *gArrayPropertyToClassMapCache = nil;
 
 - (NSArray *)itemsWithItemClass:(Class)itemClass {
   // Return the cached array before creating on demand.
-  NSString *cacheKey = @"result_array_items";
+  NSString *cacheKey = kResultArrayItemsCacheKey;
   NSMutableArray *cachedArray = [self cacheChildForKey:cacheKey];
   if (cachedArray != nil) {
     return cachedArray;
   }
   NSArray *result = nil;
-  NSArray *array = (NSArray *)self.JSON;
+  NSArray *array = (NSArray *)[self childJSON];
   if (array != nil) {
     if ([array isKindOfClass:[NSArray class]]) {
       NSDictionary *surrogates = self.surrogates;
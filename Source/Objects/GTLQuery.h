@@ -30,6 +30,8 @@
 @property (NS_NONATOMIC_IOSONLY, copy) NSDictionary<NSString *,NSString *> *additionalHTTPHeaders;
 @property (NS_NONATOMIC_IOSONLY, copy) NSDictionary<NSString *,NSString *> *urlQueryParameters;
 @property (NS_NONATOMIC_IOSONLY, readonly, copy) GTLUploadParameters *uploadParameters;
+@property (NS_NONATOMIC_IOSONLY, copy) NSString *fetcherServiceClient;
+@property (NS_NONATOMIC_IOSONLY) NSInteger fetcherServicePriority;
 @end
 
 @protocol GTLQueryCollectionProtocol
@@ -61,6 +63,9 @@ typedef void (^GTLQueryTestBlock)(GTLServiceTicket *testTicket, GTLQueryTestResp
   NSString *methodName_;
   NSMutableDictionary *json_;
   GTLObject *bodyObject_;
+  id *childSlots_;
+  NSUInteger childSlotCount_;  // set when childSlots_ is allocated
+  NSDictionary *childSlotMap_;
   NSMutableDictionary *childCache_;
   NSString *requestID_;
   GTLUploadParameters *uploadParameters_;
@@ -68,6 +73,9 @@ typedef void (^GTLQueryTestBlock)(GTLServiceTicket *testTicket, GTLQueryTestResp
   NSDictionary *additionalHTTPHeaders_;
   Class expectedObjectClass_;
   BOOL skipAuthorization_;
+  BOOL canShareFetch_;
+  NSString *fetcherServiceClient_;
+  NSInteger fetcherServicePriority_;
   void (^completionBlock_)(GTLServiceTicket *ticket, id object, NSError *error);
   GTLQueryTestBlock testBlock_;
 }
@@ -108,6 +116,20 @@ typedef void (^GTLQueryTestBlock)(GTLServiceTicket *testTicket, GTLQueryTestResp
 // Clients may set this to YES to disallow authorization. Defaults to NO.
 @property (NS_NONATOMIC_IOSONLY) BOOL shouldSkipAuthorization;
 
+// Clients may set this to YES for a query without side effects, such as a get
+// or list, so that a service sharing identical queries may let it wait for
+// the result of an identical query already being fetched.  JSON-RPC queries
+// are all posts, so the request can't tell the library this.  Defaults to NO.
+@property (NS_NONATOMIC_IOSONLY) BOOL canShareFetch;
+
+// The client and priority given to the query's fetcher, in place of the
+// ticket's, for sharing hosts in the fetcher service; see the serviceClient
+// and servicePriority properties of GTMHTTPFetcher.  A nil client or a zero
+// priority leaves the ticket's value.  Not valid when this query is added to
+// a batch.
+@property (NS_NONATOMIC_IOSONLY, copy) NSString *fetcherServiceClient;
+@property (NS_NONATOMIC_IOSONLY) NSInteger fetcherServicePriority;
+
 // Clients may provide an optional callback block to be called immediately
 // before the executeQuery: callback.
 //
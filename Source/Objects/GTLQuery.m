@@ -45,6 +45,9 @@
             additionalHTTPHeaders = additionalHTTPHeaders_,
             expectedObjectClass = expectedObjectClass_,
             shouldSkipAuthorization = skipAuthorization_,
+            canShareFetch = canShareFetch_,
+            fetcherServiceClient = fetcherServiceClient_,
+            fetcherServicePriority = fetcherServicePriority_,
             completionBlock = completionBlock_,
             testBlock = testBlock_;
 
@@ -74,11 +77,13 @@
   [methodName_ release];
   [json_ release];
   [bodyObject_ release];
+  GTLReleaseChildSlots(childSlots_, childSlotCount_);
   [childCache_ release];
   [requestID_ release];
   [uploadParameters_ release];
   [urlQueryParameters_ release];
   [additionalHTTPHeaders_ release];
+  [fetcherServiceClient_ release];
   [completionBlock_ release];
   [testBlock_ release];
 
@@ -104,6 +109,9 @@
   query -> additionalHTTPHeaders_ = [self -> additionalHTTPHeaders_ copy];
   query -> expectedObjectClass_ = [self -> expectedObjectClass_ copy];
   query -> skipAuthorization_ = self -> skipAuthorization_;
+  query -> canShareFetch_ = self -> canShareFetch_;
+  query -> fetcherServiceClient_ = [self -> fetcherServiceClient_ copy];
+  query -> fetcherServicePriority_ = self -> fetcherServicePriority_;
   query -> completionBlock_ = [self -> completionBlock_ copy];
   query -> testBlock_ = [self -> testBlock_ copy];
   return query;
@@ -184,10 +192,41 @@
   return obj;
 }
 
+- (id)childJSONValueForKey:(NSString *)key {
+  // Query copies don't share their JSON.
+  return [self JSONValueForKey:key];
+}
+
 // There is no property for childCache_ as there shouldn't be KVC/KVO
-// support for it, it's an implementation detail.
+// support for it, it's an implementation detail.  As with GTLObject, the
+// children of the class's properties are kept in slots.
 
-- (void)setCacheChild:(id)obj forKey:(NSString *)key {
+- (NSDictionary *)childSlotMap {
+  if (childSlotMap_ == nil) {
+    childSlotMap_ = [GTLRuntimeCommon childCacheSlotMapForClass:[self class]];
+  }
+  return childSlotMap_;
+}
+
+- (void)setCacheChild:(id)obj atSlot:(NSUInteger)slot forKey:(NSString *)key {
+  NSDictionary *slotMap = (childSlots_ == NULL ? [self childSlotMap] : nil);
+  if (!GTLSetChildInSlot(&childSlots_, &childSlotCount_, slotMap, slot, obj)) {
+    // The slot doesn't belong to this class's map, so keep the child by key.
+    GTL_DEBUG_LOG(@"GTLQuery: slot %lu out of range for %@",
+                  (unsigned long)slot, [self class]);
+    [self setKeyedCacheChild:obj forKey:key];
+  }
+}
+
+- (id)cacheChildAtSlot:(NSUInteger)slot forKey:(NSString *)key {
+  // Until the slots are allocated, no child is in them.
+  if (slot < childSlotCount_) {
+    return childSlots_[slot];
+  }
+  return childCache_[key];
+}
+
+- (void)setKeyedCacheChild:(id)obj forKey:(NSString *)key {
   if (childCache_ == nil && obj != nil) {
     childCache_ =
       [[NSMutableDictionary alloc] initWithObjectsAndKeys:obj, key, nil];
@@ -196,7 +235,20 @@
   }
 }
 
+- (void)setCacheChild:(id)obj forKey:(NSString *)key {
+  NSNumber *slot = [self childSlotMap][key];
+  if (slot != nil) {
+    [self setCacheChild:obj atSlot:slot.unsignedIntegerValue forKey:key];
+    return;
+  }
+  [self setKeyedCacheChild:obj forKey:key];
+}
+
 - (id)cacheChildForKey:(NSString *)key {
+  NSNumber *slot = [self childSlotMap][key];
+  if (slot != nil) {
+    return [self cacheChildAtSlot:slot.unsignedIntegerValue forKey:key];
+  }
   id obj = childCache_[key];
   return obj;
 }
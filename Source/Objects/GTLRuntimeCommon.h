@@ -30,9 +30,17 @@
 // Get/Set properties
 - (void)setJSONValue:(id)obj forKey:(NSString *)key;
 - (id)JSONValueForKey:(NSString *)key;
+// The JSON value to create a child object from; GTLObject copies nested JSON
+// shared with other copies of the object before handing it out.
+- (id)childJSONValueForKey:(NSString *)key;
 // Child cache
 - (void)setCacheChild:(id)obj forKey:(NSString *)key;
 - (id)cacheChildForKey:(NSString *)key;
+// Child cache slots, numbered by childCacheSlotMapForClass:; the same
+// storage as the keyed methods use for the slot's JSON key.  A slot outside
+// the class's slot map is cached under the key instead.
+- (void)setCacheChild:(id)obj atSlot:(NSUInteger)slot forKey:(NSString *)key;
+- (id)cacheChildAtSlot:(NSUInteger)slot forKey:(NSString *)key;
 // Surrogate class mappings.
 @property (NS_NONATOMIC_IOSONLY, readonly, copy) NSDictionary *surrogates;
 // Key map
@@ -46,6 +54,16 @@
 @interface GTLRuntimeCommon : NSObject
 // Wire things up.
 + (BOOL)resolveInstanceMethod:(SEL)sel onClass:(Class)onClass;
+// Wire up all the dynamic properties declared by the class (but not by its
+// superclasses) in one pass, rather than as each is first used.  Returns the
+// number of methods added.
++ (NSUInteger)installDynamicMethodsForClass:(Class<GTLRuntimeCommon>)aClass;
+// The children created for the object-valued dynamic properties (dates,
+// objects, arrays, and anything) are cached in slots rather than by JSON key.
+// A class numbers the JSON keys of its own properties after those of its
+// superclass, so a slot holds the same key in the subclasses.  Returns the map
+// of JSON keys to slot numbers (NSNumbers); there are as many slots as keys.
++ (NSDictionary *)childCacheSlotMapForClass:(Class<GTLRuntimeCommon>)aClass;
 // Helpers
 + (id)objectFromJSON:(id)json
         defaultClass:(Class)defaultClass
@@ -54,4 +72,39 @@
 + (id)jsonFromAPIObject:(id)obj
           expectedClass:(Class)expectedClass
             isCacheable:(BOOL*)isCacheable;
+// Accessor bodies for the object-valued properties; used by the dynamic
+// properties and by classes that implement their property methods directly.
++ (id)dateTimeForJSONKey:(NSString *)jsonKey
+                ofObject:(id<GTLRuntimeCommon>)obj;
++ (void)setDateTime:(id)val
+         forJSONKey:(NSString *)jsonKey
+           ofObject:(id<GTLRuntimeCommon>)obj;
++ (id)objectForJSONKey:(NSString *)jsonKey
+          defaultClass:(Class)defaultClass
+              ofObject:(id<GTLRuntimeCommon>)obj;
++ (void)setObject:(id)val
+       forJSONKey:(NSString *)jsonKey
+         ofObject:(id<GTLRuntimeCommon>)obj;
++ (id)arrayForJSONKey:(NSString *)jsonKey
+       containedClass:(Class)containedClass
+             ofObject:(id<GTLRuntimeCommon>)obj;
++ (void)setArray:(NSArray *)val
+      forJSONKey:(NSString *)jsonKey
+  containedClass:(Class)containedClass
+        ofObject:(id<GTLRuntimeCommon>)obj;
++ (id)anyObjectForJSONKey:(NSString *)jsonKey
+                 ofObject:(id<GTLRuntimeCommon>)obj;
++ (void)setAnyObject:(id)val
+          forJSONKey:(NSString *)jsonKey
+            ofObject:(id<GTLRuntimeCommon>)obj;
 @end
+
+// Storage for the child cache slots of GTLObject and GTLQuery.  The slots
+// are allocated with the first child stored in them, sized by the class's
+// slot map, which is needed only until then; the slot count is set along with
+// them, so a slot can be checked against it without consulting the map.
+// Returns NO, storing nothing, for a slot outside the slot map; the child
+// then belongs in the keyed cache.
+BOOL GTLSetChildInSlot(id **slots, NSUInteger *slotCount,
+                       NSDictionary *slotMap, NSUInteger slot, id obj);
+void GTLReleaseChildSlots(id *slots, NSUInteger slotCount);
@@ -25,6 +25,7 @@
 #import "GTLDateTime.h"
 #import "GTLObject.h"
 #import "GTLUtilities.h"
+#import "GTLJSONParser.h"
 
 // Note: NSObject's class is used as a marker for the expected/default class
 // when Discovery says it can be any type of object.
@@ -153,8 +154,255 @@
   return result;
 }
 
+#pragma mark Property accessors
+
+// The bodies of the object-valued property accessors.  The IMPs built for
+// the dynamic properties call these with the property's child cache slot, as
+// do classes that implement their property methods directly (with NSNotFound,
+// so the child is cached by key), so both behave identically.
+
+static id CachedChild(id<GTLRuntimeCommon> obj, NSString *jsonKey,
+                      NSUInteger slot) {
+  if (slot != NSNotFound) {
+    return [obj cacheChildAtSlot:slot forKey:jsonKey];
+  }
+  return [obj cacheChildForKey:jsonKey];
+}
+
+static void SetCachedChild(id<GTLRuntimeCommon> obj, id child,
+                           NSString *jsonKey, NSUInteger slot) {
+  if (slot != NSNotFound) {
+    [obj setCacheChild:child atSlot:slot forKey:jsonKey];
+  } else {
+    [obj setCacheChild:child forKey:jsonKey];
+  }
+}
+
+static id DateTimeForJSONKey(id<GTLRuntimeCommon> obj, NSString *jsonKey,
+                             NSUInteger slot) {
+  // Return the cached object before creating on demand.
+  GTLDateTime *cachedDateTime = CachedChild(obj, jsonKey, slot);
+  if (cachedDateTime != nil) {
+    return cachedDateTime;
+  }
+  NSString *str = [obj JSONValueForKey:jsonKey];
+  id cacheValue, resultValue;
+  if (![str isKindOfClass:[NSNull class]]) {
+    GTLDateTime *dateTime = [GTLDateTime dateTimeWithRFC3339String:str];
+
+    cacheValue = dateTime;
+    resultValue = dateTime;
+  } else {
+    cacheValue = nil;
+    resultValue = [NSNull null];
+  }
+  SetCachedChild(obj, cacheValue, jsonKey, slot);
+  return resultValue;
+}
+
+static void SetDateTime(id<GTLRuntimeCommon> obj, id val, NSString *jsonKey,
+                        NSUInteger slot) {
+  id cacheValue, jsonValue;
+  if (![val isKindOfClass:[NSNull class]]) {
+    jsonValue = [(GTLDateTime *)val stringValue];
+    cacheValue = val;
+  } else {
+    jsonValue = [NSNull null];
+    cacheValue = nil;
+  }
+
+  [obj setJSONValue:jsonValue forKey:jsonKey];
+  SetCachedChild(obj, cacheValue, jsonKey, slot);
+}
+
+static id ObjectForJSONKey(id<GTLRuntimeCommon> obj, NSString *jsonKey,
+                           NSUInteger slot, Class defaultClass) {
+  // Return the cached object before creating on demand.
+  GTLObject *cachedObj = CachedChild(obj, jsonKey, slot);
+  if (cachedObj != nil) {
+    return cachedObj;
+  }
+  NSMutableDictionary *dict = [obj childJSONValueForKey:jsonKey];
+  if ([dict isKindOfClass:[NSMutableDictionary class]]) {
+    if (defaultClass == Nil) {
+      defaultClass = [GTLObject class];
+    }
+    NSDictionary *surrogates = obj.surrogates;
+    GTLObject *subObj = [GTLObject objectForJSON:dict
+                                    defaultClass:defaultClass
+                                      surrogates:surrogates
+                                   batchClassMap:nil];
+    SetCachedChild(obj, subObj, jsonKey, slot);
+    return subObj;
+  } else if ([dict isKindOfClass:[NSNull class]]) {
+    SetCachedChild(obj, nil, jsonKey, slot);
+    return [NSNull null];
+  } else if (dict != nil) {
+    // unexpected; probably got a string -- let the caller figure it out
+    GTL_DEBUG_LOG(@"GTLObject: unexpected JSON: %@.%@ should be a dictionary, actually is a %@:\n%@",
+                  NSStringFromClass([obj class]), jsonKey,
+                  NSStringFromClass([dict class]), dict);
+    return dict;
+  }
+  return nil;
+}
+
+static void SetObject(id<GTLRuntimeCommon> obj, id val, NSString *jsonKey,
+                      NSUInteger slot) {
+  id cacheValue, jsonValue;
+  if (![val isKindOfClass:[NSNull class]]) {
+    NSMutableDictionary *dict = [val JSON];
+    if (dict == nil && val != nil) {
+      // adding an empty object; it should have a JSON dictionary so it
+      // can hold future assignments
+      [val setJSON:[NSMutableDictionary dictionary]];
+      jsonValue = [val JSON];
+    } else {
+      jsonValue = dict;
+    }
+    cacheValue = val;
+  } else {
+    jsonValue = [NSNull null];
+    cacheValue = nil;
+  }
+  [obj setJSONValue:jsonValue forKey:jsonKey];
+  SetCachedChild(obj, cacheValue, jsonKey, slot);
+}
+
+static id ArrayForJSONKey(id<GTLRuntimeCommon> obj, NSString *jsonKey,
+                          NSUInteger slot, Class containedClass) {
+  // Return the cached array before creating on demand.
+  NSMutableArray *cachedArray = CachedChild(obj, jsonKey, slot);
+  if (cachedArray != nil) {
+    return cachedArray;
+  }
+  NSMutableArray *result = nil;
+  NSArray *array = [obj childJSONValueForKey:jsonKey];
+  if (array != nil) {
+    if ([array isKindOfClass:[NSArray class]]) {
+      NSDictionary *surrogates = obj.surrogates;
+      result = [GTLRuntimeCommon objectFromJSON:array
+                                   defaultClass:containedClass
+                                     surrogates:surrogates
+                                    isCacheable:NULL];
+    } else {
+#if DEBUG
+      if (![array isKindOfClass:[NSNull class]]) {
+        GTL_DEBUG_LOG(@"GTLObject: unexpected JSON: %@.%@ should be an array, actually is a %@:\n%@",
+                      NSStringFromClass([obj class]), jsonKey,
+                      NSStringFromClass([array class]), array);
+      }
+#endif
+      result = (NSMutableArray *)array;
+    }
+  }
+  SetCachedChild(obj, result, jsonKey, slot);
+  return result;
+}
+
+static void SetArray(id<GTLRuntimeCommon> obj, NSArray *val, NSString *jsonKey,
+                     NSUInteger slot, Class containedClass) {
+  id json = [GTLRuntimeCommon jsonFromAPIObject:val
+                                  expectedClass:containedClass
+                                    isCacheable:NULL];
+  [obj setJSONValue:json forKey:jsonKey];
+  SetCachedChild(obj, val, jsonKey, slot);
+}
+
+static id AnyObjectForJSONKey(id<GTLRuntimeCommon> obj, NSString *jsonKey,
+                              NSUInteger slot) {
+  // Return the cached object before creating on demand.
+  id cachedObj = CachedChild(obj, jsonKey, slot);
+  if (cachedObj != nil) {
+    return cachedObj;
+  }
+  id jsonObj = [obj childJSONValueForKey:jsonKey];
+  if (jsonObj != nil) {
+    BOOL shouldCache = NO;
+    NSDictionary *surrogates = obj.surrogates;
+    id result = [GTLRuntimeCommon objectFromJSON:jsonObj
+                                    defaultClass:nil
+                                      surrogates:surrogates
+                                     isCacheable:&shouldCache];
+
+    SetCachedChild(obj, (shouldCache ? result : nil), jsonKey, slot);
+    return result;
+  }
+  return nil;
+}
+
+static void SetAnyObject(id<GTLRuntimeCommon> obj, id val, NSString *jsonKey,
+                         NSUInteger slot) {
+  BOOL shouldCache = NO;
+  id json = [GTLRuntimeCommon jsonFromAPIObject:val
+                                  expectedClass:Nil
+                                    isCacheable:&shouldCache];
+  [obj setJSONValue:json forKey:jsonKey];
+  SetCachedChild(obj, (shouldCache ? val : nil), jsonKey, slot);
+}
+
++ (id)dateTimeForJSONKey:(NSString *)jsonKey
+                ofObject:(id<GTLRuntimeCommon>)obj {
+  return DateTimeForJSONKey(obj, jsonKey, NSNotFound);
+}
+
++ (void)setDateTime:(id)val
+         forJSONKey:(NSString *)jsonKey
+           ofObject:(id<GTLRuntimeCommon>)obj {
+  SetDateTime(obj, val, jsonKey, NSNotFound);
+}
+
++ (id)objectForJSONKey:(NSString *)jsonKey
+          defaultClass:(Class)defaultClass
+              ofObject:(id<GTLRuntimeCommon>)obj {
+  return ObjectForJSONKey(obj, jsonKey, NSNotFound, defaultClass);
+}
+
++ (void)setObject:(id)val
+       forJSONKey:(NSString *)jsonKey
+         ofObject:(id<GTLRuntimeCommon>)obj {
+  SetObject(obj, val, jsonKey, NSNotFound);
+}
+
++ (id)arrayForJSONKey:(NSString *)jsonKey
+       containedClass:(Class)containedClass
+             ofObject:(id<GTLRuntimeCommon>)obj {
+  return ArrayForJSONKey(obj, jsonKey, NSNotFound, containedClass);
+}
+
++ (void)setArray:(NSArray *)val
+      forJSONKey:(NSString *)jsonKey
+  containedClass:(Class)containedClass
+        ofObject:(id<GTLRuntimeCommon>)obj {
+  SetArray(obj, val, jsonKey, NSNotFound, containedClass);
+}
+
++ (id)anyObjectForJSONKey:(NSString *)jsonKey
+                 ofObject:(id<GTLRuntimeCommon>)obj {
+  return AnyObjectForJSONKey(obj, jsonKey, NSNotFound);
+}
+
++ (void)setAnyObject:(id)val
+          forJSONKey:(NSString *)jsonKey
+            ofObject:(id<GTLRuntimeCommon>)obj {
+  SetAnyObject(obj, val, jsonKey, NSNotFound);
+}
+
 #pragma mark Runtime lookup support
 
+// Checks for a single-letter attribute like D (dynamic) or R (readonly) in
+// property attributes; the attributes always start with the T type attribute,
+// so later ones are preceded by a comma.
+static BOOL HasPropertyAttribute(const char *propAttrs, char attribute) {
+  const char marker[3] = { ',', attribute, 0 };
+  const char *found = strstr(propAttrs, marker);
+  while (found) {
+    if (found[2] == 0 || found[2] == ',') return YES;
+    found = strstr(found + 2, marker);
+  }
+  return NO;
+}
+
 static objc_property_t PropertyForSel(Class<GTLRuntimeCommon> startClass,
                                       SEL sel, BOOL isSetter,
                                       Class<GTLRuntimeCommon> *outFoundClass) {
@@ -177,9 +425,7 @@ static objc_property_t PropertyForSel(Class<GTLRuntimeCommon> startClass,
     if (properties) {
       for (objc_property_t *prop = properties; *prop != NULL; ++prop) {
         const char *propAttrs = property_getAttributes(*prop);
-        const char *dynamicMarker = strstr(propAttrs, ",D");
-        if (!dynamicMarker ||
-            (dynamicMarker[2] != 0 && dynamicMarker[2] != ',' )) {
+        if (!HasPropertyAttribute(propAttrs, 'D')) {
           // It isn't dynamic, skip it.
           continue;
         }
@@ -498,6 +744,7 @@ static const GTLDynamicImpInfo *DynamicImpInfoForProperty(objc_property_t prop,
 static IMP GTLRuntimeGetterIMP(SEL sel,
                                GTLPropertyType propertyType,
                                NSString *jsonKey,
+                               NSUInteger slot,
                                Class containedClass,
                                Class returnClass) {
   // Only used in DEBUG logging.
@@ -580,24 +827,7 @@ static IMP GTLRuntimeGetterIMP(SEL sel,
 
     case GTLPropertyTypeGTLDateTime:
       resultIMP = imp_implementationWithBlock(^GTLDateTime *(GTLObject<GTLRuntimeCommon> *obj) {
-        // Return the cached object before creating on demand.
-        GTLDateTime *cachedDateTime = [obj cacheChildForKey:jsonKey];
-        if (cachedDateTime != nil) {
-          return cachedDateTime;
-        }
-        NSString *str = [obj JSONValueForKey:jsonKey];
-        id cacheValue, resultValue;
-        if (![str isKindOfClass:[NSNull class]]) {
-          GTLDateTime *dateTime = [GTLDateTime dateTimeWithRFC3339String:str];
-
-          cacheValue = dateTime;
-          resultValue = dateTime;
-        } else {
-          cacheValue = nil;
-          resultValue = [NSNull null];
-        }
-        [obj setCacheChild:cacheValue forKey:jsonKey];
-        return resultValue;
+        return DateTimeForJSONKey(obj, jsonKey, slot);
       });
       break;
 
@@ -615,89 +845,19 @@ static IMP GTLRuntimeGetterIMP(SEL sel,
         returnClass = [GTLObject class];
       }
       resultIMP = imp_implementationWithBlock(^GTLObject *(GTLObject<GTLRuntimeCommon> *obj) {
-        // Return the cached object before creating on demand.
-        GTLObject *cachedObj = [obj cacheChildForKey:jsonKey];
-        if (cachedObj != nil) {
-          return cachedObj;
-        }
-        NSMutableDictionary *dict = [obj JSONValueForKey:jsonKey];
-        if ([dict isKindOfClass:[NSMutableDictionary class]]) {
-          NSDictionary *surrogates = obj.surrogates;
-          GTLObject *subObj = [GTLObject objectForJSON:dict
-                                          defaultClass:returnClass
-                                            surrogates:surrogates
-                                         batchClassMap:nil];
-          [obj setCacheChild:subObj forKey:jsonKey];
-          return subObj;
-        } else if ([dict isKindOfClass:[NSNull class]]) {
-          [obj setCacheChild:nil forKey:jsonKey];
-          return (GTLObject*)[NSNull null];
-        } else if (dict != nil) {
-          // unexpected; probably got a string -- let the caller figure it out
-          GTL_DEBUG_LOG(@"GTLObject: unexpected JSON: %@.%@ should be a dictionary, actually is a %@:\n%@",
-                        NSStringFromClass([obj class]),
-                        NSStringFromSelector(sel),
-                        NSStringFromClass([dict class]), dict);
-          return (GTLObject *)dict;
-        }
-        return nil;
+        return ObjectForJSONKey(obj, jsonKey, slot, returnClass);
       });
       break;
 
     case GTLPropertyTypeNSArray:
       resultIMP = imp_implementationWithBlock(^(GTLObject<GTLRuntimeCommon> *obj) {
-        // Return the cached array before creating on demand.
-        NSMutableArray *cachedArray = [obj cacheChildForKey:jsonKey];
-        if (cachedArray != nil) {
-          return cachedArray;
-        }
-        NSMutableArray *result = nil;
-        NSArray *array = [obj JSONValueForKey:jsonKey];
-        if (array != nil) {
-          if ([array isKindOfClass:[NSArray class]]) {
-            NSDictionary *surrogates = obj.surrogates;
-            result = [GTLRuntimeCommon objectFromJSON:array
-                                         defaultClass:containedClass
-                                           surrogates:surrogates
-                                          isCacheable:NULL];
-          } else {
-#if DEBUG
-            if (![array isKindOfClass:[NSNull class]]) {
-              GTL_DEBUG_LOG(@"GTLObject: unexpected JSON: %@.%@ should be an array, actually is a %@:\n%@",
-                            NSStringFromClass([obj class]),
-                            NSStringFromSelector(sel),
-                            NSStringFromClass([array class]), array);
-            }
-#endif
-            result = (NSMutableArray *)array;
-          }
-        }
-        [obj setCacheChild:result forKey:jsonKey];
-        return result;
+        return ArrayForJSONKey(obj, jsonKey, slot, containedClass);
       });
       break;
 
     case GTLPropertyTypeNSObject:
       resultIMP = imp_implementationWithBlock(^id(GTLObject<GTLRuntimeCommon> *obj) {
-        // Return the cached object before creating on demand.
-        id cachedObj = [obj cacheChildForKey:jsonKey];
-        if (cachedObj != nil) {
-          return cachedObj;
-        }
-        id jsonObj = [obj JSONValueForKey:jsonKey];
-        if (jsonObj != nil) {
-          BOOL shouldCache = NO;
-          NSDictionary *surrogates = obj.surrogates;
-          id result = [GTLRuntimeCommon objectFromJSON:jsonObj
-                                          defaultClass:nil
-                                            surrogates:surrogates
-                                           isCacheable:&shouldCache];
-
-          [obj setCacheChild:(shouldCache ? result : nil)
-                      forKey:jsonKey];
-          return result;
-        }
-        return nil;
+        return AnyObjectForJSONKey(obj, jsonKey, slot);
       });
       break;
 
@@ -714,6 +874,7 @@ static IMP GTLRuntimeGetterIMP(SEL sel,
 static IMP GTLRuntimeSetterIMP(SEL sel,
                                GTLPropertyType propertyType,
                                NSString *jsonKey,
+                               NSUInteger slot,
                                Class containedClass,
                                Class returnClass) {
 #pragma unused(sel, returnClass)
@@ -776,17 +937,7 @@ static IMP GTLRuntimeSetterIMP(SEL sel,
     case GTLPropertyTypeGTLDateTime:
       resultIMP = imp_implementationWithBlock(^(GTLObject<GTLRuntimeCommon> *obj,
                                                 GTLDateTime *val) {
-        id cacheValue, jsonValue;
-        if (![val isKindOfClass:[NSNull class]]) {
-          jsonValue = val.stringValue;
-          cacheValue = val;
-        } else {
-          jsonValue = [NSNull null];
-          cacheValue = nil;
-        }
-
-        [obj setJSONValue:jsonValue forKey:jsonKey];
-        [obj setCacheChild:cacheValue forKey:jsonKey];
+        SetDateTime(obj, val, jsonKey, slot);
       });
       break;
 
@@ -799,48 +950,21 @@ static IMP GTLRuntimeSetterIMP(SEL sel,
     case GTLPropertyTypeGTLObject:
       resultIMP = imp_implementationWithBlock(^(GTLObject<GTLRuntimeCommon> *obj,
                                                 GTLObject *val) {
-        id cacheValue, jsonValue;
-        if (![val isKindOfClass:[NSNull class]]) {
-          NSMutableDictionary *dict = val.JSON;
-          if (dict == nil && val != nil) {
-            // adding an empty object; it should have a JSON dictionary so it
-            // can hold future assignments
-            val.JSON = [NSMutableDictionary dictionary];
-            jsonValue = val.JSON;
-          } else {
-            jsonValue = dict;
-          }
-          cacheValue = val;
-        } else {
-          jsonValue = [NSNull null];
-          cacheValue = nil;
-        }
-        [obj setJSONValue:jsonValue forKey:jsonKey];
-        [obj setCacheChild:cacheValue forKey:jsonKey];
+        SetObject(obj, val, jsonKey, slot);
       });
       break;
 
     case GTLPropertyTypeNSArray:
       resultIMP = imp_implementationWithBlock(^(GTLObject<GTLRuntimeCommon> *obj,
                                                 NSMutableArray *val) {
-        id json = [GTLRuntimeCommon jsonFromAPIObject:val
-                                        expectedClass:containedClass
-                                          isCacheable:NULL];
-        [obj setJSONValue:json forKey:jsonKey];
-        [obj setCacheChild:val forKey:jsonKey];
+        SetArray(obj, val, jsonKey, slot, containedClass);
       });
       break;
 
     case GTLPropertyTypeNSObject:
       resultIMP = imp_implementationWithBlock(^(GTLObject<GTLRuntimeCommon> *obj,
                                                 id val) {
-        BOOL shouldCache = NO;
-        id json = [GTLRuntimeCommon jsonFromAPIObject:val
-                                        expectedClass:Nil
-                                          isCacheable:&shouldCache];
-        [obj setJSONValue:json forKey:jsonKey];
-        [obj setCacheChild:(shouldCache ? val : nil)
-                     forKey:jsonKey];
+        SetAnyObject(obj, val, jsonKey, slot);
       });
       break;
 
@@ -849,8 +973,74 @@ static IMP GTLRuntimeSetterIMP(SEL sel,
   return resultIMP;
 }
 
+#pragma mark Child cache slots
+
+// Properties of these types are created from their JSON and the results
+// cached; strings and numbers are used from the JSON directly.
+static BOOL IsCachedPropertyType(const char *propAttrs) {
+  return (strncmp(propAttrs, "T@", 2) == 0
+          && strncmp(propAttrs, "T@\"NSString\"", 12) != 0
+          && strncmp(propAttrs, "T@\"NSNumber\"", 12) != 0);
+}
+
++ (NSDictionary *)childCacheSlotMapForClass:(Class<GTLRuntimeCommon>)aClass {
+  static NSMutableDictionary *gSlotMapCache = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    gSlotMapCache = [[NSMutableDictionary alloc] init];
+  });
+
+  NSDictionary *result;
+  @synchronized(gSlotMapCache) {
+    result = gSlotMapCache[aClass];
+    if (result == nil) {
+      // Start with the superclass's slots so the slots of inherited
+      // properties don't move.
+      Class<GTLRuntimeCommon> ancestorClass = [aClass ancestorClass];
+      NSMutableDictionary *slotMap;
+      if ([aClass isEqual:ancestorClass]) {
+        slotMap = [NSMutableDictionary dictionary];
+      } else {
+        NSDictionary *superMap =
+          [self childCacheSlotMapForClass:class_getSuperclass(aClass)];
+        slotMap = [NSMutableDictionary dictionaryWithDictionary:superMap];
+      }
+
+      NSDictionary *keyMap = [ancestorClass propertyToJSONKeyMapForClass:aClass];
+      objc_property_t *properties = class_copyPropertyList(aClass, NULL);
+      if (properties) {
+        for (objc_property_t *prop = properties; *prop != NULL; ++prop) {
+          const char *propAttrs = property_getAttributes(*prop);
+          if (!HasPropertyAttribute(propAttrs, 'D')
+              || !IsCachedPropertyType(propAttrs)) {
+            continue;
+          }
+          NSString *propName = @(property_getName(*prop));
+          NSString *jsonKey = keyMap[propName];
+          if (jsonKey == nil) {
+            jsonKey = propName;
+          }
+          jsonKey = [GTLJSONParser internedString:jsonKey];
+          if (slotMap[jsonKey] == nil) {
+            slotMap[jsonKey] = @(slotMap.count);
+          }
+        }
+        free(properties);
+      }
+
+      result = [NSDictionary dictionaryWithDictionary:slotMap];
+      gSlotMapCache[(id<NSCopying>)aClass] = result;
+    }
+  }
+  return result;
+}
+
 #pragma mark Runtime - wiring point
 
+static BOOL AddMethodForProperty(objc_property_t prop,
+                                 Class<GTLRuntimeCommon> foundClass,
+                                 SEL sel, BOOL isSetter);
+
 + (BOOL)resolveInstanceMethod:(SEL)sel onClass:(Class<GTLRuntimeCommon>)onClass {
   // dynamic method resolution:
   // http://developer.apple.com/library/ios/#documentation/Cocoa/Conceptual/ObjCRuntimeGuide/Articles/ocrtDynamicResolution.html
@@ -871,6 +1061,67 @@ static IMP GTLRuntimeSetterIMP(SEL sel,
     return NO;  // No luck, out of here.
   }
 
+  return AddMethodForProperty(prop, foundClass, sel, isSetter);
+}
+
++ (NSUInteger)installDynamicMethodsForClass:(Class<GTLRuntimeCommon>)aClass {
+  // Find the methods already on the class, so we only build the IMPs needed.
+  unsigned int methodCount = 0;
+  Method *methods = class_copyMethodList(aClass, &methodCount);
+  NSMutableSet *existingSelNames = [NSMutableSet setWithCapacity:methodCount];
+  for (unsigned int idx = 0; idx < methodCount; idx++) {
+    [existingSelNames addObject:NSStringFromSelector(method_getName(methods[idx]))];
+  }
+  free(methods);
+
+  NSUInteger numberAdded = 0;
+  objc_property_t *properties = class_copyPropertyList(aClass, NULL);
+  if (properties) {
+    for (objc_property_t *prop = properties; *prop != NULL; ++prop) {
+      const char *propAttrs = property_getAttributes(*prop);
+      if (!HasPropertyAttribute(propAttrs, 'D')) continue;
+
+      NSString *propName = @(property_getName(*prop));
+
+      // The getter may be renamed with getter=, as for properties beginning
+      // with "init".
+      NSString *getterName = propName;
+      const char *getterMarker = strstr(propAttrs, ",G");
+      if (getterMarker) {
+        const char *getterStart = getterMarker + 2;
+        size_t getterLen = strcspn(getterStart, ",");
+        getterName = [[[NSString alloc] initWithBytes:getterStart
+                                               length:getterLen
+                                             encoding:NSUTF8StringEncoding] autorelease];
+      }
+      if (![existingSelNames containsObject:getterName]
+          && AddMethodForProperty(*prop, aClass,
+                                  NSSelectorFromString(getterName), NO)) {
+        ++numberAdded;
+      }
+
+      if (!HasPropertyAttribute(propAttrs, 'R')) {
+        NSString *setterName =
+          [NSString stringWithFormat:@"set%@%@:",
+           [[propName substringToIndex:1] uppercaseString],
+           [propName substringFromIndex:1]];
+        if (![existingSelNames containsObject:setterName]
+            && AddMethodForProperty(*prop, aClass,
+                                    NSSelectorFromString(setterName), YES)) {
+          ++numberAdded;
+        }
+      }
+    }
+    free(properties);
+  }
+  return numberAdded;
+}
+
+@end
+
+static BOOL AddMethodForProperty(objc_property_t prop,
+                                 Class<GTLRuntimeCommon> foundClass,
+                                 SEL sel, BOOL isSetter) {
   Class returnClass = nil;
   const GTLDynamicImpInfo *implInfo = DynamicImpInfoForProperty(prop,
                                                                 &returnClass);
@@ -879,7 +1130,7 @@ static IMP GTLRuntimeSetterIMP(SEL sel,
                     "property \"%s\" of class \"%s\"",
                     returnClass ? class_getName(returnClass) : "<nil>",
                     property_getName(prop),
-                    class_getName(onClass));
+                    class_getName(foundClass));
     return NO;  // Failed to find our impl info, out of here.
   }
 
@@ -898,6 +1149,9 @@ static IMP GTLRuntimeSetterIMP(SEL sel,
   if (jsonKey == nil) {
     jsonKey = propStr;
   }
+  // Parsed JSON uses the same instance for the key, so looking it up in the
+  // JSON dictionary usually finds the key by pointer.
+  jsonKey = [GTLJSONParser internedString:jsonKey];
 
   // For arrays we need to look up what the contained class is.
   Class containedClass = nil;
@@ -912,16 +1166,24 @@ static IMP GTLRuntimeSetterIMP(SEL sel,
     }
   }
 
+  // Children created for the property are cached in its slot.
+  NSUInteger slot = NSNotFound;
+  NSNumber *slotNumber =
+    [GTLRuntimeCommon childCacheSlotMapForClass:foundClass][jsonKey];
+  if (slotNumber != nil) {
+    slot = slotNumber.unsignedIntegerValue;
+  }
+
   // Wire in the method.
   IMP imp;
   const char *encoding;
   if (isSetter) {
     imp = GTLRuntimeSetterIMP(sel, implInfo->propertyType,
-                              jsonKey, containedClass, returnClass);
+                              jsonKey, slot, containedClass, returnClass);
     encoding = implInfo->setterEncoding;
   } else {
     imp = GTLRuntimeGetterIMP(sel, implInfo->propertyType,
-                              jsonKey, containedClass, returnClass);
+                              jsonKey, slot, containedClass, returnClass);
     encoding = implInfo->getterEncoding;
   }
   if (class_addMethod(foundClass, sel, imp, encoding)) {
@@ -935,4 +1197,31 @@ static IMP GTLRuntimeSetterIMP(SEL sel,
   return NO;
 }
 
-@end
+#pragma mark Child cache slot storage
+
+BOOL GTLSetChildInSlot(id **slots, NSUInteger *slotCount,
+                       NSDictionary *slotMap, NSUInteger slot, id obj) {
+  if (*slots == NULL) {
+    NSUInteger count = slotMap.count;
+    if (slot >= count) return NO;
+    if (obj == nil) return YES;
+
+    *slots = (id *)calloc(count, sizeof(id));
+    *slotCount = count;
+  } else if (slot >= *slotCount) {
+    return NO;
+  }
+  id oldObj = (*slots)[slot];
+  (*slots)[slot] = [obj retain];
+  [oldObj release];
+  return YES;
+}
+
+void GTLReleaseChildSlots(id *slots, NSUInteger slotCount) {
+  if (slots == NULL) return;
+
+  for (NSUInteger idx = 0; idx < slotCount; idx++) {
+    [slots[idx] release];
+  }
+  free(slots);
+}
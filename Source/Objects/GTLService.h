@@ -70,7 +70,8 @@
 extern NSString *__nonnull const kGTLServiceErrorDomain;
 enum {
   kGTLErrorQueryResultMissing = -3000,
-  kGTLErrorWaitTimedOut       = -3001
+  kGTLErrorWaitTimedOut       = -3001,
+  kGTLErrorQueryNotExecuted   = -3002
 };
 
 extern NSString *__nonnull const kGTLJSONRPCErrorDomain;
@@ -111,6 +112,55 @@ typedef BOOL (^GTLServiceRetryBlock)(GTLServiceTicket *__nonnull ticket,
                                      BOOL suggestedWillRetry,
                                      NSError *__nullable error);
 
+typedef void (^GTLServicePageContinuation)(BOOL shouldFetchNextPage);
+
+typedef void (^GTLServicePageBlock)(GTLServiceTicket *__nonnull ticket,
+                                    id __nonnull page,
+                                    BOOL isLastPage,
+                                    GTLServicePageContinuation __nonnull continuation);
+
+#pragma mark -
+
+//
+// Rate limiter
+//
+// A rate limiter paces the fetches of queries with token buckets, so that
+// bursts of queries are spread out to stay within an API's quota of queries
+// per second instead of being refused by the server.
+//
+// Each bucket holds up to burst tokens and refills at its rate of tokens per
+// second.  Sending a query takes a token from the bucket for the query's method
+// name and from the bucket for its host, when those are set; a batch query
+// takes a token for each query in the batch.  A query whose buckets are empty
+// is held until they have refilled, after queries held earlier.  Tokens taken
+// by queries canceled while held are not returned.
+//
+// Services using the same credentials may share a rate limiter so that they
+// share one budget.
+@interface GTLServiceRateLimiter : NSObject {
+ @private
+  NSMutableDictionary *methodBuckets_;
+  NSMutableDictionary *hostBuckets_;
+}
+
++ (nonnull instancetype)rateLimiter;
+
+// Setting a rate of zero removes the bucket.  Bursts of less than one query
+// are treated as one.
+- (void)setRate:(double)queriesPerSecond
+          burst:(NSUInteger)burst
+  forMethodName:(NSString *__nonnull)methodName GTL_NONNULL((3));
+- (void)setRate:(double)queriesPerSecond
+          burst:(NSUInteger)burst
+        forHost:(NSString *__nonnull)host GTL_NONNULL((3));
+
+// Takes a token from each bucket for the method name and host, and returns the
+// seconds until the query may be sent.
+- (NSTimeInterval)takeTokenForMethodName:(NSString *__nullable)methodName
+                                    host:(NSString *__nullable)host;
+
+@end
+
 #pragma mark -
 
 //
@@ -120,8 +170,11 @@ typedef BOOL (^GTLServiceRetryBlock)(GTLServiceTicket *__nonnull ticket,
 @interface GTLService : NSObject {
 @private
   NSOperationQueue *parseQueue_;
+  NSOperationQueue *smallResponseParseQueue_; // fast lane for small responses
   NSString *userAgent_;
   GTMBridgeFetcherService *fetcherService_;
+  NSString *fetcherServiceClient_;  // initial value for future tickets
+  NSInteger fetcherServicePriority_;
   NSString *userAgentAddition_;
   
   NSMutableDictionary *serviceProperties_; // initial values for properties in future tickets
@@ -132,6 +185,7 @@ typedef BOOL (^GTLServiceRetryBlock)(GTLServiceTicket *__nonnull ticket,
   
   GTLServiceRetryBlock retryBlock_;
   GTLServiceUploadProgressBlock uploadProgressBlock_;
+  GTLServicePageBlock pageBlock_;
   GTLQueryTestBlock testBlock_;
   
   NSUInteger uploadChunkSize_;      // zero when uploading via multi-part MIME http body
@@ -141,8 +195,26 @@ typedef BOOL (^GTLServiceRetryBlock)(GTLServiceTicket *__nonnull ticket,
   NSTimeInterval maxRetryInterval_; // default to 600. seconds
   
   BOOL shouldFetchNextPages_;
+  NSUInteger maxNumberOfNextPagesFetched_;
+  BOOL shouldParseIncrementally_;
+  BOOL shouldParseLazily_;
+
+  NSMutableDictionary *parsedObjectCache_; // objects parsed from ETagged responses
+  NSMutableArray *parsedObjectCacheKeys_;  // least recently used first
+  NSUInteger parsedObjectCacheCapacity_;
   
   BOOL allowInsecureQueries_;
+
+  NSTimeInterval coalescingInterval_;
+  NSMutableArray *pendingCoalescedQueries_; // queries waiting to be batched;
+                                            // guarded by @synchronized(self)
+  dispatch_source_t coalescingTimer_;       // ends the coalescing interval;
+                                            // guarded by @synchronized(self)
+  BOOL shouldShareIdenticalQueries_;
+  NSMutableDictionary *sharedFetches_;      // in-flight fetches by query key
+  NSMapTable *sharedFetchTickets_;          // ticket -> fetch it waits for
+  NSUInteger maxQueriesPerBatch_;
+  GTLServiceRateLimiter *rateLimiter_;
   
   NSString *apiKey_;
   BOOL isRESTDataWrapperRequired_;
@@ -181,29 +253,120 @@ typedef BOOL (^GTLServiceRetryBlock)(GTLServiceTicket *__nonnull ticket,
 - (GTLServiceTicket *__nullable)executeQuery:(id<GTLQueryProtocol> __nonnull)query
                            completionHandler:(GTLServiceCompletionHandler __nullable)handler GTL_NONNULL((1));
 
+// Request coalescing
+//
+// When the coalescing interval is non-zero, simple queries passed to
+// executeQuery: are held for up to that many seconds and then sent together
+// as a single batch query, or alone if no other query arrived.  Each query's
+// ticket, completion block, and callbacks receive that query's own result or
+// error, as if it had been executed by itself.
+//
+// Queries with upload parameters, additional HTTP headers, URL query
+// parameters, or that skip authorization are executed immediately, as are all
+// queries when the service fetches next pages, streams pages, or has a test
+// block.  Tickets for coalesced queries have no object fetcher, and canceling
+// one drops its query from the batch; tickets may be canceled from any thread.
+// The held queries are sent on the thread that executed the first of them,
+// so that thread must have a running run loop, such as the main thread.
+//
+// Default value is 0, meaning queries are not coalesced.
+@property (nonatomic, assign) NSTimeInterval coalescingInterval;
+
+// Sharing identical queries
+//
+// When enabled, a query marked with canShareFetch that is executed while an
+// identical one is still being fetched does not start a fetch of its own; its
+// ticket waits for the result of the fetch already in flight.  Queries are identical when they have
+// the same method name, parameters, and expected object class.  The first
+// ticket to finish receives the fetched object, and each other ticket receives
+// a copy of it, so clients may modify the objects independently.
+//
+// Only queries without a body object are shared, and the exclusions for
+// request coalescing apply as well.  Tickets for shared queries have no object
+// fetcher.  Canceling one prevents its callbacks, and the fetch is stopped
+// once every ticket waiting for it has been canceled.
+//
+// Default value is NO.
+@property (nonatomic, assign) BOOL shouldShareIdenticalQueries;
+
+// Batch sharding
+//
+// When non-zero, batch queries with more than this many queries are split into
+// several batches of at most this size.  The batches are fetched at the same
+// time, subject to the fetcher service's limit on fetches per host, and a
+// batch that fails with a network or server error is retried.  The results of
+// the batches are merged into one GTLBatchResult for the ticket's callbacks;
+// the queries of a batch that could not be fetched appear in its failures.
+//
+// Tickets for split batches have no object fetcher; canceling one stops the
+// fetches of its shards and prevents its callbacks.
+//
+// Default value is 0, meaning batches are not split.
+@property (nonatomic, assign) NSUInteger maxQueriesPerBatch;
+
+// Rate limiting
+//
+// When set, the fetch of each query is held until the rate limiter allows it
+// to be sent.  Tickets of held queries have an object fetcher that has not yet
+// begun fetching; canceling the ticket drops the query.  The rate limiter does
+// not pace retries of a fetch.
+//
+// A held fetch is started by a timer on the run loop of the thread that
+// executed the query, in the service's runLoopModes, so that thread must keep
+// running its run loop while fetches are held.  A held fetch that can't be
+// started fails with kGTLErrorQueryNotExecuted.
+//
+// Default value is nil, meaning queries are sent as soon as they are executed.
+@property (nonatomic, retain) GTLServiceRateLimiter *__nullable rateLimiter;
+
 // Automatic page fetches
 //
 // Tickets can optionally do a sequence of fetches for queries where
 // repeated requests with nextPageToken or nextStartIndex values is required to
 // retrieve items of all pages of the response collection.  The client's
 // callback is invoked only when all items have been retrieved, or an error has
-// occurred.  During the fetch, the items accumulated so far are available from
-// the ticket.
+// occurred.  During the fetch, the ticket's fetchedObject is the most recently
+// fetched page; the items of all pages are joined into the final object just
+// before the callback.  Each next page is requested once the current page has
+// been parsed, before its items are added to the others.
 //
 // Note that the final object may be a combination of multiple page responses
 // so it may not be the same as if all results had been returned in a single
 // page. Some fields of the response such as total item counts may reflect only
 // the final page's values.
 //
-// Automatic page fetches will return an error if more than 25 page fetches are
-// required.  For debug builds, this will log a warning to the console when more
-// than 2 page fetches occur, as a reminder that the query's maxResults
-// parameter should probably be increased to specify more items returned per
-// page.
+// Needing more than maxNumberOfNextPagesFetched additional page fetches is
+// treated as a programming error: debug builds assert, and release builds stop
+// fetching and deliver the pages fetched so far without an error.  Debug
+// builds also log a warning to the console when more than 2 page fetches
+// occur, as a reminder that the query's maxResults parameter should probably
+// be increased to specify more items returned per page.
 //
 // Default value is NO.
 @property (nonatomic, assign) BOOL shouldFetchNextPages;
 
+// The number of pages that may be fetched after the first one when
+// shouldFetchNextPages is enabled.  This is copied to each ticket, and may be
+// changed on a ticket before its first page arrives.
+//
+// Default value is 25.
+@property (nonatomic, assign) NSUInteger maxNumberOfNextPagesFetched;
+
+// A page block streams the pages of a collection response instead of
+// accumulating them.  Each page is passed to the block as it arrives, and the
+// next page is requested only when the block's continuation is invoked with
+// YES; invoking it with NO ends the fetch.  The continuation may be kept and
+// invoked later, on the thread or queue used for the ticket's callbacks.  Only
+// its first invocation has any effect, and it is ignored for the last page.
+//
+// Pages are released after they have been delivered, so the fetch callback
+// receives only the final page.  shouldFetchNextPages and
+// maxNumberOfNextPagesFetched do not apply to streamed fetches.
+//
+// This is copied to each ticket, and may be set on a ticket before its first
+// page arrives.
+@property (copy) GTLServicePageBlock __nullable pageBlock;
+
 // Retrying; see comments on retry support at the top of GTMHTTPFetcher.
 //
 // Default value is NO.
@@ -431,12 +594,73 @@ typedef BOOL (^GTLServiceRetryBlock)(GTLServiceTicket *__nonnull ticket,
 
 // The queue used for parsing JSON responses (previously this property
 // was called operationQueue)
+//
+// Parsing is prioritized by response size and the ticket's parsePriority.
+// Responses of a megabyte or more are parsed using several threads.  With
+// the service's default parse queue, responses under 64K are parsed on a
+// separate queue of the service so they are not kept waiting behind large
+// ones; a parse queue set by the client is used for every response.
 @property (nonatomic, retain) NSOperationQueue *__nullable parseQueue;
 
+// When YES, JSON responses are parsed on the parse queue as their data
+// arrives rather than after the download completes, so most of the object
+// graph has been built by the time the last byte is received, and the
+// fetcher does not keep a copy of the raw response.
+//
+// This applies only to fetches that are not uploads, and only when the
+// service has a parseQueue.  Incrementally parsed fetches do not send ETags
+// remembered by the fetch history, so they are never answered with a Not
+// Modified status from its cache.  The fetcher's downloadedData stays empty
+// while a successful response arrives, so received data callbacks set on the
+// fetcher are not given the data.
+//
+// Default value is NO.
+@property (nonatomic, assign) BOOL shouldParseIncrementally;
+
+// When YES, the JSON of a downloaded response is only validated when it is
+// parsed, and the GTLObjects are backed by the response data; each object's
+// JSON values are created the first time they are used.  This reduces
+// parsing time and memory when only a few properties of each object in a
+// large response are used.
+//
+// This does not apply to responses that are parsed incrementally.
+//
+// Default value is NO.
+@property (nonatomic, assign) BOOL shouldParseLazily;
+
+// When the fetcher service's fetch history keeps ETagged response data
+// (shouldCacheETaggedData), a fetch answered with 304 Not Modified is given
+// the kept data, which would be parsed again.  The service instead keeps the
+// objects parsed from the most recent ETagged responses, and the ticket of a
+// Not Modified fetch gets a copy of the kept object without parsing.  Copies
+// share the JSON of the kept object until they are changed, so making one is
+// cheap.
+//
+// Only GET fetches, such as fetchObjectWithURL:, are made conditional by the
+// fetch history, so only their objects are kept.  Queries sent with
+// executeQuery: are JSON-RPC posts and are always parsed.
+//
+// This is the number of parsed objects kept; the least recently used are
+// discarded first.  Setting it to 0 discards them all.
+//
+// Default value is 20.
+@property (nonatomic, assign) NSUInteger parsedObjectCacheCapacity;
+
 // The fetcher service object issues the fetcher instances
 // for this API service
 @property (nonatomic, retain) GTMBridgeFetcherService *__nullable fetcherService;
 
+// The client and priority given to each ticket's fetchers, which the fetcher
+// service uses to share a busy host fairly among clients and to start the
+// fetchers of higher priority first; see the serviceClient and
+// servicePriority properties of GTMHTTPFetcher.  These are copied to each
+// ticket, and a query or batch may replace them with its own.  They have no
+// effect with the session fetcher.
+//
+// Default values are nil and 0.
+@property (nonatomic, copy) NSString *__nullable fetcherServiceClient;
+@property (nonatomic, assign) NSInteger fetcherServicePriority;
+
 // Default storage for cookies is in the service object's fetchHistory.
 //
 // Apps that want to share cookies between all standalone fetchers and the
@@ -487,6 +711,25 @@ typedef BOOL (^GTLServiceRetryBlock)(GTLServiceTicket *__nonnull ticket,
 
 @property (copy) GTLServiceUploadProgressBlock __nullable uploadProgressBlock;
 
+#pragma mark Class Preparation
+
+// Generated service subclasses return the query and object classes of
+// their API.
++ (GTL_NSArrayOf(Class) *__nullable)objectClasses;
+
+// Generated service subclasses return the values of their API's constants,
+// which prepareObjectClasses interns so that parsed JSON shares them.
++ (GTL_NSArrayOf(NSString *) *__nullable)constantStrings;
+
+// Properties of GTLObject and GTLQuery classes are normally wired up as each
+// is first used, which can make the first parse of a response slow.  This
+// wires up all properties of the objectClasses in one pass, and interns the
+// constantStrings for the JSON parser; it is thread-safe, so it may be called
+// on a background thread at launch.
+//
+// Returns the number of methods added.
++ (NSUInteger)prepareObjectClasses;
+
 @end
 
 @interface GTLService (TestingSupport)
@@ -555,11 +798,25 @@ typedef BOOL (^GTLServiceRetryBlock)(GTLServiceTicket *__nonnull ticket,
   NSError *fetchError_;
   BOOL hasCalledCallback_;
   NSUInteger pagesFetchedCounter_;
+  NSUInteger maxNumberOfNextPagesFetched_;
+  NSMutableDictionary *pagedItemChunks_;
+  GTLServicePageBlock pageBlock_;
   
   NSString *apiKey_;
   BOOL isREST_;
   
   NSOperation *parseOperation_;
+  NSOperationQueuePriority parsePriority_;
+  NSTimeInterval parseQueueWaitTime_;
+  NSTimeInterval parseTime_;
+
+  NSTimeInterval rateLimitDelay_;
+
+  NSString *fetcherServiceClient_;
+  NSInteger fetcherServicePriority_;
+
+  NSMutableArray *shardTickets_;  // fetches of a split batch's shards;
+                                  // guarded by @synchronized(self)
 }
 
 + (nonnull instancetype)ticketForService:(GTLService *__nonnull)service;
@@ -624,11 +881,40 @@ typedef BOOL (^GTLServiceRetryBlock)(GTLServiceTicket *__nonnull ticket,
 
 @property (nonatomic, assign) BOOL shouldFetchNextPages;
 @property (nonatomic, assign) NSUInteger pagesFetchedCounter;
+@property (nonatomic, assign) NSUInteger maxNumberOfNextPagesFetched;
+@property (copy) GTLServicePageBlock __nullable pageBlock;
 
 #pragma mark Upload
 
 @property (copy) GTLServiceUploadProgressBlock __nullable uploadProgressBlock;
 
+#pragma mark Parsing
+
+// The priority of parsing this ticket's response relative to other responses
+// waiting to be parsed.  Responses of a megabyte or more are scheduled one
+// level below this priority, and responses under 64K one level above it.
+//
+// Default value is NSOperationQueuePriorityNormal.
+@property (nonatomic, assign) NSOperationQueuePriority parsePriority;
+
+// Seconds the last response waited to be parsed, and seconds spent parsing
+// it into objects; zero until a response has been parsed.
+@property (nonatomic, readonly) NSTimeInterval parseQueueWaitTime;
+@property (nonatomic, readonly) NSTimeInterval parseTime;
+
+#pragma mark Rate Limiting
+
+// Seconds the last fetch was held by the service's rate limiter before being
+// sent; zero if it was sent immediately.
+@property (nonatomic, readonly) NSTimeInterval rateLimitDelay;
+
+#pragma mark Fetcher Service Sharing
+
+// The client and priority given to the ticket's fetchers; these are copied
+// from the service, and replaced by those of the executed query, if set.
+@property (nonatomic, copy) NSString *__nullable fetcherServiceClient;
+@property (nonatomic, assign) NSInteger fetcherServicePriority;
+
 @end
 
 
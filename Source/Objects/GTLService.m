@@ -27,6 +27,7 @@
 #endif
 
 #import "GTLService.h"
+#import "GTLRuntimeCommon.h"
 
 NSString* const kGTLServiceErrorDomain = @"com.google.GTLServiceDomain";
 NSString* const kGTLJSONRPCErrorDomain = @"com.google.GTLJSONRPCErrorDomain";
@@ -53,8 +54,36 @@ static NSString* const kFetcherParsedObjectKey         = @"_parsedObject";
 static NSString* const kFetcherBatchClassMapKey        = @"_batchClassMap";
 static NSString* const kFetcherCallbackThreadKey       = @"_callbackThread";
 static NSString* const kFetcherCallbackRunLoopModesKey = @"_runLoopModes";
+static NSString* const kFetcherStreamedResponseKey     = @"_streamedResponse";
+static NSString* const kFetcherParseEnqueueTimeKey     = @"_parseEnqueueTime";
 
-static const NSUInteger kMaxNumberOfNextPagesFetched = 25;
+// Key in a ticket's chunked item store for the items of a single query.
+static NSString* const kPagedItemsSingleQueryKey = @"_singleQuery";
+
+static const NSUInteger kDefaultMaxNumberOfNextPagesFetched = 25;
+
+// Coalesced queries are sent once this many are waiting, without waiting for
+// the rest of the coalescing interval.
+static const NSUInteger kMaxNumberOfCoalescedQueries = 50;
+
+// A shard of a split batch is retried at most this many times, waiting twice
+// as long before each retry as before the last.
+static const NSUInteger kMaxNumberOfShardRetries = 2;
+static const NSTimeInterval kInitialShardRetryInterval = 0.5;
+
+// Keys of the dictionary passed to executeShardWithRetryInfo:
+static NSString* const kShardRetryShardKey = @"shard";
+static NSString* const kShardRetryShardedBatchKey = @"shardedBatch";
+static NSString* const kShardRetryNumberOfRetriesKey = @"numberOfRetries";
+
+// Responses smaller than this are parsed on the service's fast lane queue
+// at a raised priority; responses at least this large are parsed by several
+// threads at a lowered priority.
+static const NSUInteger kMaxSmallResponseLength = 64 * 1024;
+static const NSUInteger kMinLargeResponseLength = 1024 * 1024;
+
+// Objects parsed from ETagged responses that are kept for Not Modified fetches
+static const NSUInteger kDefaultParsedObjectCacheCapacity = 20;
 
 // we'll enforce 50K chunks minimum just to avoid the server getting hit
 // with too many small upload chunks
@@ -69,7 +98,325 @@ static NSString *ETagIfPresent(GTLObject *obj) {
 
 @interface GTLServiceTicket ()
 @property (retain) NSOperation *parseOperation;
+@property (nonatomic, readwrite) NSTimeInterval parseQueueWaitTime;
+@property (nonatomic, readwrite) NSTimeInterval parseTime;
+@property (nonatomic, readwrite) NSTimeInterval rateLimitDelay;
 @property (assign) BOOL isREST;
+// Items of each page fetched for shouldFetchNextPages, keyed by request ID
+// (or kPagedItemsSingleQueryKey), until they are joined after the last page.
+@property (retain) NSMutableDictionary *pagedItemChunks;
+
+// The tickets fetching the shards of a split batch, canceled along with it.
+- (void)addShardTicket:(GTLServiceTicket *)shardTicket;
+- (void)removeShardTicket:(GTLServiceTicket *)shardTicket;
+@end
+
+// GTLServiceStreamedResponse holds the incremental parse of a response
+// while it downloads.  Chunks are queued from the fetcher's callback thread,
+// and parsed in order by operations on the parse queue.
+@interface GTLServiceStreamedResponse : NSObject {
+ @private
+  GTLJSONStreamParser *parser_;
+  NSURLResponse *response_;        // the response the parser was started for
+  NSMutableArray *pendingChunks_;  // data not yet given to the parser
+  NSLock *parseLock_;              // serializes use of the parser
+  BOOL isDrainScheduled_;
+  BOOL hasData_;
+}
+
+// Queues a chunk of a successful response for parsing, returning YES if an
+// operation should be scheduled to parse it.
+- (BOOL)addChunk:(NSData *)data forResponse:(NSURLResponse *)response;
+
+// Parses the queued chunks; called on the parse queue.
+- (void)parsePendingChunks;
+
+// Parses any remaining chunks and returns the top-level JSON object.
+- (id)finishParsingWithError:(NSError **)error;
+
+@property (readonly) BOOL hasData;
+@end
+
+@implementation GTLServiceStreamedResponse
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    pendingChunks_ = [[NSMutableArray alloc] init];
+    parseLock_ = [[NSLock alloc] init];
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [parser_ release];
+  [response_ release];
+  [pendingChunks_ release];
+  [parseLock_ release];
+  [super dealloc];
+}
+
+// Discard any state from a previous response, such as one preceding a
+// redirect or a retry.  Must be called within @synchronized(self)
+- (void)resetIfNeededForResponse:(NSURLResponse *)response {
+  if (response == response_ && parser_ != nil) return;
+
+  [response_ release];
+  response_ = [response retain];
+
+  [parser_ release];
+  parser_ = [[GTLJSONStreamParser alloc] init];
+
+  [pendingChunks_ removeAllObjects];
+  hasData_ = NO;
+}
+
+- (BOOL)addChunk:(NSData *)data forResponse:(NSURLResponse *)response {
+  // Copy the chunk, since the caller may reuse the buffer.
+  NSData *chunk = [data copy];
+  BOOL shouldSchedule = NO;
+  @synchronized(self) {
+    [self resetIfNeededForResponse:response];
+    [pendingChunks_ addObject:chunk];
+    hasData_ = YES;
+    if (!isDrainScheduled_) {
+      isDrainScheduled_ = YES;
+      shouldSchedule = YES;
+    }
+  }
+  [chunk release];
+  return shouldSchedule;
+}
+
+- (void)parsePendingChunks {
+  // Taking the chunks while holding the parse lock keeps them in order when
+  // more than one parse operation is running.
+  [parseLock_ lock];
+
+  GTLJSONStreamParser *parser;
+  NSArray *chunks;
+  @synchronized(self) {
+    parser = [[parser_ retain] autorelease];
+    chunks = [[pendingChunks_ copy] autorelease];
+    [pendingChunks_ removeAllObjects];
+    isDrainScheduled_ = NO;
+  }
+  for (NSData *chunk in chunks) {
+    @autoreleasepool {
+      if (![parser appendData:chunk]) break;
+    }
+  }
+
+  [parseLock_ unlock];
+}
+
+- (id)finishParsingWithError:(NSError **)error {
+  [self parsePendingChunks];
+
+  GTLJSONStreamParser *parser;
+  @synchronized(self) {
+    parser = [[parser_ retain] autorelease];
+  }
+  [parseLock_ lock];
+  id result = [parser finishWithError:error];
+  [parseLock_ unlock];
+  return result;
+}
+
+- (BOOL)hasData {
+  @synchronized(self) {
+    return hasData_;
+  }
+}
+
+@end
+
+// GTLServiceCoalescedQuery holds a query waiting in the service's coalescing
+// window, or for a fetch shared with identical queries, along with the ticket
+// returned for it and the callbacks to invoke.
+@interface GTLServiceCoalescedQuery : NSObject {
+ @private
+  GTLServiceTicket *ticket_;
+  id delegate_;
+  SEL finishedSelector_;
+  GTLServiceCompletionHandler completionHandler_;
+}
+@property (retain) GTLServiceTicket *ticket;
+@property (retain) id delegate;
+@property (assign) SEL finishedSelector;
+@property (copy) GTLServiceCompletionHandler completionHandler;
+@end
+
+@implementation GTLServiceCoalescedQuery
+
+@synthesize ticket = ticket_,
+            delegate = delegate_,
+            finishedSelector = finishedSelector_,
+            completionHandler = completionHandler_;
+
+- (void)dealloc {
+  [ticket_ release];
+  [delegate_ release];
+  [completionHandler_ release];
+  [super dealloc];
+}
+
+@end
+
+// GTLServiceSharedFetch is a fetch in flight for a query, and the queries
+// identical to it waiting for its result.
+@interface GTLServiceSharedFetch : NSObject {
+ @private
+  NSArray *key_;
+  GTLServiceTicket *fetchTicket_;
+  NSMutableArray *waiters_;
+}
+@property (retain) NSArray *key;
+@property (retain) GTLServiceTicket *fetchTicket;
+@property (readonly) NSMutableArray *waiters; // of GTLServiceCoalescedQuery
+@end
+
+@implementation GTLServiceSharedFetch
+
+@synthesize key = key_,
+            fetchTicket = fetchTicket_,
+            waiters = waiters_;
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    waiters_ = [[NSMutableArray alloc] init];
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [key_ release];
+  [fetchTicket_ release];
+  [waiters_ release];
+  [super dealloc];
+}
+
+@end
+
+// GTLServiceShardedBatch collects the results of the shards of a split batch
+// query for the ticket returned for the batch.
+@interface GTLServiceShardedBatch : NSObject {
+ @private
+  GTLServiceTicket *ticket_;
+  id delegate_;
+  SEL finishedSelector_;
+  GTLServiceCompletionHandler completionHandler_;
+  GTLBatchResult *result_;
+  NSError *lastError_;
+  NSUInteger numberOfShards_;
+  NSUInteger numberOfPendingShards_;
+  NSUInteger numberOfFailedShards_;
+}
+@property (retain) GTLServiceTicket *ticket;
+@property (retain) id delegate;
+@property (assign) SEL finishedSelector;
+@property (copy) GTLServiceCompletionHandler completionHandler;
+@property (retain) GTLBatchResult *result;
+@property (retain) NSError *lastError;
+@property (assign) NSUInteger numberOfShards;
+@property (assign) NSUInteger numberOfPendingShards;
+@property (assign) NSUInteger numberOfFailedShards;
+@end
+
+@implementation GTLServiceShardedBatch
+
+@synthesize ticket = ticket_,
+            delegate = delegate_,
+            finishedSelector = finishedSelector_,
+            completionHandler = completionHandler_,
+            result = result_,
+            lastError = lastError_,
+            numberOfShards = numberOfShards_,
+            numberOfPendingShards = numberOfPendingShards_,
+            numberOfFailedShards = numberOfFailedShards_;
+
+- (void)dealloc {
+  [ticket_ release];
+  [delegate_ release];
+  [completionHandler_ release];
+  [result_ release];
+  [lastError_ release];
+  [super dealloc];
+}
+
+@end
+
+// GTLServiceParsedObject is an object parsed from an ETagged response, kept
+// so that a fetch answered with 304 Not Modified need not parse the same data
+// again.  The object itself is never handed out; tickets get copies of it.
+@interface GTLServiceParsedObject : NSObject {
+ @private
+  GTLObject *object_;
+  NSString *ETag_;
+  Class defaultClass_;
+  NSDictionary *surrogates_;
+}
+@property (retain) GTLObject *object;
+@property (copy) NSString *ETag;
+@property (assign) Class defaultClass;
+@property (retain) NSDictionary *surrogates;
+@end
+
+@implementation GTLServiceParsedObject
+
+@synthesize object = object_,
+            ETag = ETag_,
+            defaultClass = defaultClass_,
+            surrogates = surrogates_;
+
+- (void)dealloc {
+  [object_ release];
+  [ETag_ release];
+  [surrogates_ release];
+  [super dealloc];
+}
+
+@end
+
+// GTLServiceTokenBucket is one budget of a rate limiter.  Its tokens go below
+// zero as queries are held, so each query held waits for those held before it.
+@interface GTLServiceTokenBucket : NSObject {
+ @private
+  double rate_;
+  double burst_;
+  double tokens_;
+  NSTimeInterval lastRefillTime_;
+}
+- (instancetype)initWithRate:(double)rate burst:(double)burst;
+- (NSTimeInterval)takeToken;
+@end
+
+@implementation GTLServiceTokenBucket
+
+- (instancetype)initWithRate:(double)rate burst:(double)burst {
+  self = [super init];
+  if (self) {
+    rate_ = rate;
+    burst_ = burst;
+    tokens_ = burst;
+    lastRefillTime_ = [NSDate timeIntervalSinceReferenceDate];
+  }
+  return self;
+}
+
+// Returns the seconds until the token taken is available
+- (NSTimeInterval)takeToken {
+  NSTimeInterval now = [NSDate timeIntervalSinceReferenceDate];
+  tokens_ = MIN(burst_, tokens_ + (now - lastRefillTime_) * rate_);
+  lastRefillTime_ = now;
+
+  tokens_ -= 1.0;
+  if (tokens_ >= 0) return 0;
+
+  return -tokens_ / rate_;
+}
+
 @end
 
 // category to provide opaque access to tickets stored in fetcher properties
@@ -138,7 +485,63 @@ static NSString *ETagIfPresent(GTLObject *obj) {
                                         ticket:(GTLServiceTicket *)ticket;
 - (GTLObject *)mergedNewResultObject:(GTLObject *)newResult
                      oldResultObject:(GTLObject *)oldResult
-                            forQuery:(GTLQuery *)query;
+                            forQuery:(GTLQuery *)query
+                              ticket:(GTLServiceTicket *)ticket;
+- (void)assemblePagedItemsForResult:(GTLObject *)object
+                              query:(GTLQuery *)query
+                             ticket:(GTLServiceTicket *)ticket;
+- (void)invokeCallbacksForTicket:(GTLServiceTicket *)ticket
+                          object:(GTLObject *)object
+                           error:(NSError *)error
+                        delegate:(id)delegate
+             didFinishedSelector:(SEL)finishedSelector
+               completionHandler:(GTLServiceCompletionHandler)completionHandler;
+- (GTLServicePageContinuation)pageContinuationForTicket:(GTLServiceTicket *)ticket
+                                          nextPageQuery:(GTLQuery *)nextPageQuery
+                                               delegate:(id)delegate
+                                    didFinishedSelector:(SEL)finishedSelector
+                                      completionHandler:(GTLServiceCompletionHandler)completionHandler;
+- (BOOL)shouldCoalesceQuery:(GTLQuery *)query;
+- (GTLServiceTicket *)coalesceQuery:(GTLQuery *)query
+                           delegate:(id)delegate
+                  didFinishSelector:(SEL)finishedSelector
+                  completionHandler:(GTLServiceCompletionHandler)completionHandler;
+- (void)startCoalescingTimer;
+- (void)cancelCoalescingTimer;
+- (void)executeCoalescedQueries;
+- (void)stopCoalescingQueryForTicket:(GTLServiceTicket *)ticket;
+- (void)finishCoalescedQuery:(GTLServiceCoalescedQuery *)coalesced
+                      object:(GTLObject *)object
+                       error:(NSError *)error;
+- (BOOL)shouldShareQuery:(GTLQuery *)query;
+- (GTLServiceTicket *)shareQuery:(GTLQuery *)query
+                        delegate:(id)delegate
+               didFinishSelector:(SEL)finishedSelector
+               completionHandler:(GTLServiceCompletionHandler)completionHandler;
+- (void)finishSharedFetch:(GTLServiceSharedFetch *)shared
+                   object:(GTLObject *)object
+                    error:(NSError *)error;
+- (void)stopSharingFetchForTicket:(GTLServiceTicket *)ticket;
+- (GTLServiceTicket *)executeClientBatchQuery:(GTLBatchQuery *)batch
+                                     delegate:(id)delegate
+                            didFinishSelector:(SEL)finishedSelector
+                            completionHandler:(GTLServiceCompletionHandler)completionHandler;
+- (GTLServiceTicket *)executeShardedBatchQuery:(GTLBatchQuery *)batch
+                                      delegate:(id)delegate
+                             didFinishSelector:(SEL)finishedSelector
+                             completionHandler:(GTLServiceCompletionHandler)completionHandler;
+- (void)executeShard:(GTLBatchQuery *)shard
+      ofShardedBatch:(GTLServiceShardedBatch *)sharded
+     numberOfRetries:(NSUInteger)numberOfRetries;
+- (void)retryShard:(GTLBatchQuery *)shard
+    ofShardedBatch:(GTLServiceShardedBatch *)sharded
+   numberOfRetries:(NSUInteger)numberOfRetries;
+- (GTLBatchQuery *)shardOfRetryableFailuresInResult:(GTLBatchResult *)result
+                                            ofShard:(GTLBatchQuery *)shard;
+- (void)finishShard:(GTLBatchQuery *)shard
+     ofShardedBatch:(GTLServiceShardedBatch *)sharded
+             result:(GTLBatchResult *)result
+              error:(NSError *)error;
 - (GTLUploadFetcherClass *)uploadFetcherWithRequest:(NSURLRequest *)request
                                     fetcherService:(GTMBridgeFetcherService *)fetcherService
                                             params:(GTLUploadParameters *)uploadParams;
@@ -159,6 +562,12 @@ static NSString *ETagIfPresent(GTLObject *obj) {
      finishedWithData:(NSData *)data
                 error:(NSError *)error;
 - (void)parseObjectFromDataOfFetcher:(GTMBridgeFetcher *)fetcher;
+- (GTLObject *)cachedParsedObjectForFetcher:(GTMBridgeFetcher *)fetcher;
+- (void)cacheParsedObject:(GTLObject *)object
+               forFetcher:(GTMBridgeFetcher *)fetcher;
+- (NSTimeInterval)rateLimitDelayForQuery:(id<GTLQueryProtocol>)query
+                                     URL:(NSURL *)url;
+- (void)beginRateLimitedFetcher:(GTMBridgeFetcher *)fetcher;
 @end
 
 @interface GTLObject (StandardProperties)
@@ -171,8 +580,13 @@ static NSString *ETagIfPresent(GTLObject *obj) {
 
 @synthesize userAgentAddition = userAgentAddition_,
             fetcherService = fetcherService_,
+            fetcherServiceClient = fetcherServiceClient_,
+            fetcherServicePriority = fetcherServicePriority_,
             parseQueue = parseQueue_,
             shouldFetchNextPages = shouldFetchNextPages_,
+            maxNumberOfNextPagesFetched = maxNumberOfNextPagesFetched_,
+            shouldParseIncrementally = shouldParseIncrementally_,
+            shouldParseLazily = shouldParseLazily_,
             surrogates = surrogates_,
             uploadProgressSelector = uploadProgressSelector_,
             retryEnabled = isRetryEnabled_,
@@ -188,12 +602,47 @@ static NSString *ETagIfPresent(GTLObject *obj) {
             allowInsecureQueries = allowInsecureQueries_,
             retryBlock = retryBlock_,
             uploadProgressBlock = uploadProgressBlock_,
+            pageBlock = pageBlock_,
+            coalescingInterval = coalescingInterval_,
+            shouldShareIdenticalQueries = shouldShareIdenticalQueries_,
+            maxQueriesPerBatch = maxQueriesPerBatch_,
+            rateLimiter = rateLimiter_,
             testBlock = testBlock_;
 
 + (Class)ticketClass {
   return [GTLServiceTicket class];
 }
 
++ (NSArray *)objectClasses {
+  return nil;
+}
+
++ (NSArray *)constantStrings {
+  return nil;
+}
+
++ (NSUInteger)prepareObjectClasses {
+#if GTL_LOG_PERFORMANCE
+  NSTimeInterval secs1, secs2;
+  secs1 = [NSDate timeIntervalSinceReferenceDate];
+#endif
+
+  NSArray *objectClasses = [self objectClasses];
+  NSUInteger numberAdded = 0;
+  for (Class<GTLRuntimeCommon> objectClass in objectClasses) {
+    numberAdded += [GTLRuntimeCommon installDynamicMethodsForClass:objectClass];
+  }
+  [GTLJSONParser internStrings:[self constantStrings]];
+
+#if GTL_LOG_PERFORMANCE
+  secs2 = [NSDate timeIntervalSinceReferenceDate];
+  NSLog(@"preparing %lu classes of %@ (%lu methods) took %f seconds",
+        (unsigned long)objectClasses.count, self, (unsigned long)numberAdded,
+        secs2 - secs1);
+#endif
+  return numberAdded;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
@@ -201,6 +650,7 @@ static NSString *ETagIfPresent(GTLObject *obj) {
 #if GTL_IPHONE || (MAC_OS_X_VERSION_MIN_REQUIRED > MAC_OS_X_VERSION_10_5)
     // For 10.6 and up, always use an operation queue
     parseQueue_ = [[NSOperationQueue alloc] init];
+    smallResponseParseQueue_ = [[NSOperationQueue alloc] init];
 #elif !GTL_SKIP_PARSE_THREADING
     // Avoid NSOperationQueue prior to 10.5.6, per
     // http://www.mikeash.com/?page=pyblog/use-nsoperationqueue.html
@@ -209,6 +659,7 @@ static NSString *ETagIfPresent(GTLObject *obj) {
 
     if (bcdSystemVersion >= 0x1057) {
       parseQueue_ = [[NSOperationQueue alloc] init];
+      smallResponseParseQueue_ = [[NSOperationQueue alloc] init];
     }
 #else
     // parseQueue_ defaults to nil, so parsing will be done immediately
@@ -217,6 +668,12 @@ static NSString *ETagIfPresent(GTLObject *obj) {
 
     fetcherService_ = [[GTMBridgeFetcherService alloc] init];
 
+    maxNumberOfNextPagesFetched_ = kDefaultMaxNumberOfNextPagesFetched;
+
+    parsedObjectCache_ = [[NSMutableDictionary alloc] init];
+    parsedObjectCacheKeys_ = [[NSMutableArray alloc] init];
+    parsedObjectCacheCapacity_ = kDefaultParsedObjectCacheCapacity;
+
     NSUInteger chunkSize = [[self class] defaultServiceUploadChunkSize];
     self.serviceUploadChunkSize = chunkSize;
   }
@@ -225,13 +682,22 @@ static NSString *ETagIfPresent(GTLObject *obj) {
 
 - (void)dealloc {
   [parseQueue_ release];
+  [smallResponseParseQueue_ release];
   [userAgent_ release];
   [fetcherService_ release];
+  [fetcherServiceClient_ release];
   [userAgentAddition_ release];
   [serviceProperties_ release];
   [surrogates_ release];
   [uploadProgressBlock_ release];
   [retryBlock_ release];
+  [pageBlock_ release];
+  [parsedObjectCache_ release];
+  [parsedObjectCacheKeys_ release];
+  [pendingCoalescedQueries_ release];
+  [sharedFetches_ release];
+  [sharedFetchTickets_ release];
+  [rateLimiter_ release];
   [testBlock_ release];
   [apiKey_ release];
   [apiVersion_ release];
@@ -485,6 +951,16 @@ static NSString *ETagIfPresent(GTLObject *obj) {
 
   ticket.executingQuery = query;
 
+  // The query's fetcher service client and priority replace the ticket's
+  NSString *queryServiceClient = query.fetcherServiceClient;
+  if (queryServiceClient != nil) {
+    ticket.fetcherServiceClient = queryServiceClient;
+  }
+  NSInteger queryServicePriority = query.fetcherServicePriority;
+  if (queryServicePriority != 0) {
+    ticket.fetcherServicePriority = queryServicePriority;
+  }
+
   GTLQuery *originalQuery = (GTLQuery *)ticket.originalQuery;
   if (originalQuery == nil) {
     originalQuery = (GTLQuery *)query;
@@ -536,6 +1012,10 @@ static NSString *ETagIfPresent(GTLObject *obj) {
   if (cookieStorageMethod >= 0) {
     fetcher.cookieStorageMethod = cookieStorageMethod;
   }
+
+  // let the fetcher service share the host among clients and priorities
+  fetcher.serviceClient = ticket.fetcherServiceClient;
+  fetcher.servicePriority = ticket.fetcherServicePriority;
 #endif
 
   if (!mayAuthorize) {
@@ -567,6 +1047,10 @@ static NSString *ETagIfPresent(GTLObject *obj) {
   // remember the object fetcher in the ticket
   ticket.objectFetcher = fetcher;
 
+  if (self.shouldParseIncrementally && uploadParams == nil && self.parseQueue) {
+    [self beginIncrementalParsingForFetcher:fetcher];
+  }
+
   // add parameters used by the callbacks
 
   [fetcher setProperty:objectClass forKey:kFetcherObjectClassKey];
@@ -587,6 +1071,23 @@ static NSString *ETagIfPresent(GTLObject *obj) {
 
   // set the upload data
   fetcher.bodyData = dataToPost;
+
+  // Hold the fetch until the rate limiter allows it to be sent
+  NSTimeInterval rateLimitDelay = [self rateLimitDelayForQuery:query
+                                                           URL:targetURL];
+  ticket.rateLimitDelay = rateLimitDelay;
+  if (rateLimitDelay > 0) {
+    NSArray *runLoopModes = self.runLoopModes;
+    if (runLoopModes.count == 0) {
+      runLoopModes = @[ NSRunLoopCommonModes ];
+    }
+    [self performSelector:@selector(beginRateLimitedFetcher:)
+               withObject:fetcher
+               afterDelay:rateLimitDelay
+                  inModes:runLoopModes];
+    return ticket;
+  }
+
 #if GTL_USE_SESSION_FETCHER
   BOOL didFetch = YES;
   [fetcher beginFetchWithDelegate:self
@@ -610,6 +1111,77 @@ static NSString *ETagIfPresent(GTLObject *obj) {
   return ticket;
 }
 
+- (NSTimeInterval)rateLimitDelayForQuery:(id<GTLQueryProtocol>)query
+                                     URL:(NSURL *)url {
+  GTLServiceRateLimiter *rateLimiter = self.rateLimiter;
+  if (rateLimiter == nil) return 0;
+
+  NSString *host = url.host;
+  if (query.isBatchQuery) {
+    // Each query of a batch counts against the quota
+    NSTimeInterval delay = 0;
+    for (GTLQuery *batchedQuery in ((GTLBatchQuery *)query).queries) {
+      NSTimeInterval queryDelay = [rateLimiter takeTokenForMethodName:batchedQuery.methodName
+                                                                 host:host];
+      delay = MAX(delay, queryDelay);
+    }
+    return delay;
+  }
+
+  NSString *methodName = nil;
+  if ([(id)query isKindOfClass:[GTLQuery class]]) {
+    methodName = ((GTLQuery *)query).methodName;
+  }
+  return [rateLimiter takeTokenForMethodName:methodName
+                                        host:host];
+}
+
+- (void)beginRateLimitedFetcher:(GTMBridgeFetcher *)fetcher {
+  // A canceled ticket has cleared the fetcher's properties
+  GTLServiceTicket *ticket = [fetcher propertyForKey:kFetcherTicketKey];
+  if (ticket.service == nil) return;
+
+#if GTL_USE_SESSION_FETCHER
+  [fetcher beginFetchWithDelegate:self
+                didFinishSelector:@selector(objectFetcher:finishedWithData:error:)];
+#else
+  BOOL didFetch = [fetcher beginFetchWithDelegate:self
+                                didFinishSelector:@selector(objectFetcher:finishedWithData:error:)];
+  if (!didFetch && !ticket.hasCalledCallback) {
+    // The ticket has already been returned, so rather than dropping it as an
+    // unthrottled fetch would, fail it.  Stopping the fetcher releases its
+    // callbacks, so its own deferred failure won't call back again.
+    [fetcher stopFetching];
+    NSError *error = [NSError errorWithDomain:kGTLServiceErrorDomain
+                                         code:kGTLErrorQueryNotExecuted
+                                     userInfo:nil];
+    [self objectFetcher:fetcher finishedWithData:nil error:error];
+  }
+#endif
+}
+
+- (void)beginIncrementalParsingForFetcher:(GTMBridgeFetcher *)fetcher {
+  GTLServiceStreamedResponse *streamed =
+    [[[GTLServiceStreamedResponse alloc] init] autorelease];
+  [fetcher setProperty:streamed forKey:kFetcherStreamedResponseKey];
+
+  NSOperationQueue *parseQueue = self.parseQueue;
+
+  // The fetcher retains the block, so the block must not retain the fetcher
+  __block GTMBridgeFetcher *fetcherRef = fetcher;
+  fetcher.accumulateDataBlock = ^(NSData *buffer) {
+    // The fetcher keeps the bodies of unsuccessful responses, which are
+    // parsed after the fetch fails, so only successful data arrives here.
+    NSURLResponse *response = fetcherRef.response;
+    if ([streamed addChunk:buffer forResponse:response]) {
+      NSOperation *op = [NSBlockOperation blockOperationWithBlock:^{
+        [streamed parsePendingChunks];
+      }];
+      [parseQueue addOperation:op];
+    }
+  };
+}
+
 - (GTLUploadFetcherClass *)uploadFetcherWithRequest:(NSURLRequest *)request
                                      fetcherService:(GTMBridgeFetcherService *)fetcherService
                                              params:(GTLUploadParameters *)uploadParams {
@@ -1052,8 +1624,10 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
 
 - (void)objectFetcher:(GTMBridgeFetcher *)fetcher finishedWithData:(NSData *)data error:(NSError *)error {
   // we now have the JSON data for an object, or an error
+  GTLServiceStreamedResponse *streamed =
+    [fetcher propertyForKey:kFetcherStreamedResponseKey];
   if (error == nil) {
-    if (data.length > 0) {
+    if (data.length > 0 || streamed.hasData) {
       [self prepareToParseObjectForFetcher:fetcher];
     } else {
       // no data (such as when deleting)
@@ -1152,6 +1726,19 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
                   forKey:kFetcherBatchClassMapKey];
   }
 
+  // An unchanged response gets a copy of the object parsed from it before.
+  GTLObject *cachedObject = [self cachedParsedObjectForFetcher:fetcher];
+  if (cachedObject != nil) {
+    [fetcher setProperty:cachedObject forKey:kFetcherParsedObjectKey];
+    [fetcher setProperty:nil forKey:kFetcherCallbackThreadKey];
+    [self handleParsedObjectForFetcher:fetcher];
+    return;
+  }
+
+  NSTimeInterval enqueueTime = [NSDate timeIntervalSinceReferenceDate];
+  [fetcher setProperty:@(enqueueTime)
+                forKey:kFetcherParseEnqueueTimeKey];
+
   // if there's an operation queue, then use that to schedule parsing on another
   // thread
   SEL parseSel = @selector(parseObjectFromDataOfFetcher:);
@@ -1161,6 +1748,25 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
     op = [[[NSInvocationOperation alloc] initWithTarget:self
                                                selector:parseSel
                                                  object:fetcher] autorelease];
+
+    // Small responses are parsed ahead of large ones, and when the service
+    // uses its own parse queue, on a queue of their own so they need not
+    // wait for a thread of the parse queue. Most of a streamed response has
+    // been parsed already.
+    NSOperationQueuePriority priority = ticket.parsePriority;
+    GTLServiceStreamedResponse *streamed =
+      [fetcher propertyForKey:kFetcherStreamedResponseKey];
+    NSUInteger responseLength = streamed ? 0 : fetcher.downloadedData.length;
+    if (responseLength < kMaxSmallResponseLength) {
+      priority = MIN(priority + 4, NSOperationQueuePriorityVeryHigh);
+      if (smallResponseParseQueue_) {
+        queue = smallResponseParseQueue_;
+      }
+    } else if (responseLength >= kMinLargeResponseLength) {
+      priority = MAX(priority - 4, NSOperationQueuePriorityVeryLow);
+    }
+    op.queuePriority = priority;
+
     ticket.parseOperation = op;
     [queue addOperation:op];
     // the fetcher now belongs to the parsing thread
@@ -1198,7 +1804,16 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
 
   NSOperation *parseOperation = ticket.parseOperation;
 
-  BOOL hasData = data.length > 0;
+  GTLServiceStreamedResponse *streamed =
+    [properties valueForKey:kFetcherStreamedResponseKey];
+
+  NSTimeInterval parseStartTime = [NSDate timeIntervalSinceReferenceDate];
+  NSNumber *enqueueTime = [properties valueForKey:kFetcherParseEnqueueTimeKey];
+  if (enqueueTime) {
+    ticket.parseQueueWaitTime = parseStartTime - enqueueTime.doubleValue;
+  }
+
+  BOOL hasData = data.length > 0 || streamed.hasData;
   BOOL isJSON = [contentType hasPrefix:@"application/json"];
   GTL_DEBUG_ASSERT(isJSON || !hasData, @"Got unexpected content type '%@'", contentType);
 
@@ -1209,8 +1824,32 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
 #endif
 
     NSError *parseError = nil;
-    NSMutableDictionary *jsonWrapper = [GTLJSONParser objectWithData:data
-                                                               error:&parseError];
+    NSMutableDictionary *jsonWrapper;
+    // The decoders stop soon after the ticket is cancelled, and anything
+    // autoreleased while decoding is released before the objects are made.
+    @autoreleasepool {
+      if (streamed) {
+        // Most of the response was parsed while it downloaded
+        jsonWrapper = [streamed finishParsingWithError:&parseError];
+      } else if (self.shouldParseLazily) {
+        // The objects will be backed by the downloaded data
+        jsonWrapper = [GTLJSONParser lazyObjectWithData:data
+                                                  error:&parseError];
+      } else if (data.length >= kMinLargeResponseLength && self.parseQueue) {
+        // Split the work of creating the containers among several threads
+        jsonWrapper = [GTLJSONParser concurrentObjectWithData:data
+                                                    operation:parseOperation
+                                                        error:&parseError];
+      } else {
+        jsonWrapper = [GTLJSONParser objectWithData:data
+                                          operation:parseOperation
+                                              error:&parseError];
+      }
+      [jsonWrapper retain];
+      [parseError retain];
+    }
+    [jsonWrapper autorelease];
+    [parseError autorelease];
     if (parseOperation.cancelled) return;
 
     if (parseError != nil) {
@@ -1247,9 +1886,14 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
         GTLObject *parsedObject = [GTLObject objectForJSON:json
                                               defaultClass:defaultClass
                                                 surrogates:surrogates
-                                             batchClassMap:batchClassMap];
+                                             batchClassMap:batchClassMap
+                                                 operation:parseOperation];
+        if (parseOperation.cancelled) return;
 
         [fetcher setProperty:parsedObject forKey:kFetcherParsedObjectKey];
+        if (batchClassMap == nil) {
+          [self cacheParsedObject:parsedObject forFetcher:fetcher];
+        }
       } else if (!isREST) {
         NSMutableDictionary *errorJSON = [jsonWrapper valueForKey:@"error"];
         GTL_DEBUG_ASSERT(errorJSON != nil, @"no result or error in response:\n%@",
@@ -1269,6 +1913,8 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
 #endif
   }
 
+  ticket.parseTime = [NSDate timeIntervalSinceReferenceDate] - parseStartTime;
+
   if (parseOperation.cancelled) return;
 
   SEL parseDoneSel = @selector(handleParsedObjectForFetcher:);
@@ -1321,36 +1967,33 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
 
   GTLQuery *executingQuery = (GTLQuery *)ticket.executingQuery;
 
-  BOOL shouldFetchNextPages = ticket.shouldFetchNextPages;
+  GTLServicePageBlock pageBlock = ticket.pageBlock;
+  BOOL isStreamingPages = (pageBlock != nil);
+  BOOL shouldFetchNextPages = ticket.shouldFetchNextPages && !isStreamingPages;
   GTLObject *previousObject = ticket.fetchedObject;
 
-  if (shouldFetchNextPages
-      && (previousObject != nil)
-      && (object != nil)) {
-    // Accumulate new results
-    object = [self mergedNewResultObject:object
-                         oldResultObject:previousObject
-                                forQuery:executingQuery];
-  }
-
-  ticket.fetchedObject = object;
-  ticket.fetchError = error;
+  BOOL shouldCallCallbacks = YES;
+  GTLQuery *streamedNextPageQuery = nil;
 
-  if ([fetcher propertyForKey:kFetcherParsingNotificationKey] != nil) {
-    // we want to always balance the start and stop notifications
-    NSNotificationCenter *defaultNC = [NSNotificationCenter defaultCenter];
-    [defaultNC postNotificationName:kGTLServiceTicketParsingStoppedNotification
-                             object:ticket];
+  if (isStreamingPages && object != nil) {
+    // The next page is requested only when the page block's consumer asks
+    // for it.
+    streamedNextPageQuery =
+      (GTLQuery *)[self nextPageQueryForQuery:executingQuery
+                                       result:object
+                                       ticket:ticket];
+    shouldCallCallbacks = (streamedNextPageQuery == nil);
   }
 
-  BOOL shouldCallCallbacks = YES;
-
   // Use the nextPageToken to fetch any later pages for non-batch queries
   //
   // This assumes a pagination model where objects have entries in an "items"
   // field and a "nextPageToken" field, and queries support a "pageToken"
   // parameter.
-  if (ticket.shouldFetchNextPages) {
+  //
+  // The next page's fetch is started before this page's items are added to
+  // the earlier pages' items.
+  if (shouldFetchNextPages) {
     // Determine if we should fetch more pages of results
 
     GTLQuery *nextPageQuery =
@@ -1388,63 +2031,294 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
     }
   }
 
+  if (shouldFetchNextPages
+      && (previousObject != nil)
+      && (object != nil)) {
+    // Accumulate new results
+    object = [self mergedNewResultObject:object
+                         oldResultObject:previousObject
+                                forQuery:executingQuery
+                                  ticket:ticket];
+  }
+
+  if (shouldCallCallbacks) {
+    // This was the last page; join the items of all the pages.
+    if (object != nil) {
+      [self assemblePagedItemsForResult:object
+                                  query:executingQuery
+                                 ticket:ticket];
+    }
+    ticket.pagedItemChunks = nil;
+  }
+
+  ticket.fetchedObject = object;
+  ticket.fetchError = error;
+
+  if ([fetcher propertyForKey:kFetcherParsingNotificationKey] != nil) {
+    // we want to always balance the start and stop notifications
+    NSNotificationCenter *defaultNC = [NSNotificationCenter defaultCenter];
+    [defaultNC postNotificationName:kGTLServiceTicketParsingStoppedNotification
+                             object:ticket];
+  }
+
   // We no longer care about the queries for page 2 or later, so for the client
   // inspecting the ticket in the callback, the executing query should be
   // the original one
   ticket.executingQuery = ticket.originalQuery;
 
-  if (shouldCallCallbacks) {
-    // First, call query-specific callback blocks.  We do this before the
-    // fetch callback to let applications do any final clean-up (or update
-    // their UI) in the fetch callback.
-    GTLQuery *originalQuery = (GTLQuery *)ticket.originalQuery;
-    if (!originalQuery.batchQuery) {
-      // Single query
-      GTLServiceCompletionHandler completionBlock = originalQuery.completionBlock;
-      if (completionBlock) {
-        completionBlock(ticket, object, error);
-      }
-    } else {
-      [self invokeBatchCompletionsWithTicket:ticket
-                                  batchQuery:(GTLBatchQuery *)originalQuery
-                                 batchResult:(GTLBatchResult *)object
-                                       error:error];
-    }
-
-    // Release query callback blocks
-    [originalQuery executionDidStop];
+  if (isStreamingPages && object != nil) {
+    BOOL isLastPage = (streamedNextPageQuery == nil);
+    GTLServicePageContinuation continuation =
+      [self pageContinuationForTicket:ticket
+                        nextPageQuery:streamedNextPageQuery
+                             delegate:delegate
+                  didFinishedSelector:finishedSelector
+                    completionHandler:completionHandler];
+    pageBlock(ticket, object, isLastPage, continuation);
+  }
 
-    if (finishedSelector) {
-      [[self class] invokeCallback:finishedSelector
-                            target:delegate
-                            ticket:ticket
+  if (shouldCallCallbacks) {
+    [self invokeCallbacksForTicket:ticket
                             object:object
-                             error:error];
-    }
-
-    if (completionHandler) {
-      completionHandler(ticket, object, error);
-    }
-    ticket.hasCalledCallback = YES;
+                             error:error
+                          delegate:delegate
+               didFinishedSelector:finishedSelector
+                 completionHandler:completionHandler];
   }
   fetcher.properties = nil;
 
   // Tickets don't know when the fetch has completed, so the service will
-  // release their blocks here to avoid unintended retain loops
-  ticket.retryBlock = nil;
-  ticket.uploadProgressBlock = nil;
+  // release their blocks here to avoid unintended retain loops.  A streamed
+  // fetch waiting on its consumer keeps them for the pages still to come.
+  if (shouldCallCallbacks || !isStreamingPages) {
+    ticket.retryBlock = nil;
+    ticket.uploadProgressBlock = nil;
+  }
 }
 
-- (void)invokeBatchCompletionsWithTicket:(GTLServiceTicket *)ticket
-                              batchQuery:(GTLBatchQuery *)batchQuery
-                             batchResult:(GTLBatchResult *)batchResult
-                                   error:(NSError *)error {
-  // Batch query
-  //
-  // We'll step through the queries of the original batch, not of the
-  // batch result
-  NSDictionary *successes = batchResult.successes;
-  NSDictionary *failures = batchResult.failures;
+#pragma mark Parsed object cache
+
+// Objects are cached by the URL that fetched them.  The fetch history makes
+// only GETs conditional, so RPC posts, which also carry a new request ID in
+// each body, are never Not Modified and are not cached.
+static id ParsedObjectCacheKeyForRequest(NSURLRequest *request) {
+  NSString *httpMethod = request.HTTPMethod;
+  if (httpMethod != nil
+      && [httpMethod caseInsensitiveCompare:@"GET"] != NSOrderedSame) {
+    return nil;
+  }
+  return request.URL;
+}
+
+// Returns the ETag of the fetcher's response data if the fetch history keeps
+// that data to answer later fetches that are Not Modified, and sets
+// isNotModified if the data came from the fetch history.
+- (NSString *)parsedObjectCacheETagForFetcher:(GTMBridgeFetcher *)fetcher
+                                isNotModified:(BOOL *)isNotModified {
+  *isNotModified = NO;
+#if GTL_USE_SESSION_FETCHER
+  // The session fetcher's requests aren't answered from a fetch history.
+  return nil;
+#else
+  if (self.parsedObjectCacheCapacity == 0
+      || !fetcher.fetchHistory.shouldCacheETaggedData
+      || [fetcher propertyForKey:kFetcherStreamedResponseKey] != nil) {
+    // The fetch history does not keep data handed out as it arrives.
+    return nil;
+  }
+
+  NSInteger status = fetcher.statusCode;
+  if (status == kGTMHTTPFetcherStatusNotModified) {
+    // The data is what the fetch history kept for the ETag it sent.
+    *isNotModified = YES;
+    return [fetcher.mutableRequest valueForHTTPHeaderField:@"If-None-Match"];
+  }
+  if (status >= 300) return nil;
+
+  return fetcher.responseHeaders[@"Etag"];
+#endif
+}
+
+- (GTLObject *)cachedParsedObjectForFetcher:(GTMBridgeFetcher *)fetcher {
+  BOOL isNotModified;
+  NSString *etag = [self parsedObjectCacheETagForFetcher:fetcher
+                                           isNotModified:&isNotModified];
+  if (etag == nil || !isNotModified) return nil;
+
+  id key = ParsedObjectCacheKeyForRequest(fetcher.mutableRequest);
+  if (key == nil) return nil;
+
+  // The object must have been made the same way as it would be now.
+  GTLServiceTicket *ticket = [fetcher propertyForKey:kFetcherTicketKey];
+  Class defaultClass = [fetcher propertyForKey:kFetcherObjectClassKey];
+  NSDictionary *surrogates = ticket.surrogates;
+
+  @synchronized(parsedObjectCache_) {
+    GTLServiceParsedObject *parsed = parsedObjectCache_[key];
+    if (parsed == nil
+        || ![parsed.ETag isEqual:etag]
+        || parsed.defaultClass != defaultClass
+        || !GTL_AreEqualOrBothNil(parsed.surrogates, surrogates)) {
+      return nil;
+    }
+    [parsedObjectCacheKeys_ removeObject:key];
+    [parsedObjectCacheKeys_ addObject:key];
+
+    return [[parsed.object copy] autorelease];
+  }
+}
+
+- (void)cacheParsedObject:(GTLObject *)object
+               forFetcher:(GTMBridgeFetcher *)fetcher {
+  // This runs on the parse queue
+  if (object == nil) return;
+
+  BOOL isNotModified;
+  NSString *etag = [self parsedObjectCacheETagForFetcher:fetcher
+                                           isNotModified:&isNotModified];
+  if (etag == nil) return;
+
+  id key = ParsedObjectCacheKeyForRequest(fetcher.mutableRequest);
+  if (key == nil) return;
+
+  // The ticket's object may be changed by the client, so keep a copy.
+  GTLServiceTicket *ticket = [fetcher propertyForKey:kFetcherTicketKey];
+  GTLServiceParsedObject *parsed = [[[GTLServiceParsedObject alloc] init] autorelease];
+  parsed.object = [[object copy] autorelease];
+  parsed.ETag = etag;
+  parsed.defaultClass = [fetcher propertyForKey:kFetcherObjectClassKey];
+  parsed.surrogates = ticket.surrogates;
+
+  @synchronized(parsedObjectCache_) {
+    parsedObjectCache_[key] = parsed;
+    [parsedObjectCacheKeys_ removeObject:key];
+    [parsedObjectCacheKeys_ addObject:key];
+    [self trimParsedObjectCacheToCapacity:parsedObjectCacheCapacity_];
+  }
+}
+
+// Call only while synchronized on parsedObjectCache_
+- (void)trimParsedObjectCacheToCapacity:(NSUInteger)capacity {
+  while (parsedObjectCacheKeys_.count > capacity) {
+    id oldestKey = parsedObjectCacheKeys_[0];
+    [parsedObjectCache_ removeObjectForKey:oldestKey];
+    [parsedObjectCacheKeys_ removeObjectAtIndex:0];
+  }
+}
+
+- (NSUInteger)parsedObjectCacheCapacity {
+  @synchronized(parsedObjectCache_) {
+    return parsedObjectCacheCapacity_;
+  }
+}
+
+- (void)setParsedObjectCacheCapacity:(NSUInteger)capacity {
+  @synchronized(parsedObjectCache_) {
+    parsedObjectCacheCapacity_ = capacity;
+    [self trimParsedObjectCacheToCapacity:capacity];
+  }
+}
+
+#pragma mark -
+
+- (void)invokeCallbacksForTicket:(GTLServiceTicket *)ticket
+                          object:(GTLObject *)object
+                           error:(NSError *)error
+                        delegate:(id)delegate
+             didFinishedSelector:(SEL)finishedSelector
+               completionHandler:(GTLServiceCompletionHandler)completionHandler {
+  // First, call query-specific callback blocks.  We do this before the
+  // fetch callback to let applications do any final clean-up (or update
+  // their UI) in the fetch callback.
+  GTLQuery *originalQuery = (GTLQuery *)ticket.originalQuery;
+  if (!originalQuery.batchQuery) {
+    // Single query
+    GTLServiceCompletionHandler completionBlock = originalQuery.completionBlock;
+    if (completionBlock) {
+      completionBlock(ticket, object, error);
+    }
+  } else {
+    [self invokeBatchCompletionsWithTicket:ticket
+                                batchQuery:(GTLBatchQuery *)originalQuery
+                               batchResult:(GTLBatchResult *)object
+                                     error:error];
+  }
+
+  // Release query callback blocks
+  [originalQuery executionDidStop];
+
+  if (finishedSelector) {
+    [[self class] invokeCallback:finishedSelector
+                          target:delegate
+                          ticket:ticket
+                          object:object
+                           error:error];
+  }
+
+  if (completionHandler) {
+    completionHandler(ticket, object, error);
+  }
+  ticket.hasCalledCallback = YES;
+  ticket.pageBlock = nil;
+}
+
+// Makes the continuation handed to a ticket's page block along with each
+// streamed page.  Invoking it with YES starts the fetch of the next page;
+// invoking it with NO, or a failure to start the fetch, ends the fetch with
+// the page most recently delivered.
+- (GTLServicePageContinuation)pageContinuationForTicket:(GTLServiceTicket *)ticket
+                                          nextPageQuery:(GTLQuery *)nextPageQuery
+                                               delegate:(id)delegate
+                                    didFinishedSelector:(SEL)finishedSelector
+                                      completionHandler:(GTLServiceCompletionHandler)completionHandler {
+  if (nextPageQuery == nil) {
+    // The callbacks follow the last page without waiting on the consumer.
+    return ^(BOOL shouldFetchNextPage) {};
+  }
+
+  __block BOOL hasContinued = NO;
+  GTLServicePageContinuation continuation = ^(BOOL shouldFetchNextPage) {
+    if (hasContinued) return;
+    hasContinued = YES;
+
+    // A canceled ticket has released its service.
+    if (ticket.service == nil || ticket.hasCalledCallback) return;
+
+    BOOL isFetchingMore = NO;
+    if (shouldFetchNextPage) {
+      isFetchingMore = [self fetchNextPageWithQuery:nextPageQuery
+                                           delegate:delegate
+                                didFinishedSelector:finishedSelector
+                                  completionHandler:completionHandler
+                                             ticket:ticket];
+    }
+    if (isFetchingMore) {
+      // The consumer is done with the delivered page.
+      ticket.fetchedObject = nil;
+    } else {
+      [self invokeCallbacksForTicket:ticket
+                              object:ticket.fetchedObject
+                               error:nil
+                            delegate:delegate
+                 didFinishedSelector:finishedSelector
+                   completionHandler:completionHandler];
+      ticket.retryBlock = nil;
+      ticket.uploadProgressBlock = nil;
+    }
+  };
+  return [[continuation copy] autorelease];
+}
+
+- (void)invokeBatchCompletionsWithTicket:(GTLServiceTicket *)ticket
+                              batchQuery:(GTLBatchQuery *)batchQuery
+                             batchResult:(GTLBatchResult *)batchResult
+                                   error:(NSError *)error {
+  // Batch query
+  //
+  // We'll step through the queries of the original batch, not of the
+  // batch result
+  NSDictionary *successes = batchResult.successes;
+  NSDictionary *failures = batchResult.failures;
 
   for (GTLQuery *oneQuery in batchQuery.queries) {
     GTLServiceCompletionHandler completionBlock = oneQuery.completionBlock;
@@ -1747,14 +2621,17 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
            didFinishedSelector:(SEL)finishedSelector
              completionHandler:(GTLServiceCompletionHandler)completionHandler
                         ticket:(GTLServiceTicket *)ticket {
-  // Sanity check the number of pages fetched already
+  // Check the number of pages fetched already against the ticket's limit;
+  // streamed pages are paced by their consumer instead
   NSUInteger oldPagesFetchedCounter = ticket.pagesFetchedCounter;
 
-  if (oldPagesFetchedCounter > kMaxNumberOfNextPagesFetched) {
+  if (ticket.pageBlock == nil
+      && oldPagesFetchedCounter > ticket.maxNumberOfNextPagesFetched) {
     // Sanity check failed: way too many pages were fetched
     //
     // The client should be querying with a higher max results per page
-    // to avoid this
+    // to avoid this, or raise the ticket's limit.  Release builds go on to
+    // deliver the pages fetched so far.
     GTL_DEBUG_ASSERT(0, @"Fetched too many next pages for %@",
                      query.methodName);
     return NO;
@@ -1789,19 +2666,78 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
   return (newTicket == ticket);
 }
 
+// Adds a page's items to the ticket's chunked item store, which holds the
+// items of each page as its own array until all pages have arrived, rather
+// than copying the growing items array for every page.
+- (void)appendItemsOfPage:(GTLCollectionObject *)page
+             previousPage:(GTLCollectionObject *)previousPage
+                   forKey:(NSString *)key
+                   ticket:(GTLServiceTicket *)ticket {
+  NSMutableDictionary *allChunks = ticket.pagedItemChunks;
+  if (allChunks == nil) {
+    allChunks = [NSMutableDictionary dictionary];
+    ticket.pagedItemChunks = allChunks;
+  }
+  NSMutableArray *chunks = allChunks[key];
+  if (chunks == nil) {
+    // The first page's items come from the result being merged into.
+    chunks = [NSMutableArray array];
+    allChunks[key] = chunks;
+    NSArray *previousItems = previousPage.items;
+    if (previousItems) {
+      [chunks addObject:previousItems];
+    }
+  }
+  NSArray *items = page.items;
+  if (items) {
+    [chunks addObject:items];
+  }
+}
+
+// Sets the items of the final result from the chunked item store.
+- (void)assemblePagedItemsForResult:(GTLObject *)object
+                              query:(GTLQuery *)query
+                             ticket:(GTLServiceTicket *)ticket {
+  NSDictionary *allChunks = ticket.pagedItemChunks;
+  for (NSString *key in allChunks) {
+    GTLCollectionObject *collection;
+    if (query.isBatchQuery) {
+      collection = ((GTLBatchResult *)object).successes[key];
+    } else {
+      collection = (GTLCollectionObject *)object;
+    }
+    if (collection == nil) continue;
+
+    NSArray *chunks = allChunks[key];
+    NSUInteger numberOfItems = 0;
+    for (NSArray *chunk in chunks) {
+      numberOfItems += chunk.count;
+    }
+    NSMutableArray *items = [NSMutableArray arrayWithCapacity:numberOfItems];
+    for (NSArray *chunk in chunks) {
+      [items addObjectsFromArray:chunk];
+    }
+    [collection performSelector:@selector(setItems:) withObject:items];
+  }
+}
+
 // Given a new single or batch result (meaning additional pages for a previous
-// query result), merge it into the old result.
+// query result), merge it into the old result.  The items of the pages are
+// collected in the ticket's chunked item store, and are joined by
+// assemblePagedItemsForResult:query:ticket: after the last page.
 - (GTLObject *)mergedNewResultObject:(GTLObject *)newResult
                      oldResultObject:(GTLObject *)oldResult
-                            forQuery:(GTLQuery *)query {
+                            forQuery:(GTLQuery *)query
+                              ticket:(GTLServiceTicket *)ticket {
   if (query.isBatchQuery) {
     // Batch query result
     //
     // The new batch results are a subset of the old result's queries, since
     // not all queries in the batch necessarily have additional pages.
     //
-    // New success objects replace old success objects, with the old items
-    // prepended; new failure objects replace old success objects.
+    // New success objects replace old success objects, with their items
+    // added to the item store; new failure objects replace old success
+    // objects.
     // We will update the old batch results with accumulated items, using the
     // new objects, and return the old batch.
     //
@@ -1816,16 +2752,17 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
     NSMutableDictionary *oldFailures = oldBatchResult.failures;
 
     for (NSString *requestID in newSuccesses) {
-      // Prepend the old items to the new response's items
+      // Keep the new response's items after the old ones
       //
       // We can assume the objects are collections since they're present in
       // additional pages.
       GTLCollectionObject *newObj = newSuccesses[requestID];
       GTLCollectionObject *oldObj = oldSuccesses[requestID];
 
-      NSMutableArray *items = [NSMutableArray arrayWithArray:oldObj.items];
-      [items addObjectsFromArray:newObj.items];
-      [newObj performSelector:@selector(setItems:) withObject:items];
+      [self appendItemsOfPage:newObj
+                 previousPage:oldObj
+                       forKey:requestID
+                       ticket:ticket];
 
       // Replace the old object with the new one
       oldSuccesses[requestID] = newObj;
@@ -1836,21 +2773,23 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
       GTLErrorObject *newError = newFailures[requestID];
       oldFailures[requestID] = newError;
       [oldSuccesses removeObjectForKey:requestID];
+      [ticket.pagedItemChunks removeObjectForKey:requestID];
     }
     return oldBatchResult;
   } else {
     // Single query result
     //
-    // Merge the items into the new object, and return that.
+    // Add the items to the item store, and return the new object.
     //
     // We can assume the objects are collections since they're present in
     // additional pages.
     GTLCollectionObject *newObj = (GTLCollectionObject *)newResult;
     GTLCollectionObject *oldObj = (GTLCollectionObject *)oldResult;
 
-    NSMutableArray *items = [NSMutableArray arrayWithArray:oldObj.items];
-    [items addObjectsFromArray:newObj.items];
-    [newObj performSelector:@selector(setItems:) withObject:items];
+    [self appendItemsOfPage:newObj
+               previousPage:oldObj
+                     forKey:kPagedItemsSingleQueryKey
+                     ticket:ticket];
 
     return newObj;
   }
@@ -1864,14 +2803,26 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
                           delegate:(id)delegate
                  didFinishSelector:(SEL)finishedSelector {
   if (queryObj.batchQuery) {
-   return [self executeBatchQuery:(GTLBatchQuery *)queryObj
-                         delegate:delegate
-                didFinishSelector:finishedSelector
-                completionHandler:NULL
-                           ticket:nil];
+    return [self executeClientBatchQuery:(GTLBatchQuery *)queryObj
+                                delegate:delegate
+                       didFinishSelector:finishedSelector
+                       completionHandler:NULL];
   }
 
   GTLQuery *query = [[(GTLQuery *)queryObj copy] autorelease];
+  if ([self shouldShareQuery:query]) {
+    return [self shareQuery:query
+                   delegate:delegate
+          didFinishSelector:finishedSelector
+          completionHandler:nil];
+  }
+  if ([self shouldCoalesceQuery:query]) {
+    return [self coalesceQuery:query
+                      delegate:delegate
+             didFinishSelector:finishedSelector
+             completionHandler:nil];
+  }
+
   NSString *methodName = query.methodName;
   NSDictionary *params = query.JSON;
   GTLObject *bodyObject = query.bodyObject;
@@ -1892,14 +2843,26 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
 - (GTLServiceTicket *)executeQuery:(id<GTLQueryProtocol>)queryObj
                  completionHandler:(void (^)(GTLServiceTicket *ticket, id object, NSError *error))handler {
   if (queryObj.batchQuery) {
-    return [self executeBatchQuery:(GTLBatchQuery *)queryObj
-                          delegate:nil
-                 didFinishSelector:NULL
-                 completionHandler:handler
-                            ticket:nil];
+    return [self executeClientBatchQuery:(GTLBatchQuery *)queryObj
+                                delegate:nil
+                       didFinishSelector:NULL
+                       completionHandler:handler];
   }
 
   GTLQuery *query = [[(GTLQuery *)queryObj copy] autorelease];
+  if ([self shouldShareQuery:query]) {
+    return [self shareQuery:query
+                   delegate:nil
+          didFinishSelector:NULL
+          completionHandler:handler];
+  }
+  if ([self shouldCoalesceQuery:query]) {
+    return [self coalesceQuery:query
+                      delegate:nil
+             didFinishSelector:NULL
+             completionHandler:handler];
+  }
+
   NSString *methodName = query.methodName;
   NSDictionary *params = query.JSON;
   GTLObject *bodyObject = query.bodyObject;
@@ -1919,6 +2882,727 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
 
 #pragma mark -
 
+// Request coalescing
+
+- (BOOL)shouldCoalesceQuery:(GTLQuery *)query {
+  if (self.coalescingInterval <= 0) return NO;
+
+  // Fetches spanning several pages, or that are simulated, keep their own
+  // tickets
+  if (self.shouldFetchNextPages || self.pageBlock != nil
+      || self.testBlock != nil || query.testBlock != nil) {
+    return NO;
+  }
+
+  // A query's fetcher service client and priority apply only to a fetcher
+  // of its own
+  if (query.fetcherServiceClient != nil || query.fetcherServicePriority != 0) {
+    return NO;
+  }
+
+  // These are disallowed on queries added to a batch
+  return (query.methodName.length > 0
+          && query.uploadParameters == nil
+          && query.additionalHTTPHeaders == nil
+          && query.urlQueryParameters == nil
+          && !query.shouldSkipAuthorization);
+}
+
+- (GTLServiceTicket *)coalesceQuery:(GTLQuery *)query
+                           delegate:(id)delegate
+                  didFinishSelector:(SEL)finishedSelector
+                  completionHandler:(GTLServiceCompletionHandler)completionHandler {
+  if (query.requestID == nil) {
+    query.requestID = [GTLQuery nextRequestID];
+  }
+
+  // Request IDs must be unique within a batch, so send the waiting queries
+  // before holding one that repeats an ID
+  BOOL isRequestIDPending = NO;
+  @synchronized(self) {
+    for (GTLServiceCoalescedQuery *pending in pendingCoalescedQueries_) {
+      GTLQuery *pendingQuery = (GTLQuery *)pending.ticket.originalQuery;
+      if ([pendingQuery.requestID isEqual:query.requestID]) {
+        isRequestIDPending = YES;
+        break;
+      }
+    }
+  }
+  if (isRequestIDPending) {
+    [self executeCoalescedQueries];
+  }
+
+  GTLServiceTicket *ticket = [[[self class] ticketClass] ticketForService:self];
+  ticket.originalQuery = query;
+  ticket.executingQuery = query;
+
+  GTLServiceCoalescedQuery *coalesced =
+    [[[GTLServiceCoalescedQuery alloc] init] autorelease];
+  coalesced.ticket = ticket;
+  coalesced.delegate = delegate;
+  coalesced.finishedSelector = finishedSelector;
+  coalesced.completionHandler = completionHandler;
+
+  NSUInteger numberOfPending;
+  @synchronized(self) {
+    if (pendingCoalescedQueries_ == nil) {
+      pendingCoalescedQueries_ = [[NSMutableArray alloc] init];
+    }
+    [pendingCoalescedQueries_ addObject:coalesced];
+    numberOfPending = pendingCoalescedQueries_.count;
+    if (numberOfPending == 1) {
+      [self startCoalescingTimer];
+    }
+  }
+  if (numberOfPending >= kMaxNumberOfCoalescedQueries) {
+    [self executeCoalescedQueries];
+  }
+  return ticket;
+}
+
+// Starts the timer ending the coalescing interval.  A dispatch timer can be
+// canceled from any thread, unlike a delayed perform; when it fires, the
+// queries are sent on this thread.  Must be called within @synchronized(self)
+- (void)startCoalescingTimer {
+  NSThread *thread = [NSThread currentThread];
+  NSArray *runLoopModes = self.runLoopModes;
+  if (runLoopModes.count == 0) {
+    runLoopModes = @[ NSRunLoopCommonModes ];
+  }
+
+  dispatch_source_t timer =
+    dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0,
+                           dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0));
+  int64_t interval = (int64_t)(self.coalescingInterval * NSEC_PER_SEC);
+  dispatch_source_set_timer(timer, dispatch_time(DISPATCH_TIME_NOW, interval),
+                            DISPATCH_TIME_FOREVER, (uint64_t)(interval / 10));
+  // The handler retains the service until the timer is canceled
+  dispatch_source_set_event_handler(timer, ^{
+    [self performSelector:@selector(executeCoalescedQueries)
+                 onThread:thread
+               withObject:nil
+            waitUntilDone:NO
+                    modes:runLoopModes];
+  });
+  coalescingTimer_ = timer;
+  dispatch_resume(timer);
+}
+
+// Must be called within @synchronized(self)
+- (void)cancelCoalescingTimer {
+  if (coalescingTimer_ == NULL) return;
+
+  dispatch_source_cancel(coalescingTimer_);
+  dispatch_release(coalescingTimer_);
+  coalescingTimer_ = NULL;
+}
+
+- (void)executeCoalescedQueries {
+  NSArray *coalescedQueries;
+  @synchronized(self) {
+    [self cancelCoalescingTimer];
+    coalescedQueries = [pendingCoalescedQueries_ autorelease];
+    pendingCoalescedQueries_ = nil;
+  }
+
+  // The queries sent are copies whose completion blocks pass each result to
+  // the ticket returned for the query; the query's own completion block is
+  // invoked from there along with the ticket's other callbacks
+  NSMutableArray *queries = [NSMutableArray arrayWithCapacity:coalescedQueries.count];
+  for (GTLServiceCoalescedQuery *coalesced in coalescedQueries) {
+    GTLServiceTicket *ticket = coalesced.ticket;
+    if (ticket.service == nil) continue;  // canceled
+
+    GTLQuery *query = [[(GTLQuery *)ticket.originalQuery copy] autorelease];
+    query.completionBlock = ^(GTLServiceTicket *fetchTicket, id object, NSError *error) {
+      [self finishCoalescedQuery:coalesced
+                          object:object
+                           error:error];
+    };
+    [queries addObject:query];
+  }
+  if (queries.count == 0) return;
+
+  GTLServiceTicket *fetchTicket;
+  if (queries.count == 1) {
+    GTLQuery *query = queries[0];
+    fetchTicket = [self fetchObjectWithMethodNamed:query.methodName
+                                       objectClass:query.expectedObjectClass
+                                        parameters:query.JSON
+                                        bodyObject:query.bodyObject
+                                         requestID:query.requestID
+                                urlQueryParameters:nil
+                                          delegate:nil
+                                 didFinishSelector:NULL
+                                 completionHandler:nil
+                                    executingQuery:query
+                                            ticket:nil];
+  } else {
+    GTLBatchQuery *batch = [GTLBatchQuery batchQueryWithQueries:queries];
+    fetchTicket = [self executeClientBatchQuery:batch
+                                       delegate:nil
+                              didFinishSelector:NULL
+                              completionHandler:nil];
+  }
+
+  if (fetchTicket == nil) {
+    NSError *error = [NSError errorWithDomain:kGTLServiceErrorDomain
+                                         code:kGTLErrorQueryNotExecuted
+                                     userInfo:nil];
+    for (GTLServiceCoalescedQuery *coalesced in coalescedQueries) {
+      [self finishCoalescedQuery:coalesced
+                          object:nil
+                           error:error];
+    }
+  }
+}
+
+- (void)stopCoalescingQueryForTicket:(GTLServiceTicket *)ticket {
+  @synchronized(self) {
+    if (pendingCoalescedQueries_.count == 0) return;
+
+    NSUInteger idx = [pendingCoalescedQueries_ indexOfObjectPassingTest:^BOOL(GTLServiceCoalescedQuery *pending,
+                                                                             NSUInteger pendingIdx,
+                                                                             BOOL *stop) {
+      return (pending.ticket == ticket);
+    }];
+    if (idx == NSNotFound) return;
+
+    [pendingCoalescedQueries_ removeObjectAtIndex:idx];
+    if (pendingCoalescedQueries_.count == 0) {
+      // Nothing is left to send when the interval ends
+      [self cancelCoalescingTimer];
+    }
+  }
+}
+
+- (void)finishCoalescedQuery:(GTLServiceCoalescedQuery *)coalesced
+                      object:(GTLObject *)object
+                       error:(NSError *)error {
+  GTLServiceTicket *ticket = coalesced.ticket;
+
+  // A canceled ticket has released its service
+  if (ticket.service == nil || ticket.hasCalledCallback) return;
+
+  ticket.fetchedObject = object;
+  ticket.fetchError = error;
+
+  [self invokeCallbacksForTicket:ticket
+                          object:object
+                           error:error
+                        delegate:coalesced.delegate
+             didFinishedSelector:coalesced.finishedSelector
+               completionHandler:coalesced.completionHandler];
+
+  ticket.retryBlock = nil;
+  ticket.uploadProgressBlock = nil;
+}
+
+#pragma mark -
+
+// Sharing identical queries
+
+static NSArray *SharedFetchKeyForQuery(GTLQuery *query) {
+  NSDictionary *params = query.JSON;
+  Class objectClass = query.expectedObjectClass;
+  return @[ query.methodName,
+            (params ? [[params copy] autorelease] : @{}),
+            (objectClass ? NSStringFromClass(objectClass) : @"") ];
+}
+
+- (BOOL)shouldShareQuery:(GTLQuery *)query {
+  // JSON-RPC queries are all posts, so only the client can say that a query
+  // is free of side effects
+  if (!self.shouldShareIdenticalQueries || !query.canShareFetch) return NO;
+
+  if (self.shouldFetchNextPages || self.pageBlock != nil
+      || self.testBlock != nil || query.testBlock != nil) {
+    return NO;
+  }
+
+  if (query.methodName.length == 0
+      || query.bodyObject != nil
+      || query.uploadParameters != nil
+      || query.additionalHTTPHeaders != nil
+      || query.urlQueryParameters != nil
+      || query.shouldSkipAuthorization
+      || query.fetcherServiceClient != nil
+      || query.fetcherServicePriority != 0) {
+    return NO;
+  }
+  return YES;
+}
+
+- (GTLServiceTicket *)shareQuery:(GTLQuery *)query
+                        delegate:(id)delegate
+               didFinishSelector:(SEL)finishedSelector
+               completionHandler:(GTLServiceCompletionHandler)completionHandler {
+  GTLServiceTicket *ticket = [[[self class] ticketClass] ticketForService:self];
+  ticket.originalQuery = query;
+  ticket.executingQuery = query;
+
+  GTLServiceCoalescedQuery *waiter =
+    [[[GTLServiceCoalescedQuery alloc] init] autorelease];
+  waiter.ticket = ticket;
+  waiter.delegate = delegate;
+  waiter.finishedSelector = finishedSelector;
+  waiter.completionHandler = completionHandler;
+
+  NSArray *key = SharedFetchKeyForQuery(query);
+  GTLServiceSharedFetch *shared;
+  @synchronized(self) {
+    shared = [sharedFetches_ objectForKey:key];
+    BOOL isInFlight = (shared != nil);
+    if (!isInFlight) {
+      shared = [[[GTLServiceSharedFetch alloc] init] autorelease];
+      shared.key = key;
+
+      if (sharedFetches_ == nil) {
+        sharedFetches_ = [[NSMutableDictionary alloc] init];
+      }
+      [sharedFetches_ setObject:shared forKey:key];
+    }
+    [shared.waiters addObject:waiter];
+
+    // Tickets are compared by identity, so canceling one finds its fetch
+    // directly
+    if (sharedFetchTickets_ == nil) {
+      NSPointerFunctionsOptions keyOptions =
+        NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality;
+      sharedFetchTickets_ =
+        [[NSMapTable alloc] initWithKeyOptions:keyOptions
+                                  valueOptions:NSPointerFunctionsStrongMemory
+                                      capacity:0];
+    }
+    [sharedFetchTickets_ setObject:shared forKey:ticket];
+
+    if (isInFlight) return ticket;
+  }
+
+  // The query fetched is a copy whose completion block passes the result to
+  // every ticket waiting for it
+  GTLQuery *fetchQuery = [[query copy] autorelease];
+  fetchQuery.completionBlock = ^(GTLServiceTicket *fetchTicket, id object, NSError *error) {
+    [self finishSharedFetch:shared
+                     object:object
+                      error:error];
+  };
+
+  GTLServiceTicket *fetchTicket =
+    [self fetchObjectWithMethodNamed:fetchQuery.methodName
+                         objectClass:fetchQuery.expectedObjectClass
+                          parameters:fetchQuery.JSON
+                          bodyObject:nil
+                           requestID:fetchQuery.requestID
+                  urlQueryParameters:nil
+                            delegate:nil
+                   didFinishSelector:NULL
+                   completionHandler:nil
+                      executingQuery:fetchQuery
+                              ticket:nil];
+  if (fetchTicket == nil) {
+    @synchronized(self) {
+      [sharedFetches_ removeObjectForKey:key];
+      for (GTLServiceCoalescedQuery *sharedWaiter in shared.waiters) {
+        [sharedFetchTickets_ removeObjectForKey:sharedWaiter.ticket];
+      }
+    }
+    return nil;
+  }
+  shared.fetchTicket = fetchTicket;
+  return ticket;
+}
+
+- (void)finishSharedFetch:(GTLServiceSharedFetch *)shared
+                   object:(GTLObject *)object
+                    error:(NSError *)error {
+  NSArray *waiters;
+  @synchronized(self) {
+    if ([sharedFetches_ objectForKey:shared.key] == shared) {
+      [sharedFetches_ removeObjectForKey:shared.key];
+    }
+    waiters = [[shared.waiters copy] autorelease];
+    [shared.waiters removeAllObjects];
+    for (GTLServiceCoalescedQuery *waiter in waiters) {
+      [sharedFetchTickets_ removeObjectForKey:waiter.ticket];
+    }
+
+    // The fetch ticket is invoking this callback, so keep it alive until the
+    // callback returns
+    [[shared.fetchTicket retain] autorelease];
+    shared.fetchTicket = nil;
+  }
+
+  // The first ticket still waiting gets the fetched object, and the others
+  // get copies of it
+  BOOL isFirstWaiter = YES;
+  for (GTLServiceCoalescedQuery *waiter in waiters) {
+    if (waiter.ticket.service == nil) continue;  // canceled
+
+    GTLObject *waiterObject = object;
+    if (!isFirstWaiter && [object isKindOfClass:[GTLObject class]]) {
+      waiterObject = [[object copy] autorelease];
+    }
+    isFirstWaiter = NO;
+
+    [self finishCoalescedQuery:waiter
+                        object:waiterObject
+                         error:error];
+  }
+}
+
+- (void)stopSharingFetchForTicket:(GTLServiceTicket *)ticket {
+  GTLServiceTicket *fetchTicketToCancel = nil;
+  @synchronized(self) {
+    GTLServiceSharedFetch *shared = [sharedFetchTickets_ objectForKey:ticket];
+    if (shared == nil) return;
+
+    [sharedFetchTickets_ removeObjectForKey:ticket];
+
+    NSMutableArray *waiters = shared.waiters;
+    NSUInteger idx = [waiters indexOfObjectPassingTest:^BOOL(GTLServiceCoalescedQuery *waiter,
+                                                             NSUInteger waiterIdx,
+                                                             BOOL *stop) {
+      return (waiter.ticket == ticket);
+    }];
+    if (idx != NSNotFound) {
+      [waiters removeObjectAtIndex:idx];
+    }
+    if (waiters.count == 0) {
+      // The last ticket waiting has left, so nothing needs the fetch
+      [sharedFetches_ removeObjectForKey:shared.key];
+      fetchTicketToCancel = [[shared.fetchTicket retain] autorelease];
+      shared.fetchTicket = nil;
+    }
+  }
+  [fetchTicketToCancel cancelTicket];
+}
+
+#pragma mark -
+
+// Batch sharding
+
+- (GTLServiceTicket *)executeClientBatchQuery:(GTLBatchQuery *)batch
+                                     delegate:(id)delegate
+                            didFinishSelector:(SEL)finishedSelector
+                            completionHandler:(GTLServiceCompletionHandler)completionHandler {
+  NSUInteger maxQueriesPerBatch = self.maxQueriesPerBatch;
+  BOOL shouldShard = (maxQueriesPerBatch > 0
+                      && batch.queries.count > maxQueriesPerBatch
+                      && self.pageBlock == nil
+                      && self.testBlock == nil
+                      && batch.testBlock == nil);
+  if (shouldShard) {
+    return [self executeShardedBatchQuery:batch
+                                 delegate:delegate
+                        didFinishSelector:finishedSelector
+                        completionHandler:completionHandler];
+  }
+  return [self executeBatchQuery:batch
+                        delegate:delegate
+               didFinishSelector:finishedSelector
+               completionHandler:completionHandler
+                          ticket:nil];
+}
+
+- (GTLServiceTicket *)executeShardedBatchQuery:(GTLBatchQuery *)batch
+                                      delegate:(id)delegate
+                             didFinishSelector:(SEL)finishedSelector
+                             completionHandler:(GTLServiceCompletionHandler)completionHandler {
+  // The shards hold copies of the queries without their completion blocks;
+  // the blocks are invoked with the merged result, like those of an unsplit
+  // batch.
+  NSArray *queries = batch.queries;
+  NSUInteger numberOfQueries = queries.count;
+  NSMutableArray *shardQueries = [NSMutableArray arrayWithCapacity:numberOfQueries];
+  NSMutableSet *requestIDs = [NSMutableSet setWithCapacity:numberOfQueries];
+  for (GTLQuery *query in queries) {
+    NSString *requestID = query.requestID;
+    if (query.methodName.length == 0 || requestID.length == 0) {
+      GTL_DEBUG_ASSERT(0, @"Invalid query - id:%@ method:%@",
+                       requestID, query.methodName);
+      return nil;
+    }
+    if ([requestIDs containsObject:requestID]) {
+      GTL_DEBUG_LOG(@"Duplicate request id in batch: %@", requestID);
+      return nil;
+    }
+    [requestIDs addObject:requestID];
+
+    GTLQuery *shardQuery = [[query copy] autorelease];
+    shardQuery.completionBlock = nil;
+    [shardQueries addObject:shardQuery];
+  }
+
+  GTLServiceTicket *ticket = [[[self class] ticketClass] ticketForService:self];
+  ticket.originalQuery = batch;
+  ticket.executingQuery = batch;
+
+  GTLBatchResult *result = [GTLBatchResult object];
+  result.successes = [NSMutableDictionary dictionary];
+  result.failures = [NSMutableDictionary dictionary];
+
+  NSUInteger shardSize = self.maxQueriesPerBatch;
+  NSUInteger numberOfShards = (numberOfQueries + shardSize - 1) / shardSize;
+
+  GTLServiceShardedBatch *sharded =
+    [[[GTLServiceShardedBatch alloc] init] autorelease];
+  sharded.ticket = ticket;
+  sharded.delegate = delegate;
+  sharded.finishedSelector = finishedSelector;
+  sharded.completionHandler = completionHandler;
+  sharded.result = result;
+  sharded.numberOfShards = numberOfShards;
+  sharded.numberOfPendingShards = numberOfShards;
+
+  for (NSUInteger idx = 0; idx < numberOfQueries; idx += shardSize) {
+    NSRange range = NSMakeRange(idx, MIN(shardSize, numberOfQueries - idx));
+    GTLBatchQuery *shard =
+      [GTLBatchQuery batchQueryWithQueries:[shardQueries subarrayWithRange:range]];
+    shard.shouldSkipAuthorization = batch.shouldSkipAuthorization;
+    shard.additionalHTTPHeaders = batch.additionalHTTPHeaders;
+    shard.urlQueryParameters = batch.urlQueryParameters;
+    shard.fetcherServiceClient = batch.fetcherServiceClient;
+    shard.fetcherServicePriority = batch.fetcherServicePriority;
+
+    [self executeShard:shard
+        ofShardedBatch:sharded
+       numberOfRetries:0];
+  }
+  return ticket;
+}
+
++ (BOOL)isRetryableShardError:(NSError *)error {
+  // Network failures and server errors may succeed on another try; errors
+  // due to the request itself will not.
+  if ([error.domain isEqual:NSURLErrorDomain]) return YES;
+
+  NSInteger status = error.code;
+  return (status == 408 || status >= 500)
+    && ([error.domain isEqual:kGTMBridgeFetcherStatusDomain]
+        || [error.domain isEqual:kGTLJSONRPCErrorDomain]);
+}
+
++ (BOOL)isRetryableShardFailure:(GTLErrorObject *)errorObj {
+  // A query in a batch that succeeded may still fail on its own because the
+  // server was overloaded or the client was briefly over its rate limit.
+  NSInteger code = errorObj.code.integerValue;
+  if (code == 408 || code == 429 || code >= 500) return YES;
+
+  if (code == 403) {
+    for (GTLErrorObjectData *errorData in errorObj.data) {
+      NSString *reason = errorData.reason;
+      if ([reason isEqual:@"rateLimitExceeded"]
+          || [reason isEqual:@"userRateLimitExceeded"]) {
+        return YES;
+      }
+    }
+  }
+  return NO;
+}
+
+- (void)executeShard:(GTLBatchQuery *)shard
+      ofShardedBatch:(GTLServiceShardedBatch *)sharded
+     numberOfRetries:(NSUInteger)numberOfRetries {
+  GTLServiceCompletionHandler shardHandler =
+    ^(GTLServiceTicket *shardTicket, id object, NSError *error) {
+      [sharded.ticket removeShardTicket:shardTicket];
+
+      BOOL mayRetry = (numberOfRetries < kMaxNumberOfShardRetries
+                       && sharded.ticket.service != nil);
+      if (mayRetry && error != nil
+          && [[self class] isRetryableShardError:error]) {
+        GTL_DEBUG_LOG(@"GTLService: retrying batch shard after error %@", error);
+        [self retryShard:shard
+          ofShardedBatch:sharded
+         numberOfRetries:numberOfRetries + 1];
+        return;
+      }
+
+      GTLBatchResult *result = object;
+      GTLBatchQuery *retryShard = nil;
+      if (mayRetry && error == nil) {
+        retryShard = [self shardOfRetryableFailuresInResult:result
+                                                    ofShard:shard];
+      }
+      if (retryShard != nil) {
+        // The failed queries are sent again as a shard of their own, and this
+        // shard finishes with the results of the others.
+        GTL_DEBUG_LOG(@"GTLService: retrying %lu failed queries of batch shard",
+                      (unsigned long)retryShard.queries.count);
+        sharded.numberOfShards += 1;
+        sharded.numberOfPendingShards += 1;
+        [self retryShard:retryShard
+          ofShardedBatch:sharded
+         numberOfRetries:numberOfRetries + 1];
+
+        NSMutableDictionary *keptFailures =
+          [[result.failures mutableCopy] autorelease];
+        for (GTLQuery *query in retryShard.queries) {
+          [keptFailures removeObjectForKey:query.requestID];
+        }
+        GTLBatchResult *keptResult = [GTLBatchResult object];
+        keptResult.successes = result.successes;
+        keptResult.failures = keptFailures;
+        result = keptResult;
+      }
+
+      [self finishShard:shard
+         ofShardedBatch:sharded
+                 result:result
+                  error:error];
+    };
+
+  GTLServiceTicket *shardTicket = [self executeBatchQuery:shard
+                                                 delegate:nil
+                                        didFinishSelector:NULL
+                                        completionHandler:shardHandler
+                                                   ticket:nil];
+  if (shardTicket != nil && !shardTicket.hasCalledCallback) {
+    [sharded.ticket addShardTicket:shardTicket];
+  }
+  if (shardTicket == nil) {
+    NSError *error = [NSError errorWithDomain:kGTLServiceErrorDomain
+                                         code:kGTLErrorQueryNotExecuted
+                                     userInfo:nil];
+    [self finishShard:shard
+       ofShardedBatch:sharded
+               result:nil
+                error:error];
+  }
+}
+
+- (void)retryShard:(GTLBatchQuery *)shard
+    ofShardedBatch:(GTLServiceShardedBatch *)sharded
+   numberOfRetries:(NSUInteger)numberOfRetries {
+  NSTimeInterval delay =
+    kInitialShardRetryInterval * (double)(1 << (numberOfRetries - 1));
+
+  NSDictionary *retryInfo = @{ kShardRetryShardKey : shard,
+                               kShardRetryShardedBatchKey : sharded,
+                               kShardRetryNumberOfRetriesKey : @(numberOfRetries) };
+
+  NSArray *runLoopModes = self.runLoopModes;
+  if (runLoopModes.count == 0) {
+    runLoopModes = @[ NSRunLoopCommonModes ];
+  }
+  [self performSelector:@selector(executeShardWithRetryInfo:)
+             withObject:retryInfo
+             afterDelay:delay
+                inModes:runLoopModes];
+}
+
+- (void)executeShardWithRetryInfo:(NSDictionary *)retryInfo {
+  GTLBatchQuery *shard = retryInfo[kShardRetryShardKey];
+  GTLServiceShardedBatch *sharded = retryInfo[kShardRetryShardedBatchKey];
+  NSUInteger numberOfRetries =
+    [retryInfo[kShardRetryNumberOfRetriesKey] unsignedIntegerValue];
+
+  if (sharded.ticket.service == nil) {
+    // The batch was canceled while waiting to retry
+    NSError *error = [NSError errorWithDomain:kGTLServiceErrorDomain
+                                         code:kGTLErrorQueryNotExecuted
+                                     userInfo:nil];
+    [self finishShard:shard
+       ofShardedBatch:sharded
+               result:nil
+                error:error];
+    return;
+  }
+
+  [self executeShard:shard
+      ofShardedBatch:sharded
+     numberOfRetries:numberOfRetries];
+}
+
+// Returns a shard of the queries that failed in the shard's result for a
+// reason that may pass, or nil if there are none.
+- (GTLBatchQuery *)shardOfRetryableFailuresInResult:(GTLBatchResult *)result
+                                            ofShard:(GTLBatchQuery *)shard {
+  NSDictionary *failures = result.failures;
+  if (failures.count == 0) return nil;
+
+  NSMutableArray *queries = nil;
+  for (GTLQuery *query in shard.queries) {
+    GTLErrorObject *errorObj = failures[query.requestID];
+    if (errorObj != nil && [[self class] isRetryableShardFailure:errorObj]) {
+      if (queries == nil) {
+        queries = [NSMutableArray array];
+      }
+      [queries addObject:query];
+    }
+  }
+  if (queries == nil) return nil;
+
+  GTLBatchQuery *retryShard = [GTLBatchQuery batchQueryWithQueries:queries];
+  retryShard.shouldSkipAuthorization = shard.shouldSkipAuthorization;
+  retryShard.additionalHTTPHeaders = shard.additionalHTTPHeaders;
+  retryShard.urlQueryParameters = shard.urlQueryParameters;
+  retryShard.fetcherServiceClient = shard.fetcherServiceClient;
+  retryShard.fetcherServicePriority = shard.fetcherServicePriority;
+  return retryShard;
+}
+
+- (void)finishShard:(GTLBatchQuery *)shard
+     ofShardedBatch:(GTLServiceShardedBatch *)sharded
+             result:(GTLBatchResult *)result
+              error:(NSError *)error {
+  GTLBatchResult *mergedResult = sharded.result;
+  if (error == nil) {
+    [mergedResult.successes addEntriesFromDictionary:result.successes];
+    [mergedResult.failures addEntriesFromDictionary:result.failures];
+  } else {
+    // Each query of a shard that could not be fetched fails with the shard's
+    // error; the error's domain is kept in the error data, since the code
+    // alone could be a status or an NSURLError code.
+    sharded.lastError = error;
+    sharded.numberOfFailedShards += 1;
+
+    for (GTLQuery *query in shard.queries) {
+      GTLErrorObjectData *errorData = [GTLErrorObjectData object];
+      errorData.domain = error.domain;
+      errorData.message = error.localizedDescription;
+
+      GTLErrorObject *errorObj = [GTLErrorObject object];
+      errorObj.code = @(error.code);
+      errorObj.message = error.localizedDescription;
+      errorObj.data = @[ errorData ];
+      mergedResult.failures[query.requestID] = errorObj;
+    }
+  }
+
+  sharded.numberOfPendingShards -= 1;
+  if (sharded.numberOfPendingShards > 0) return;
+
+  GTLServiceTicket *ticket = sharded.ticket;
+
+  // A canceled ticket has released its service
+  if (ticket.service == nil || ticket.hasCalledCallback) return;
+
+  // If no shard succeeded, report the error as an unsplit batch would
+  GTLBatchResult *object = mergedResult;
+  NSError *batchError = nil;
+  if (sharded.numberOfFailedShards == sharded.numberOfShards) {
+    object = nil;
+    batchError = sharded.lastError;
+  }
+
+  ticket.fetchedObject = object;
+  ticket.fetchError = batchError;
+
+  [self invokeCallbacksForTicket:ticket
+                          object:object
+                           error:batchError
+                        delegate:sharded.delegate
+             didFinishedSelector:sharded.finishedSelector
+               completionHandler:sharded.completionHandler];
+
+  ticket.retryBlock = nil;
+  ticket.uploadProgressBlock = nil;
+}
+
+#pragma mark -
+
 - (GTLServiceTicket *)fetchObjectWithMethodNamed:(NSString *)methodName
                                       parameters:(NSDictionary *)parameters
                                      objectClass:(Class)objectClass
@@ -2280,6 +3964,18 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
 #endif
 }
 
+- (void)setParseQueue:(NSOperationQueue *)queue {
+  if (queue == parseQueue_) return;
+
+  [parseQueue_ autorelease];
+  parseQueue_ = [queue retain];
+
+  // A queue set by the client parses every response; only the priority of
+  // the parse still depends on the response size.
+  [smallResponseParseQueue_ autorelease];
+  smallResponseParseQueue_ = nil;
+}
+
 #pragma mark -
 
 // The service properties becomes the initial value for each future ticket's
@@ -2436,8 +4132,17 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
             originalQuery = originalQuery_,
             fetchError = fetchError_,
             pagesFetchedCounter = pagesFetchedCounter_,
+            maxNumberOfNextPagesFetched = maxNumberOfNextPagesFetched_,
+            pagedItemChunks = pagedItemChunks_,
+            pageBlock = pageBlock_,
             APIKey = apiKey_,
             parseOperation = parseOperation_,
+            parsePriority = parsePriority_,
+            parseQueueWaitTime = parseQueueWaitTime_,
+            parseTime = parseTime_,
+            rateLimitDelay = rateLimitDelay_,
+            fetcherServiceClient = fetcherServiceClient_,
+            fetcherServicePriority = fetcherServicePriority_,
             isREST = isREST_,
             retryBlock = retryBlock_;
 
@@ -2457,9 +4162,13 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
     retrySelector_ = service.retrySelector;
     maxRetryInterval_ = service.maxRetryInterval;
     shouldFetchNextPages_ = service.shouldFetchNextPages;
+    maxNumberOfNextPagesFetched_ = service.maxNumberOfNextPagesFetched;
     apiKey_ = [service.APIKey copy];
     uploadProgressBlock_ = [service.uploadProgressBlock copy];
     retryBlock_ = [service.retryBlock copy];
+    pageBlock_ = [service.pageBlock copy];
+    fetcherServiceClient_ = [service.fetcherServiceClient copy];
+    fetcherServicePriority_ = service.fetcherServicePriority;
   }
   return self;
 }
@@ -2483,6 +4192,10 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
   [fetchError_ release];
   [apiKey_ release];
   [parseOperation_ release];
+  [pagedItemChunks_ release];
+  [shardTickets_ release];
+  [pageBlock_ release];
+  [fetcherServiceClient_ release];
 
   [super dealloc];
 }
@@ -2532,6 +4245,9 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
 }
 
 - (void)cancelTicket {
+  [service_ stopCoalescingQueryForTicket:self];
+  [service_ stopSharingFetchForTicket:self];
+
   NSOperation *parseOperation = self.parseOperation;
   [parseOperation cancel];
   self.parseOperation = nil;
@@ -2545,18 +4261,47 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
 
   self.uploadProgressBlock = nil;
   self.retryBlock = nil;
+  self.pageBlock = nil;
 
   [self.executingQuery executionDidStop];
   self.executingQuery = self.originalQuery;
 
-  [service_ autorelease];
-  service_ = nil;
+  // A split batch's shards are canceled with it
+  NSArray *shardTickets;
+  @synchronized(self) {
+    [service_ autorelease];
+    service_ = nil;
+
+    shardTickets = [shardTickets_ autorelease];
+    shardTickets_ = nil;
+  }
+  [shardTickets makeObjectsPerformSelector:@selector(cancelTicket)];
 }
 
 - (id)service {
   return service_;
 }
 
+- (void)addShardTicket:(GTLServiceTicket *)shardTicket {
+  @synchronized(self) {
+    if (service_ == nil) {
+      // Canceled while the shard was being executed
+      [shardTicket cancelTicket];
+      return;
+    }
+    if (shardTickets_ == nil) {
+      shardTickets_ = [[NSMutableArray alloc] init];
+    }
+    [shardTickets_ addObject:shardTicket];
+  }
+}
+
+- (void)removeShardTicket:(GTLServiceTicket *)shardTicket {
+  @synchronized(self) {
+    [shardTickets_ removeObjectIdenticalTo:shardTicket];
+  }
+}
+
 - (void)setObjectFetcher:(GTMBridgeFetcher *)fetcher {
   [objectFetcher_ autorelease];
   objectFetcher_ = [fetcher retain];
@@ -2691,3 +4436,74 @@ totalBytesExpectedToSend:(NSInteger)totalBytesExpected {
 }
 
 @end
+
+@implementation GTLServiceRateLimiter
+
++ (instancetype)rateLimiter {
+  return [[[self alloc] init] autorelease];
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    methodBuckets_ = [[NSMutableDictionary alloc] init];
+    hostBuckets_ = [[NSMutableDictionary alloc] init];
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [methodBuckets_ release];
+  [hostBuckets_ release];
+  [super dealloc];
+}
+
+static void SetTokenBucket(NSMutableDictionary *buckets, NSString *key,
+                           double rate, NSUInteger burst) {
+  if (rate <= 0) {
+    [buckets removeObjectForKey:key];
+    return;
+  }
+  GTLServiceTokenBucket *bucket =
+    [[[GTLServiceTokenBucket alloc] initWithRate:rate
+                                           burst:MAX(burst, (NSUInteger)1)] autorelease];
+  [buckets setObject:bucket forKey:key];
+}
+
+- (void)setRate:(double)queriesPerSecond
+          burst:(NSUInteger)burst
+  forMethodName:(NSString *)methodName {
+  @synchronized(self) {
+    SetTokenBucket(methodBuckets_, methodName, queriesPerSecond, burst);
+  }
+}
+
+- (void)setRate:(double)queriesPerSecond
+          burst:(NSUInteger)burst
+        forHost:(NSString *)host {
+  @synchronized(self) {
+    SetTokenBucket(hostBuckets_, host, queriesPerSecond, burst);
+  }
+}
+
+- (NSTimeInterval)takeTokenForMethodName:(NSString *)methodName
+                                    host:(NSString *)host {
+  @synchronized(self) {
+    NSTimeInterval delay = 0;
+    if (methodName) {
+      GTLServiceTokenBucket *bucket = [methodBuckets_ objectForKey:methodName];
+      if (bucket) {
+        delay = [bucket takeToken];
+      }
+    }
+    if (host) {
+      GTLServiceTokenBucket *bucket = [hostBuckets_ objectForKey:host];
+      if (bucket) {
+        delay = MAX(delay, [bucket takeToken]);
+      }
+    }
+    return delay;
+  }
+}
+
+@end
@@ -56,6 +56,48 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryAdExchangeBuyer class],
+    [GTLAdExchangeBuyerAccount class],
+    [GTLAdExchangeBuyerAccountBidderLocationItem class],
+    [GTLAdExchangeBuyerAccountsList class],
+    [GTLAdExchangeBuyerBillingInfo class],
+    [GTLAdExchangeBuyerBillingInfoList class],
+    [GTLAdExchangeBuyerBudget class],
+    [GTLAdExchangeBuyerCreative class],
+    [GTLAdExchangeBuyerCreativeCorrectionsItem class],
+    [GTLAdExchangeBuyerCreativeFilteringReasons class],
+    [GTLAdExchangeBuyerCreativeServingRestrictionsItem class],
+    [GTLAdExchangeBuyerCreativeFilteringReasonsReasonsItem class],
+    [GTLAdExchangeBuyerCreativeServingRestrictionsItemContextsItem class],
+    [GTLAdExchangeBuyerCreativeServingRestrictionsItemDisapprovalReasonsItem class],
+    [GTLAdExchangeBuyerCreativesList class],
+    [GTLAdExchangeBuyerPerformanceReport class],
+    [GTLAdExchangeBuyerPerformanceReportList class],
+    [GTLAdExchangeBuyerPretargetingConfig class],
+    [GTLAdExchangeBuyerPretargetingConfigDimensionsItem class],
+    [GTLAdExchangeBuyerPretargetingConfigExcludedPlacementsItem class],
+    [GTLAdExchangeBuyerPretargetingConfigPlacementsItem class],
+    [GTLAdExchangeBuyerPretargetingConfigList class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLAdExchangeBuyerDealsStatusFilterApproved,
+    kGTLAdExchangeBuyerDealsStatusFilterConditionallyApproved,
+    kGTLAdExchangeBuyerDealsStatusFilterDisapproved,
+    kGTLAdExchangeBuyerDealsStatusFilterNotChecked,
+    kGTLAdExchangeBuyerOpenAuctionStatusFilterApproved,
+    kGTLAdExchangeBuyerOpenAuctionStatusFilterConditionallyApproved,
+    kGTLAdExchangeBuyerOpenAuctionStatusFilterDisapproved,
+    kGTLAdExchangeBuyerOpenAuctionStatusFilterNotChecked
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
@@ -61,6 +61,32 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryAdExchangeSeller class],
+    [GTLAdExchangeSellerAccount class],
+    [GTLAdExchangeSellerAccounts class],
+    [GTLAdExchangeSellerAdClient class],
+    [GTLAdExchangeSellerAdClients class],
+    [GTLAdExchangeSellerAlert class],
+    [GTLAdExchangeSellerAlerts class],
+    [GTLAdExchangeSellerCustomChannel class],
+    [GTLAdExchangeSellerCustomChannelTargetingInfo class],
+    [GTLAdExchangeSellerCustomChannels class],
+    [GTLAdExchangeSellerMetadata class],
+    [GTLAdExchangeSellerPreferredDeal class],
+    [GTLAdExchangeSellerPreferredDeals class],
+    [GTLAdExchangeSellerReport class],
+    [GTLAdExchangeSellerReportHeadersItem class],
+    [GTLAdExchangeSellerReportingMetadataEntry class],
+    [GTLAdExchangeSellerSavedReport class],
+    [GTLAdExchangeSellerSavedReports class],
+    [GTLAdExchangeSellerUrlChannel class],
+    [GTLAdExchangeSellerUrlChannels class]
+  ];
+  return classes;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
@@ -67,6 +67,44 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryAdSense class],
+    [GTLAdSenseAccount class],
+    [GTLAdSenseAccounts class],
+    [GTLAdSenseAdClient class],
+    [GTLAdSenseAdClients class],
+    [GTLAdSenseAdCode class],
+    [GTLAdSenseAdsenseReportsGenerateResponse class],
+    [GTLAdSenseAdsenseReportsGenerateResponseHeadersItem class],
+    [GTLAdSenseAdStyle class],
+    [GTLAdSenseAdStyleColors class],
+    [GTLAdSenseAdStyleFont class],
+    [GTLAdSenseAdUnit class],
+    [GTLAdSenseAdUnitContentAdsSettings class],
+    [GTLAdSenseAdUnitFeedAdsSettings class],
+    [GTLAdSenseAdUnitMobileContentAdsSettings class],
+    [GTLAdSenseAdUnitContentAdsSettingsBackupOption class],
+    [GTLAdSenseAdUnits class],
+    [GTLAdSenseAlert class],
+    [GTLAdSenseAlerts class],
+    [GTLAdSenseCustomChannel class],
+    [GTLAdSenseCustomChannelTargetingInfo class],
+    [GTLAdSenseCustomChannels class],
+    [GTLAdSenseMetadata class],
+    [GTLAdSensePayment class],
+    [GTLAdSensePayments class],
+    [GTLAdSenseReportingMetadataEntry class],
+    [GTLAdSenseSavedAdStyle class],
+    [GTLAdSenseSavedAdStyles class],
+    [GTLAdSenseSavedReport class],
+    [GTLAdSenseSavedReports class],
+    [GTLAdSenseUrlChannel class],
+    [GTLAdSenseUrlChannels class]
+  ];
+  return classes;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
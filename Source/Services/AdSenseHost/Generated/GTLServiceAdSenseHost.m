@@ -58,6 +58,44 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryAdSenseHost class],
+    [GTLAdSenseHostAccount class],
+    [GTLAdSenseHostAccounts class],
+    [GTLAdSenseHostAdClient class],
+    [GTLAdSenseHostAdClients class],
+    [GTLAdSenseHostAdCode class],
+    [GTLAdSenseHostAdStyle class],
+    [GTLAdSenseHostAdStyleColors class],
+    [GTLAdSenseHostAdStyleFont class],
+    [GTLAdSenseHostAdUnit class],
+    [GTLAdSenseHostAdUnitContentAdsSettings class],
+    [GTLAdSenseHostAdUnitMobileContentAdsSettings class],
+    [GTLAdSenseHostAdUnitContentAdsSettingsBackupOption class],
+    [GTLAdSenseHostAdUnits class],
+    [GTLAdSenseHostAssociationSession class],
+    [GTLAdSenseHostCustomChannel class],
+    [GTLAdSenseHostCustomChannels class],
+    [GTLAdSenseHostReport class],
+    [GTLAdSenseHostReportHeadersItem class],
+    [GTLAdSenseHostUrlChannel class],
+    [GTLAdSenseHostUrlChannels class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLAdSenseHostProductCodeAfc,
+    kGTLAdSenseHostProductCodeAfg,
+    kGTLAdSenseHostProductCodeAfmc,
+    kGTLAdSenseHostProductCodeAfs,
+    kGTLAdSenseHostProductCodeAfv
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
@@ -90,6 +90,121 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryAnalytics class],
+    [GTLAnalyticsAccount class],
+    [GTLAnalyticsAccountChildLink class],
+    [GTLAnalyticsAccountPermissions class],
+    [GTLAnalyticsAccountRef class],
+    [GTLAnalyticsAccounts class],
+    [GTLAnalyticsAccountSummaries class],
+    [GTLAnalyticsAccountSummary class],
+    [GTLAnalyticsAccountTicket class],
+    [GTLAnalyticsAdWordsAccount class],
+    [GTLAnalyticsColumn class],
+    [GTLAnalyticsColumnAttributes class],
+    [GTLAnalyticsColumns class],
+    [GTLAnalyticsCustomDataSource class],
+    [GTLAnalyticsCustomDataSourceChildLink class],
+    [GTLAnalyticsCustomDataSourceParentLink class],
+    [GTLAnalyticsCustomDataSources class],
+    [GTLAnalyticsCustomDimension class],
+    [GTLAnalyticsCustomDimensionParentLink class],
+    [GTLAnalyticsCustomDimensions class],
+    [GTLAnalyticsCustomMetric class],
+    [GTLAnalyticsCustomMetricParentLink class],
+    [GTLAnalyticsCustomMetrics class],
+    [GTLAnalyticsEntityAdWordsLink class],
+    [GTLAnalyticsEntityAdWordsLinkEntity class],
+    [GTLAnalyticsEntityAdWordsLinks class],
+    [GTLAnalyticsEntityUserLink class],
+    [GTLAnalyticsEntityUserLinkEntity class],
+    [GTLAnalyticsEntityUserLinkPermissions class],
+    [GTLAnalyticsEntityUserLinks class],
+    [GTLAnalyticsExperiment class],
+    [GTLAnalyticsExperimentParentLink class],
+    [GTLAnalyticsExperimentVariationsItem class],
+    [GTLAnalyticsExperiments class],
+    [GTLAnalyticsFilter class],
+    [GTLAnalyticsFilterAdvancedDetails class],
+    [GTLAnalyticsFilterLowercaseDetails class],
+    [GTLAnalyticsFilterParentLink class],
+    [GTLAnalyticsFilterSearchAndReplaceDetails class],
+    [GTLAnalyticsFilterUppercaseDetails class],
+    [GTLAnalyticsFilterExpression class],
+    [GTLAnalyticsFilterRef class],
+    [GTLAnalyticsFilters class],
+    [GTLAnalyticsGaData class],
+    [GTLAnalyticsGaDataColumnHeadersItem class],
+    [GTLAnalyticsGaDataDataTable class],
+    [GTLAnalyticsGaDataProfileInfo class],
+    [GTLAnalyticsGaDataQuery class],
+    [GTLAnalyticsGaDataTotalsForAllResults class],
+    [GTLAnalyticsGaDataDataTableColsItem class],
+    [GTLAnalyticsGaDataDataTableRowsItem class],
+    [GTLAnalyticsGaDataDataTableRowsItemCItem class],
+    [GTLAnalyticsGoal class],
+    [GTLAnalyticsGoalEventDetails class],
+    [GTLAnalyticsGoalParentLink class],
+    [GTLAnalyticsGoalUrlDestinationDetails class],
+    [GTLAnalyticsGoalVisitNumPagesDetails class],
+    [GTLAnalyticsGoalVisitTimeOnSiteDetails class],
+    [GTLAnalyticsGoalEventDetailsEventConditionsItem class],
+    [GTLAnalyticsGoalUrlDestinationDetailsStepsItem class],
+    [GTLAnalyticsGoals class],
+    [GTLAnalyticsMcfData class],
+    [GTLAnalyticsMcfDataColumnHeadersItem class],
+    [GTLAnalyticsMcfDataProfileInfo class],
+    [GTLAnalyticsMcfDataQuery class],
+    [GTLAnalyticsMcfDataRowsItem class],
+    [GTLAnalyticsMcfDataTotalsForAllResults class],
+    [GTLAnalyticsMcfDataRowsItemConversionPathValueItem class],
+    [GTLAnalyticsProfile class],
+    [GTLAnalyticsProfileChildLink class],
+    [GTLAnalyticsProfileParentLink class],
+    [GTLAnalyticsProfilePermissions class],
+    [GTLAnalyticsProfileFilterLink class],
+    [GTLAnalyticsProfileFilterLinks class],
+    [GTLAnalyticsProfileRef class],
+    [GTLAnalyticsProfiles class],
+    [GTLAnalyticsProfileSummary class],
+    [GTLAnalyticsRealtimeData class],
+    [GTLAnalyticsRealtimeDataColumnHeadersItem class],
+    [GTLAnalyticsRealtimeDataProfileInfo class],
+    [GTLAnalyticsRealtimeDataQuery class],
+    [GTLAnalyticsRealtimeDataTotalsForAllResults class],
+    [GTLAnalyticsSegment class],
+    [GTLAnalyticsSegments class],
+    [GTLAnalyticsUnsampledReport class],
+    [GTLAnalyticsUnsampledReportCloudStorageDownloadDetails class],
+    [GTLAnalyticsUnsampledReportDriveDownloadDetails class],
+    [GTLAnalyticsUnsampledReports class],
+    [GTLAnalyticsUpload class],
+    [GTLAnalyticsUploads class],
+    [GTLAnalyticsUserRef class],
+    [GTLAnalyticsWebproperties class],
+    [GTLAnalyticsWebproperty class],
+    [GTLAnalyticsWebpropertyChildLink class],
+    [GTLAnalyticsWebpropertyParentLink class],
+    [GTLAnalyticsWebpropertyPermissions class],
+    [GTLAnalyticsWebPropertyRef class],
+    [GTLAnalyticsWebPropertySummary class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLAnalyticsOutputDataTable,
+    kGTLAnalyticsOutputJson,
+    kGTLAnalyticsSamplingLevelDefault,
+    kGTLAnalyticsSamplingLevelFaster,
+    kGTLAnalyticsSamplingLevelHigherPrecision
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
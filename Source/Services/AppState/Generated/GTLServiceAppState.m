@@ -47,6 +47,17 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryAppState class],
+    [GTLAppStateGetResponse class],
+    [GTLAppStateListResponse class],
+    [GTLAppStateUpdateRequest class],
+    [GTLAppStateWriteResult class]
+  ];
+  return classes;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
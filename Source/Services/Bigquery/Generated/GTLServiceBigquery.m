@@ -80,6 +80,68 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryBigquery class],
+    [GTLBigqueryCsvOptions class],
+    [GTLBigqueryDataset class],
+    [GTLBigqueryDatasetAccessItem class],
+    [GTLBigqueryDatasetList class],
+    [GTLBigqueryDatasetListDatasetsItem class],
+    [GTLBigqueryDatasetReference class],
+    [GTLBigqueryErrorProto class],
+    [GTLBigqueryExternalDataConfiguration class],
+    [GTLBigqueryGetQueryResultsResponse class],
+    [GTLBigqueryJob class],
+    [GTLBigqueryJobCancelResponse class],
+    [GTLBigqueryJobConfiguration class],
+    [GTLBigqueryJobConfigurationExtract class],
+    [GTLBigqueryJobConfigurationLink class],
+    [GTLBigqueryJobConfigurationLoad class],
+    [GTLBigqueryJobConfigurationQuery class],
+    [GTLBigqueryJobConfigurationQueryTableDefinitions class],
+    [GTLBigqueryJobConfigurationTableCopy class],
+    [GTLBigqueryJobList class],
+    [GTLBigqueryJobListJobsItem class],
+    [GTLBigqueryJobReference class],
+    [GTLBigqueryJobStatistics class],
+    [GTLBigqueryJobStatistics2 class],
+    [GTLBigqueryJobStatistics3 class],
+    [GTLBigqueryJobStatistics4 class],
+    [GTLBigqueryJobStatus class],
+    [GTLBigqueryJsonObject class],
+    [GTLBigqueryProjectList class],
+    [GTLBigqueryProjectListProjectsItem class],
+    [GTLBigqueryProjectReference class],
+    [GTLBigqueryQueryResponse class],
+    [GTLBigqueryTable class],
+    [GTLBigqueryTableCell class],
+    [GTLBigqueryTableDataInsertAllResponse class],
+    [GTLBigqueryTableDataInsertAllResponseInsertErrorsItem class],
+    [GTLBigqueryTableDataList class],
+    [GTLBigqueryTableFieldSchema class],
+    [GTLBigqueryTableList class],
+    [GTLBigqueryTableListTablesItem class],
+    [GTLBigqueryTableReference class],
+    [GTLBigqueryTableRow class],
+    [GTLBigqueryTableSchema class],
+    [GTLBigqueryUserDefinedFunctionResource class],
+    [GTLBigqueryViewDefinition class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLBigqueryProjectionFull,
+    kGTLBigqueryProjectionMinimal,
+    kGTLBigqueryStateFilterDone,
+    kGTLBigqueryStateFilterPending,
+    kGTLBigqueryStateFilterRunning
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
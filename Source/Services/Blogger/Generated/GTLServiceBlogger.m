@@ -58,6 +58,72 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryBlogger class],
+    [GTLBloggerBlog class],
+    [GTLBloggerBlogLocale class],
+    [GTLBloggerBlogPages class],
+    [GTLBloggerBlogPosts class],
+    [GTLBloggerBlogList class],
+    [GTLBloggerBlogPerUserInfo class],
+    [GTLBloggerBlogUserInfo class],
+    [GTLBloggerComment class],
+    [GTLBloggerCommentAuthor class],
+    [GTLBloggerCommentBlog class],
+    [GTLBloggerCommentInReplyTo class],
+    [GTLBloggerCommentPost class],
+    [GTLBloggerCommentAuthorImage class],
+    [GTLBloggerCommentList class],
+    [GTLBloggerPage class],
+    [GTLBloggerPageAuthor class],
+    [GTLBloggerPageBlog class],
+    [GTLBloggerPageAuthorImage class],
+    [GTLBloggerPageList class],
+    [GTLBloggerPageviews class],
+    [GTLBloggerPageviewsCountsItem class],
+    [GTLBloggerPost class],
+    [GTLBloggerPostAuthor class],
+    [GTLBloggerPostBlog class],
+    [GTLBloggerPostImagesItem class],
+    [GTLBloggerPostLocation class],
+    [GTLBloggerPostReplies class],
+    [GTLBloggerPostAuthorImage class],
+    [GTLBloggerPostList class],
+    [GTLBloggerPostPerUserInfo class],
+    [GTLBloggerPostUserInfo class],
+    [GTLBloggerPostUserInfosList class],
+    [GTLBloggerUser class],
+    [GTLBloggerUserBlogs class],
+    [GTLBloggerUserLocale class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLBloggerOrderByPublished,
+    kGTLBloggerOrderByUpdated,
+    kGTLBloggerRangeAll,
+    kGTLBloggerRangeX30days,
+    kGTLBloggerRangeX7days,
+    kGTLBloggerRoleAdmin,
+    kGTLBloggerRoleAuthor,
+    kGTLBloggerRoleReader,
+    kGTLBloggerStatusDeleted,
+    kGTLBloggerStatusDraft,
+    kGTLBloggerStatusEmptied,
+    kGTLBloggerStatusLive,
+    kGTLBloggerStatusPending,
+    kGTLBloggerStatusScheduled,
+    kGTLBloggerStatusSpam,
+    kGTLBloggerViewAdmin,
+    kGTLBloggerViewAuthor,
+    kGTLBloggerViewReader
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
@@ -72,6 +72,150 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryBooks class],
+    [GTLBooksAnnotation class],
+    [GTLBooksAnnotationClientVersionRanges class],
+    [GTLBooksAnnotationCurrentVersionRanges class],
+    [GTLBooksAnnotationLayerSummary class],
+    [GTLBooksAnnotationdata class],
+    [GTLBooksAnnotations class],
+    [GTLBooksAnnotationsdata class],
+    [GTLBooksAnnotationsRange class],
+    [GTLBooksAnnotationsSummary class],
+    [GTLBooksAnnotationsSummaryLayersItem class],
+    [GTLBooksBookshelf class],
+    [GTLBooksBookshelves class],
+    [GTLBooksCategory class],
+    [GTLBooksCategoryItemsItem class],
+    [GTLBooksCloudloadingResource class],
+    [GTLBooksConcurrentAccessRestriction class],
+    [GTLBooksDictlayerdata class],
+    [GTLBooksDictlayerdataCommon class],
+    [GTLBooksDictlayerdataDict class],
+    [GTLBooksDictlayerdataDictSource class],
+    [GTLBooksDictlayerdataDictWordsItem class],
+    [GTLBooksDictlayerdataDictWordsItemDerivativesItem class],
+    [GTLBooksDictlayerdataDictWordsItemExamplesItem class],
+    [GTLBooksDictlayerdataDictWordsItemSensesItem class],
+    [GTLBooksDictlayerdataDictWordsItemSource class],
+    [GTLBooksDictlayerdataDictWordsItemDerivativesItemSource class],
+    [GTLBooksDictlayerdataDictWordsItemExamplesItemSource class],
+    [GTLBooksDictlayerdataDictWordsItemSensesItemConjugationsItem class],
+    [GTLBooksDictlayerdataDictWordsItemSensesItemDefinitionsItem class],
+    [GTLBooksDictlayerdataDictWordsItemSensesItemSource class],
+    [GTLBooksDictlayerdataDictWordsItemSensesItemSynonymsItem class],
+    [GTLBooksDictlayerdataDictWordsItemSensesItemDefinitionsItemExamplesItem class],
+    [GTLBooksDictlayerdataDictWordsItemSensesItemSynonymsItemSource class],
+    [GTLBooksDictlayerdataDictWordsItemSensesItemDefinitionsItemExamplesItemSource class],
+    [GTLBooksDownloadAccesses class],
+    [GTLBooksDownloadAccessRestriction class],
+    [GTLBooksGeolayerdata class],
+    [GTLBooksGeolayerdataCommon class],
+    [GTLBooksGeolayerdataGeo class],
+    [GTLBooksGeolayerdataGeoBoundaryItem class],
+    [GTLBooksGeolayerdataGeoViewport class],
+    [GTLBooksGeolayerdataGeoViewportHi class],
+    [GTLBooksGeolayerdataGeoViewportLo class],
+    [GTLBooksLayersummaries class],
+    [GTLBooksLayersummary class],
+    [GTLBooksMetadata class],
+    [GTLBooksMetadataItemsItem class],
+    [GTLBooksOffers class],
+    [GTLBooksOffersItemsItem class],
+    [GTLBooksOffersItemsItemItemsItem class],
+    [GTLBooksReadingPosition class],
+    [GTLBooksRequestAccess class],
+    [GTLBooksReview class],
+    [GTLBooksReviewAuthor class],
+    [GTLBooksReviewSource class],
+    [GTLBooksUsersettings class],
+    [GTLBooksUsersettingsNotesExport class],
+    [GTLBooksVolume class],
+    [GTLBooksVolumeAccessInfo class],
+    [GTLBooksVolumeLayerInfo class],
+    [GTLBooksVolumeRecommendedInfo class],
+    [GTLBooksVolumeSaleInfo class],
+    [GTLBooksVolumeSearchInfo class],
+    [GTLBooksVolumeUserInfo class],
+    [GTLBooksVolumeVolumeInfo class],
+    [GTLBooksVolumeAccessInfoEpub class],
+    [GTLBooksVolumeAccessInfoPdf class],
+    [GTLBooksVolumeLayerInfoLayersItem class],
+    [GTLBooksVolumeSaleInfoListPrice class],
+    [GTLBooksVolumeSaleInfoOffersItem class],
+    [GTLBooksVolumeSaleInfoRetailPrice class],
+    [GTLBooksVolumeUserInfoCopy class],
+    [GTLBooksVolumeUserInfoRentalPeriod class],
+    [GTLBooksVolumeUserInfoUserUploadedVolumeInfo class],
+    [GTLBooksVolumeVolumeInfoDimensions class],
+    [GTLBooksVolumeVolumeInfoImageLinks class],
+    [GTLBooksVolumeVolumeInfoIndustryIdentifiersItem class],
+    [GTLBooksVolumeSaleInfoOffersItemListPrice class],
+    [GTLBooksVolumeSaleInfoOffersItemRentalDuration class],
+    [GTLBooksVolumeSaleInfoOffersItemRetailPrice class],
+    [GTLBooksVolume2 class],
+    [GTLBooksVolumeannotation class],
+    [GTLBooksVolumeannotationContentRanges class],
+    [GTLBooksVolumeannotations class],
+    [GTLBooksVolumes class],
+    [GTLBooksVolumesRecommendedRateResponse class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLBooksAcquireMethodPreordered,
+    kGTLBooksAcquireMethodPreviouslyRented,
+    kGTLBooksAcquireMethodPublicDomain,
+    kGTLBooksAcquireMethodPurchased,
+    kGTLBooksAcquireMethodRented,
+    kGTLBooksAcquireMethodSample,
+    kGTLBooksAcquireMethodUploaded,
+    kGTLBooksActionBookmark,
+    kGTLBooksActionChapter,
+    kGTLBooksActionNextPage,
+    kGTLBooksActionPrevPage,
+    kGTLBooksActionScroll,
+    kGTLBooksActionSearch,
+    kGTLBooksAssociationEndOfSample,
+    kGTLBooksAssociationEndOfVolume,
+    kGTLBooksAssociationRelatedForPlay,
+    kGTLBooksDownloadEpub,
+    kGTLBooksFeaturesRentals,
+    kGTLBooksFilterEbooks,
+    kGTLBooksFilterFreeEbooks,
+    kGTLBooksFilterFull,
+    kGTLBooksFilterPaidEbooks,
+    kGTLBooksFilterPartial,
+    kGTLBooksLibraryRestrictMyLibrary,
+    kGTLBooksLibraryRestrictNoRestrict,
+    kGTLBooksLicenseTypesBoth,
+    kGTLBooksLicenseTypesConcurrent,
+    kGTLBooksLicenseTypesDownload,
+    kGTLBooksMaxAllowedMaturityRatingMature,
+    kGTLBooksMaxAllowedMaturityRatingNotMature,
+    kGTLBooksOrderByNewest,
+    kGTLBooksOrderByRelevance,
+    kGTLBooksPrintTypeAll,
+    kGTLBooksPrintTypeBooks,
+    kGTLBooksPrintTypeMagazines,
+    kGTLBooksProcessingStateCompletedFailed,
+    kGTLBooksProcessingStateCompletedSuccess,
+    kGTLBooksProcessingStateRunning,
+    kGTLBooksProjectionFull,
+    kGTLBooksProjectionLite,
+    kGTLBooksRatingHaveIt,
+    kGTLBooksRatingNotInterested,
+    kGTLBooksReasonIosPrex,
+    kGTLBooksReasonIosSearch,
+    kGTLBooksReasonOnboarding
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
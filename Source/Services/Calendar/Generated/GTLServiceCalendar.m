@@ -66,6 +66,64 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryCalendar class],
+    [GTLCalendarAcl class],
+    [GTLCalendarAclRule class],
+    [GTLCalendarAclRuleScope class],
+    [GTLCalendarCalendar class],
+    [GTLCalendarCalendarList class],
+    [GTLCalendarCalendarListEntry class],
+    [GTLCalendarCalendarListEntryNotificationSettings class],
+    [GTLCalendarChannel class],
+    [GTLCalendarChannelParams class],
+    [GTLCalendarColorDefinition class],
+    [GTLCalendarColors class],
+    [GTLCalendarColorsCalendar class],
+    [GTLCalendarColorsEvent class],
+    [GTLCalendarError class],
+    [GTLCalendarEvent class],
+    [GTLCalendarEventCreator class],
+    [GTLCalendarEventExtendedProperties class],
+    [GTLCalendarEventGadget class],
+    [GTLCalendarEventOrganizer class],
+    [GTLCalendarEventReminders class],
+    [GTLCalendarEventSource class],
+    [GTLCalendarEventExtendedPropertiesPrivate class],
+    [GTLCalendarEventExtendedPropertiesShared class],
+    [GTLCalendarEventGadgetPreferences class],
+    [GTLCalendarEventAttachment class],
+    [GTLCalendarEventAttendee class],
+    [GTLCalendarEventDateTime class],
+    [GTLCalendarEventReminder class],
+    [GTLCalendarEvents class],
+    [GTLCalendarFreeBusyCalendar class],
+    [GTLCalendarFreeBusyGroup class],
+    [GTLCalendarFreeBusyRequestItem class],
+    [GTLCalendarFreeBusyResponse class],
+    [GTLCalendarFreeBusyResponseCalendars class],
+    [GTLCalendarFreeBusyResponseGroups class],
+    [GTLCalendarNotification class],
+    [GTLCalendarSetting class],
+    [GTLCalendarSettings class],
+    [GTLCalendarTimePeriod class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLCalendarMinAccessRoleFreeBusyReader,
+    kGTLCalendarMinAccessRoleOwner,
+    kGTLCalendarMinAccessRoleReader,
+    kGTLCalendarMinAccessRoleWriter,
+    kGTLCalendarOrderByStartTime,
+    kGTLCalendarOrderByUpdated
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
@@ -63,6 +63,61 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryCivicInfo class],
+    [GTLCivicInfoAdministrationRegion class],
+    [GTLCivicInfoAdministrativeBody class],
+    [GTLCivicInfoCandidate class],
+    [GTLCivicInfoChannel class],
+    [GTLCivicInfoContest class],
+    [GTLCivicInfoDivisionSearchResponse class],
+    [GTLCivicInfoDivisionSearchResult class],
+    [GTLCivicInfoElection class],
+    [GTLCivicInfoElectionOfficial class],
+    [GTLCivicInfoElectionsQueryResponse class],
+    [GTLCivicInfoElectoralDistrict class],
+    [GTLCivicInfoGeographicDivision class],
+    [GTLCivicInfoOffice class],
+    [GTLCivicInfoOfficial class],
+    [GTLCivicInfoPollingLocation class],
+    [GTLCivicInfoRepresentativeInfoData class],
+    [GTLCivicInfoRepresentativeInfoDataDivisions class],
+    [GTLCivicInfoRepresentativeInfoResponse class],
+    [GTLCivicInfoRepresentativeInfoResponseDivisions class],
+    [GTLCivicInfoSimpleAddressType class],
+    [GTLCivicInfoSource class],
+    [GTLCivicInfoVoterInfoResponse class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLCivicInfoLevelsAdministrativeArea1,
+    kGTLCivicInfoLevelsAdministrativeArea2,
+    kGTLCivicInfoLevelsCountry,
+    kGTLCivicInfoLevelsInternational,
+    kGTLCivicInfoLevelsLocality,
+    kGTLCivicInfoLevelsRegional,
+    kGTLCivicInfoLevelsSpecial,
+    kGTLCivicInfoLevelsSubLocality1,
+    kGTLCivicInfoLevelsSubLocality2,
+    kGTLCivicInfoRolesDeputyHeadOfGovernment,
+    kGTLCivicInfoRolesExecutiveCouncil,
+    kGTLCivicInfoRolesGovernmentOfficer,
+    kGTLCivicInfoRolesHeadOfGovernment,
+    kGTLCivicInfoRolesHeadOfState,
+    kGTLCivicInfoRolesHighestCourtJudge,
+    kGTLCivicInfoRolesJudge,
+    kGTLCivicInfoRolesLegislatorLowerBody,
+    kGTLCivicInfoRolesLegislatorUpperBody,
+    kGTLCivicInfoRolesSchoolBoard,
+    kGTLCivicInfoRolesSpecialPurposeOfficer
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
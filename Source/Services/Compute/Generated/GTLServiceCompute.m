@@ -73,6 +73,52 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryCompute class],
+    [GTLComputeAccessConfig class],
+    [GTLComputeAttachedDisk class],
+    [GTLComputeDeprecationStatus class],
+    [GTLComputeDisk class],
+    [GTLComputeDiskList class],
+    [GTLComputeFirewall class],
+    [GTLComputeFirewallAllowedItem class],
+    [GTLComputeFirewallList class],
+    [GTLComputeImage class],
+    [GTLComputeImageRawDisk class],
+    [GTLComputeImageList class],
+    [GTLComputeInstance class],
+    [GTLComputeInstanceList class],
+    [GTLComputeKernel class],
+    [GTLComputeKernelList class],
+    [GTLComputeMachineType class],
+    [GTLComputeMachineTypeEphemeralDisksItem class],
+    [GTLComputeMachineTypeList class],
+    [GTLComputeMetadata class],
+    [GTLComputeMetadataItemsItem class],
+    [GTLComputeNetwork class],
+    [GTLComputeNetworkInterface class],
+    [GTLComputeNetworkList class],
+    [GTLComputeOperation class],
+    [GTLComputeOperationError class],
+    [GTLComputeOperationWarningsItem class],
+    [GTLComputeOperationErrorErrorsItem class],
+    [GTLComputeOperationWarningsItemDataItem class],
+    [GTLComputeOperationList class],
+    [GTLComputeProject class],
+    [GTLComputeQuota class],
+    [GTLComputeSerialPortOutput class],
+    [GTLComputeServiceAccount class],
+    [GTLComputeSnapshot class],
+    [GTLComputeSnapshotList class],
+    [GTLComputeTags class],
+    [GTLComputeZone class],
+    [GTLComputeZoneMaintenanceWindowsItem class],
+    [GTLComputeZoneList class]
+  ];
+  return classes;
+}
+
 - (id)init {
   self = [super init];
   if (self) {
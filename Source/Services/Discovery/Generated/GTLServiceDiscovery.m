@@ -51,6 +51,55 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryDiscovery class],
+    [GTLDiscoveryDirectoryList class],
+    [GTLDiscoveryDirectoryListItemsItem class],
+    [GTLDiscoveryDirectoryListItemsItemIcons class],
+    [GTLDiscoveryJsonSchema class],
+    [GTLDiscoveryJsonSchemaAnnotations class],
+    [GTLDiscoveryJsonSchemaProperties class],
+    [GTLDiscoveryJsonSchemaVariant class],
+    [GTLDiscoveryJsonSchemaVariantMapItem class],
+    [GTLDiscoveryRestDescription class],
+    [GTLDiscoveryRestDescriptionAuth class],
+    [GTLDiscoveryRestDescriptionIcons class],
+    [GTLDiscoveryRestDescriptionMethods class],
+    [GTLDiscoveryRestDescriptionParameters class],
+    [GTLDiscoveryRestDescriptionResources class],
+    [GTLDiscoveryRestDescriptionSchemas class],
+    [GTLDiscoveryRestDescriptionAuthOauth2 class],
+    [GTLDiscoveryRestDescriptionAuthOauth2Scopes class],
+    [GTLDiscoveryRestDescriptionAuthOauth2ScopesScope class],
+    [GTLDiscoveryRestMethod class],
+    [GTLDiscoveryRestMethodMediaUpload class],
+    [GTLDiscoveryRestMethodParameters class],
+    [GTLDiscoveryRestMethodRequest class],
+    [GTLDiscoveryRestMethodResponse class],
+    [GTLDiscoveryRestMethodMediaUploadProtocols class],
+    [GTLDiscoveryRestMethodMediaUploadProtocolsResumable class],
+    [GTLDiscoveryRestMethodMediaUploadProtocolsSimple class],
+    [GTLDiscoveryRestResource class],
+    [GTLDiscoveryRestResourceMethods class],
+    [GTLDiscoveryRestResourceResources class],
+    [GTLDiscoveryRpcDescription class],
+    [GTLDiscoveryRpcDescriptionAuth class],
+    [GTLDiscoveryRpcDescriptionIcons class],
+    [GTLDiscoveryRpcDescriptionMethods class],
+    [GTLDiscoveryRpcDescriptionParameters class],
+    [GTLDiscoveryRpcDescriptionSchemas class],
+    [GTLDiscoveryRpcDescriptionAuthOauth2 class],
+    [GTLDiscoveryRpcDescriptionAuthOauth2Scopes class],
+    [GTLDiscoveryRpcDescriptionAuthOauth2ScopesScope class],
+    [GTLDiscoveryRpcMethod class],
+    [GTLDiscoveryRpcMethodMediaUpload class],
+    [GTLDiscoveryRpcMethodParameters class],
+    [GTLDiscoveryRpcMethodReturns class]
+  ];
+  return classes;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
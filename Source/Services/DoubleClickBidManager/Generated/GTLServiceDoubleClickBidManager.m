@@ -59,6 +59,530 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryDoubleClickBidManager class],
+    [GTLDoubleClickBidManagerDownloadLineItemsResponse class],
+    [GTLDoubleClickBidManagerFilterPair class],
+    [GTLDoubleClickBidManagerListQueriesResponse class],
+    [GTLDoubleClickBidManagerListReportsResponse class],
+    [GTLDoubleClickBidManagerParameters class],
+    [GTLDoubleClickBidManagerQuery class],
+    [GTLDoubleClickBidManagerQueryMetadata class],
+    [GTLDoubleClickBidManagerQuerySchedule class],
+    [GTLDoubleClickBidManagerReport class],
+    [GTLDoubleClickBidManagerReportFailure class],
+    [GTLDoubleClickBidManagerReportKey class],
+    [GTLDoubleClickBidManagerReportMetadata class],
+    [GTLDoubleClickBidManagerReportStatus class],
+    [GTLDoubleClickBidManagerRowStatus class],
+    [GTLDoubleClickBidManagerUploadLineItemsResponse class],
+    [GTLDoubleClickBidManagerUploadStatus class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterActiveViewExpectedViewability,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterActivityId,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterAdPosition,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterAdvertiser,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterAdvertiserCurrency,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterAdvertiserTimezone,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterAge,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterBrandsafeChannelId,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterBrowser,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterCampaignDailyFrequency,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterCarrier,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterChannelId,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterCity,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterConversionDelay,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterCountry,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterCreativeId,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterCreativeSize,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterCreativeType,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterDataProvider,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterDate,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterDayOfWeek,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterDma,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterExchangeId,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterFloodlightPixelId,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterGender,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterInsertionOrder,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterInventoryFormat,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterInventorySource,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterInventorySourceType,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterKeyword,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterLineItem,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterLineItemDailyFrequency,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterLineItemLifetimeFrequency,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterLineItemType,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterMobileDeviceMake,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterMobileDeviceMakeModel,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterMobileDeviceType,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterMobileGeo,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterMonth,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterMraidSupport,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterNielsenAge,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterNielsenCountryCode,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterNielsenDeviceId,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterNielsenGender,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterOrderId,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterOs,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterPageCategory,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterPageLayout,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterPartner,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterPartnerCurrency,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterPublicInventory,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterQuarter,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterRegion,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterRegularChannelId,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterSiteId,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterSiteLanguage,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterTargetedUserList,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterTimeOfDay,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterTrueviewConversionType,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterUnknown,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterUserList,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterUserListFirstParty,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterUserListThirdParty,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterVideoAdPositionInStream,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterVideoCompanionSize,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterVideoCompanionType,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterVideoCreativeDuration,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterVideoCreativeDurationSkippable,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterVideoDurationSeconds,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterVideoFormatSupport,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterVideoInventoryType,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterVideoPlayerSize,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterVideoRatingTier,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterVideoSkippableSupport,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterVideoVpaidSupport,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterWeek,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterYear,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterYoutubeVertical,
+    kGTLDoubleClickBidManagerFilterPair_Type_FilterZipCode,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterActiveViewExpectedViewability,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterActivityId,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterAdPosition,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterAdvertiser,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterAdvertiserCurrency,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterAdvertiserTimezone,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterAge,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterBrandsafeChannelId,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterBrowser,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterCampaignDailyFrequency,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterCarrier,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterChannelId,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterCity,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterConversionDelay,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterCountry,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterCreativeId,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterCreativeSize,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterCreativeType,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterDataProvider,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterDate,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterDayOfWeek,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterDma,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterExchangeId,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterFloodlightPixelId,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterGender,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterInsertionOrder,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterInventoryFormat,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterInventorySource,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterInventorySourceType,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterKeyword,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterLineItem,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterLineItemDailyFrequency,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterLineItemLifetimeFrequency,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterLineItemType,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterMobileDeviceMake,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterMobileDeviceMakeModel,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterMobileDeviceType,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterMobileGeo,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterMonth,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterMraidSupport,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterNielsenAge,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterNielsenCountryCode,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterNielsenDeviceId,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterNielsenGender,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterOrderId,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterOs,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterPageCategory,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterPageLayout,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterPartner,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterPartnerCurrency,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterPublicInventory,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterQuarter,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterRegion,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterRegularChannelId,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterSiteId,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterSiteLanguage,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterTargetedUserList,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterTimeOfDay,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterTrueviewConversionType,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterUnknown,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterUserList,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterUserListFirstParty,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterUserListThirdParty,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterVideoAdPositionInStream,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterVideoCompanionSize,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterVideoCompanionType,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterVideoCreativeDuration,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterVideoCreativeDurationSkippable,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterVideoDurationSeconds,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterVideoFormatSupport,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterVideoInventoryType,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterVideoPlayerSize,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterVideoRatingTier,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterVideoSkippableSupport,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterVideoVpaidSupport,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterWeek,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterYear,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterYoutubeVertical,
+    kGTLDoubleClickBidManagerParameters_GroupBys_FilterZipCode,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricBidRequests,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricBillableCostAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricBillableCostPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricBillableCostUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricClicks,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricClickToPostClickConversionRate,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricComscoreVceAudienceAvgFrequency,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricComscoreVceAudienceImpressions,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricComscoreVceAudienceImpressionsShare,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricComscoreVceAudienceReachPct,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricComscoreVceAudienceSharePct,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricComscoreVceGrossRatingPoints,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricComscoreVcePopulation,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricComscoreVceUniqueAudience,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricConversionsPerMille,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee1Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee1Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee1Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee2Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee2Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee2Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee3Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee3Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee3Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee4Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee4Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee4Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee5Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee5Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCpmFee5Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricCtr,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricDataCostAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricDataCostPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricDataCostUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee10Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee10Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee10Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee11Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee11Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee11Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee12Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee12Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee12Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee13Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee13Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee13Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee14Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee14Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee14Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee15Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee15Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee15Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee16Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee16Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee16Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee17Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee17Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee17Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee18Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee18Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee18Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee19Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee19Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee19Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee20Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee20Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee20Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee2Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee2Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee2Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee3Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee3Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee3Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee4Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee4Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee4Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee5Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee5Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee5Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee6Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee6Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee6Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee7Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee7Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee7Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee8Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee8Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee8Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee9Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee9Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricFee9Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricImpressions,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricImpressionsToConversionRate,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricLastClicks,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricLastImpressions,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpaAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpaPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpapcAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpapcPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpapcUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpapvAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpapvPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpapvUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpaUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpcAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpcPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpcUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpcvAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpcvPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpcvUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpmAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpmPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostEcpmUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaCostUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee1Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee1Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee1Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee2Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee2Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee2Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee3Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee3Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee3Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee4Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee4Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee4Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee5Advertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee5Partner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricMediaFee5Usd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricPixelLoads,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricPlatformFeeAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricPlatformFeePartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricPlatformFeeUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricPostClickDfaRevenue,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricPostViewDfaRevenue,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpaAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpaPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpapcAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpapcPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpapcUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpapvAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpapvPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpapvUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpaUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpcAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpcPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpcUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpmAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpmPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitEcpmUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitMargin,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricProfitUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpaAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpaPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpapcAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpapcPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpapcUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpapvAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpapvPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpapvUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpaUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpcAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpcPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpcUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpcvAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpcvPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpcvUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpmAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpmPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueEcpmUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenuePartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRevenueUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRichMediaVideoCompletions,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRichMediaVideoFirstQuartileCompletes,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRichMediaVideoFullScreens,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRichMediaVideoMidpoints,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRichMediaVideoMutes,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRichMediaVideoPauses,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRichMediaVideoPlays,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRichMediaVideoSkips,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricRichMediaVideoThirdQuartileCompletes,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTeaTrueviewImpressions,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTeaTrueviewUniqueCookies,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTeaTrueviewUniquePeople,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalConversions,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpaAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpaPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpapcAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpapcPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpapcUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpapvAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpapvPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpapvUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpaUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpcAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpcPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpcUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpcvAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpcvPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpcvUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpmAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpmPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostEcpmUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTotalMediaCostUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewConversionManyPerView,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewConversionOnePerView,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewConversionRateOnePerView,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewCostConversionManyPerViewRatio,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewCostConversionOnePerViewRatio,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewCpvAdvertiser,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewCpvPartner,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewCpvUsd,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewEarnedLikes,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewEarnedPlaylistAdditions,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewEarnedShares,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewEarnedSubscribers,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewEarnedViews,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewImpressionShare,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewLostIsBudget,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewLostIsRank,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewTotalConversionValue,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewUniqueViewers,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewValueConversionManyPerViewRatio,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewValueConversionOnePerViewRatio,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewViewRate,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewViews,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricTrueviewViewThroughConversion,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricUniqueVisitorsCookies,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricUnknown,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricVideoCompanionClicks,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricVideoCompanionImpressions,
+    kGTLDoubleClickBidManagerParameters_Metrics_MetricVideoCompletionRate,
+    kGTLDoubleClickBidManagerParameters_Type_TypeActiveGrp,
+    kGTLDoubleClickBidManagerParameters_Type_TypeAudienceComposition,
+    kGTLDoubleClickBidManagerParameters_Type_TypeAudiencePerformance,
+    kGTLDoubleClickBidManagerParameters_Type_TypeClientSafe,
+    kGTLDoubleClickBidManagerParameters_Type_TypeComscoreVce,
+    kGTLDoubleClickBidManagerParameters_Type_TypeCrossFee,
+    kGTLDoubleClickBidManagerParameters_Type_TypeCrossPartner,
+    kGTLDoubleClickBidManagerParameters_Type_TypeCrossPartnerThirdPartyDataProvider,
+    kGTLDoubleClickBidManagerParameters_Type_TypeEstimatedConversion,
+    kGTLDoubleClickBidManagerParameters_Type_TypeFee,
+    kGTLDoubleClickBidManagerParameters_Type_TypeGeneral,
+    kGTLDoubleClickBidManagerParameters_Type_TypeInventoryAvailability,
+    kGTLDoubleClickBidManagerParameters_Type_TypeKeyword,
+    kGTLDoubleClickBidManagerParameters_Type_TypeNielsenAudienceProfile,
+    kGTLDoubleClickBidManagerParameters_Type_TypeNielsenDailyReachBuild,
+    kGTLDoubleClickBidManagerParameters_Type_TypeNielsenSite,
+    kGTLDoubleClickBidManagerParameters_Type_TypeOrderId,
+    kGTLDoubleClickBidManagerParameters_Type_TypePageCategory,
+    kGTLDoubleClickBidManagerParameters_Type_TypePixelLoad,
+    kGTLDoubleClickBidManagerParameters_Type_TypeReachAndFrequency,
+    kGTLDoubleClickBidManagerParameters_Type_TypeThirdPartyDataProvider,
+    kGTLDoubleClickBidManagerParameters_Type_TypeTrueview,
+    kGTLDoubleClickBidManagerParameters_Type_TypeTrueviewIar,
+    kGTLDoubleClickBidManagerParameters_Type_TypeVerification,
+    kGTLDoubleClickBidManagerParameters_Type_TypeYoutubeVertical,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_AllTime,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_CurrentDay,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_CustomDates,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_Last14Days,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_Last30Days,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_Last365Days,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_Last7Days,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_Last90Days,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_MonthToDate,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_PreviousDay,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_PreviousHalfMonth,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_PreviousMonth,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_PreviousQuarter,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_PreviousWeek,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_PreviousYear,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_QuarterToDate,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_WeekToDate,
+    kGTLDoubleClickBidManagerQueryMetadata_DataRange_YearToDate,
+    kGTLDoubleClickBidManagerQueryMetadata_Format_Csv,
+    kGTLDoubleClickBidManagerQueryMetadata_Format_ExcelCsv,
+    kGTLDoubleClickBidManagerQueryMetadata_Format_Xlsx,
+    kGTLDoubleClickBidManagerQuerySchedule_Frequency_Daily,
+    kGTLDoubleClickBidManagerQuerySchedule_Frequency_Monthly,
+    kGTLDoubleClickBidManagerQuerySchedule_Frequency_OneTime,
+    kGTLDoubleClickBidManagerQuerySchedule_Frequency_Quarterly,
+    kGTLDoubleClickBidManagerQuerySchedule_Frequency_SemiMonthly,
+    kGTLDoubleClickBidManagerQuerySchedule_Frequency_Weekly,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_AuthenticationError,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_DeprecatedReportingInvalidQuery,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ReportingBucketNotFound,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ReportingCreateBucketFailed,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ReportingDeleteBucketFailed,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ReportingFatalError,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ReportingIllegalFilename,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ReportingImcompatibleMetrics,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ReportingInvalidQueryMissingPartnerAndAdvertiserFilters,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ReportingInvalidQueryTitleMissing,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ReportingInvalidQueryTooManyUnfilteredLargeGroupBys,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ReportingQueryNotFound,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ReportingTransientError,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ReportingUpdateBucketPermissionFailed,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ReportingWriteBucketObjectFailed,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ServerError,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_UnauthorizedApiAccess,
+    kGTLDoubleClickBidManagerReportFailure_ErrorCode_ValidationError,
+    kGTLDoubleClickBidManagerReportStatus_Format_Csv,
+    kGTLDoubleClickBidManagerReportStatus_Format_ExcelCsv,
+    kGTLDoubleClickBidManagerReportStatus_Format_Xlsx,
+    kGTLDoubleClickBidManagerReportStatus_State_Done,
+    kGTLDoubleClickBidManagerReportStatus_State_Failed,
+    kGTLDoubleClickBidManagerReportStatus_State_Running,
+    kGTLDoubleClickBidManagerDataRangeAllTime,
+    kGTLDoubleClickBidManagerDataRangeCurrentDay,
+    kGTLDoubleClickBidManagerDataRangeCustomDates,
+    kGTLDoubleClickBidManagerDataRangeLast14Days,
+    kGTLDoubleClickBidManagerDataRangeLast30Days,
+    kGTLDoubleClickBidManagerDataRangeLast365Days,
+    kGTLDoubleClickBidManagerDataRangeLast7Days,
+    kGTLDoubleClickBidManagerDataRangeLast90Days,
+    kGTLDoubleClickBidManagerDataRangeMonthToDate,
+    kGTLDoubleClickBidManagerDataRangePreviousDay,
+    kGTLDoubleClickBidManagerDataRangePreviousHalfMonth,
+    kGTLDoubleClickBidManagerDataRangePreviousMonth,
+    kGTLDoubleClickBidManagerDataRangePreviousQuarter,
+    kGTLDoubleClickBidManagerDataRangePreviousWeek,
+    kGTLDoubleClickBidManagerDataRangePreviousYear,
+    kGTLDoubleClickBidManagerDataRangeQuarterToDate,
+    kGTLDoubleClickBidManagerDataRangeWeekToDate,
+    kGTLDoubleClickBidManagerDataRangeYearToDate,
+    kGTLDoubleClickBidManagerFilterTypeAdvertiserId,
+    kGTLDoubleClickBidManagerFilterTypeInsertionOrderId,
+    kGTLDoubleClickBidManagerFilterTypeLineItemId,
+    kGTLDoubleClickBidManagerFormatCsv
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
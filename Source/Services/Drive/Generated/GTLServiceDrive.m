@@ -68,6 +68,76 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryDrive class],
+    [GTLDriveAbout class],
+    [GTLDriveAboutAdditionalRoleInfoItem class],
+    [GTLDriveAboutExportFormatsItem class],
+    [GTLDriveAboutFeaturesItem class],
+    [GTLDriveAboutImportFormatsItem class],
+    [GTLDriveAboutMaxUploadSizesItem class],
+    [GTLDriveAboutQuotaBytesByServiceItem class],
+    [GTLDriveAboutAdditionalRoleInfoItemRoleSetsItem class],
+    [GTLDriveApp class],
+    [GTLDriveAppIconsItem class],
+    [GTLDriveAppList class],
+    [GTLDriveChange class],
+    [GTLDriveChangeList class],
+    [GTLDriveChannel class],
+    [GTLDriveChannelParams class],
+    [GTLDriveChildList class],
+    [GTLDriveChildReference class],
+    [GTLDriveComment class],
+    [GTLDriveCommentContext class],
+    [GTLDriveCommentList class],
+    [GTLDriveCommentReply class],
+    [GTLDriveCommentReplyList class],
+    [GTLDriveFile class],
+    [GTLDriveFileExportLinks class],
+    [GTLDriveFileImageMediaMetadata class],
+    [GTLDriveFileIndexableText class],
+    [GTLDriveFileLabels class],
+    [GTLDriveFileOpenWithLinks class],
+    [GTLDriveFileThumbnail class],
+    [GTLDriveFileVideoMediaMetadata class],
+    [GTLDriveFileImageMediaMetadataLocation class],
+    [GTLDriveFileList class],
+    [GTLDriveGeneratedIds class],
+    [GTLDriveParentList class],
+    [GTLDriveParentReference class],
+    [GTLDrivePermission class],
+    [GTLDrivePermissionId class],
+    [GTLDrivePermissionList class],
+    [GTLDriveProperty class],
+    [GTLDrivePropertyList class],
+    [GTLDriveRevision class],
+    [GTLDriveRevisionExportLinks class],
+    [GTLDriveRevisionList class],
+    [GTLDriveUser class],
+    [GTLDriveUserPicture class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLDriveCorpusDefault,
+    kGTLDriveCorpusDomain,
+    kGTLDriveModifiedDateBehaviorFromBody,
+    kGTLDriveModifiedDateBehaviorFromBodyIfNeeded,
+    kGTLDriveModifiedDateBehaviorFromBodyOrNow,
+    kGTLDriveModifiedDateBehaviorNoChange,
+    kGTLDriveModifiedDateBehaviorNow,
+    kGTLDriveModifiedDateBehaviorNowIfNeeded,
+    kGTLDriveProjectionBasic,
+    kGTLDriveProjectionFull,
+    kGTLDriveVisibilityDefault,
+    kGTLDriveVisibilityPrivate
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
@@ -62,6 +62,57 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryFitness class],
+    [GTLFitnessAggregateBucket class],
+    [GTLFitnessAggregateBy class],
+    [GTLFitnessAggregateResponse class],
+    [GTLFitnessApplication class],
+    [GTLFitnessBucketByActivity class],
+    [GTLFitnessBucketBySession class],
+    [GTLFitnessBucketByTime class],
+    [GTLFitnessDataPoint class],
+    [GTLFitnessDataset class],
+    [GTLFitnessDataSource class],
+    [GTLFitnessDataType class],
+    [GTLFitnessDataTypeField class],
+    [GTLFitnessDevice class],
+    [GTLFitnessListDataSourcesResponse class],
+    [GTLFitnessListSessionsResponse class],
+    [GTLFitnessMapValue class],
+    [GTLFitnessSession class],
+    [GTLFitnessValue class],
+    [GTLFitnessValueMapValEntry class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLFitnessAggregateBucket_Type_ActivitySegment,
+    kGTLFitnessAggregateBucket_Type_ActivityType,
+    kGTLFitnessAggregateBucket_Type_Session,
+    kGTLFitnessAggregateBucket_Type_Time,
+    kGTLFitnessAggregateBucket_Type_Unknown,
+    kGTLFitnessDataSource_Type_Derived,
+    kGTLFitnessDataSource_Type_Raw,
+    kGTLFitnessDataTypeField_Format_FloatList,
+    kGTLFitnessDataTypeField_Format_FloatPoint,
+    kGTLFitnessDataTypeField_Format_Integer,
+    kGTLFitnessDataTypeField_Format_IntegerList,
+    kGTLFitnessDataTypeField_Format_Map,
+    kGTLFitnessDataTypeField_Format_String,
+    kGTLFitnessDevice_Type_ChestStrap,
+    kGTLFitnessDevice_Type_Phone,
+    kGTLFitnessDevice_Type_Scale,
+    kGTLFitnessDevice_Type_Tablet,
+    kGTLFitnessDevice_Type_Unknown,
+    kGTLFitnessDevice_Type_Watch
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
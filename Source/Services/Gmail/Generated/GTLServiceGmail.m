@@ -62,6 +62,53 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryGmail class],
+    [GTLGmailDraft class],
+    [GTLGmailHistory class],
+    [GTLGmailHistoryLabelAdded class],
+    [GTLGmailHistoryLabelRemoved class],
+    [GTLGmailHistoryMessageAdded class],
+    [GTLGmailHistoryMessageDeleted class],
+    [GTLGmailLabel class],
+    [GTLGmailListDraftsResponse class],
+    [GTLGmailListHistoryResponse class],
+    [GTLGmailListLabelsResponse class],
+    [GTLGmailListMessagesResponse class],
+    [GTLGmailListThreadsResponse class],
+    [GTLGmailMessage class],
+    [GTLGmailMessagePart class],
+    [GTLGmailMessagePartBody class],
+    [GTLGmailMessagePartHeader class],
+    [GTLGmailProfile class],
+    [GTLGmailThread class],
+    [GTLGmailWatchResponse class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLGmailLabel_LabelListVisibility_LabelHide,
+    kGTLGmailLabel_LabelListVisibility_LabelShow,
+    kGTLGmailLabel_LabelListVisibility_LabelShowIfUnread,
+    kGTLGmailLabel_MessageListVisibility_Hide,
+    kGTLGmailLabel_MessageListVisibility_Show,
+    kGTLGmailLabel_Type_System,
+    kGTLGmailLabel_Type_User,
+    kGTLGmailFormatFull,
+    kGTLGmailFormatMetadata,
+    kGTLGmailFormatMinimal,
+    kGTLGmailFormatRaw,
+    kGTLGmailInternalDateSourceDateHeader,
+    kGTLGmailInternalDateSourceReceivedTime,
+    kGTLGmailLabelFilterActionExclude,
+    kGTLGmailLabelFilterActionInclude
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
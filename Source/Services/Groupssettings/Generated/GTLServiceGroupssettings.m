@@ -44,6 +44,14 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryGroupssettings class],
+    [GTLGroupssettingsGroups class]
+  ];
+  return classes;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
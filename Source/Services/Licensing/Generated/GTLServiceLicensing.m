@@ -46,6 +46,16 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryLicensing class],
+    [GTLLicensingLicenseAssignment class],
+    [GTLLicensingLicenseAssignmentInsert class],
+    [GTLLicensingLicenseAssignmentList class]
+  ];
+  return classes;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
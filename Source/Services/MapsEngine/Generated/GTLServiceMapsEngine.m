@@ -116,6 +116,191 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryMapsEngine class],
+    [GTLMapsEngineAcquisitionTime class],
+    [GTLMapsEngineAsset class],
+    [GTLMapsEngineAssetsListResponse class],
+    [GTLMapsEngineBorder class],
+    [GTLMapsEngineColor class],
+    [GTLMapsEngineDatasource class],
+    [GTLMapsEngineDisplayRule class],
+    [GTLMapsEngineFeature class],
+    [GTLMapsEngineFeatureInfo class],
+    [GTLMapsEngineFeaturesListResponse class],
+    [GTLMapsEngineFile class],
+    [GTLMapsEngineFilter class],
+    [GTLMapsEngineGeoJsonGeometry class],
+    [GTLMapsEngineGeoJsonGeometryCollection class],
+    [GTLMapsEngineGeoJsonLineString class],
+    [GTLMapsEngineGeoJsonMultiLineString class],
+    [GTLMapsEngineGeoJsonMultiPoint class],
+    [GTLMapsEngineGeoJsonMultiPolygon class],
+    [GTLMapsEngineGeoJsonPoint class],
+    [GTLMapsEngineGeoJsonPolygon class],
+    [GTLMapsEngineGeoJsonProperties class],
+    [GTLMapsEngineIcon class],
+    [GTLMapsEngineIconsListResponse class],
+    [GTLMapsEngineIconStyle class],
+    [GTLMapsEngineLabelStyle class],
+    [GTLMapsEngineLayer class],
+    [GTLMapsEngineLayersListResponse class],
+    [GTLMapsEngineLineStyle class],
+    [GTLMapsEngineLineStyleStroke class],
+    [GTLMapsEngineMap class],
+    [GTLMapsEngineMapFolder class],
+    [GTLMapsEngineMapItem class],
+    [GTLMapsEngineMapKmlLink class],
+    [GTLMapsEngineMapLayer class],
+    [GTLMapsEngineMapsListResponse class],
+    [GTLMapsEngineParent class],
+    [GTLMapsEngineParentsListResponse class],
+    [GTLMapsEnginePermission class],
+    [GTLMapsEnginePermissionsBatchDeleteRequest class],
+    [GTLMapsEnginePermissionsBatchDeleteResponse class],
+    [GTLMapsEnginePermissionsBatchUpdateRequest class],
+    [GTLMapsEnginePermissionsBatchUpdateResponse class],
+    [GTLMapsEnginePermissionsListResponse class],
+    [GTLMapsEnginePointStyle class],
+    [GTLMapsEnginePolygonStyle class],
+    [GTLMapsEngineProcessResponse class],
+    [GTLMapsEngineProject class],
+    [GTLMapsEngineProjectsListResponse class],
+    [GTLMapsEnginePublishedLayer class],
+    [GTLMapsEnginePublishedLayersListResponse class],
+    [GTLMapsEnginePublishedMap class],
+    [GTLMapsEnginePublishedMapsListResponse class],
+    [GTLMapsEnginePublishResponse class],
+    [GTLMapsEngineRaster class],
+    [GTLMapsEngineRasterCollection class],
+    [GTLMapsEngineRasterCollectionsListResponse class],
+    [GTLMapsEngineRasterCollectionsRaster class],
+    [GTLMapsEngineRasterCollectionsRasterBatchDeleteRequest class],
+    [GTLMapsEngineRasterCollectionsRastersBatchDeleteResponse class],
+    [GTLMapsEngineRasterCollectionsRastersBatchInsertRequest class],
+    [GTLMapsEngineRasterCollectionsRastersBatchInsertResponse class],
+    [GTLMapsEngineRasterCollectionsRastersListResponse class],
+    [GTLMapsEngineRastersListResponse class],
+    [GTLMapsEngineScaledShape class],
+    [GTLMapsEngineScalingFunction class],
+    [GTLMapsEngineSchema class],
+    [GTLMapsEngineSizeRange class],
+    [GTLMapsEngineTable class],
+    [GTLMapsEngineTableColumn class],
+    [GTLMapsEngineTablesListResponse class],
+    [GTLMapsEngineValueRange class],
+    [GTLMapsEngineVectorStyle class],
+    [GTLMapsEngineZoomLevels class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLMapsEngineAcquisitionTime_Precision_Day,
+    kGTLMapsEngineAcquisitionTime_Precision_Hour,
+    kGTLMapsEngineAcquisitionTime_Precision_Minute,
+    kGTLMapsEngineAcquisitionTime_Precision_Month,
+    kGTLMapsEngineAcquisitionTime_Precision_Second,
+    kGTLMapsEngineAcquisitionTime_Precision_Year,
+    kGTLMapsEngineAsset_Type_Layer,
+    kGTLMapsEngineAsset_Type_Map,
+    kGTLMapsEngineAsset_Type_Raster,
+    kGTLMapsEngineAsset_Type_RasterCollection,
+    kGTLMapsEngineAsset_Type_Table,
+    kGTLMapsEngineFile_UploadStatus_Canceled,
+    kGTLMapsEngineFile_UploadStatus_Complete,
+    kGTLMapsEngineFile_UploadStatus_Failed,
+    kGTLMapsEngineFile_UploadStatus_InProgress,
+    kGTLMapsEngineFilter_OperatorProperty_Contains,
+    kGTLMapsEngineFilter_OperatorProperty_EndsWith,
+    kGTLMapsEngineFilter_OperatorProperty_StartsWith,
+    kGTLMapsEngineFilter_OperatorProperty_X,
+    kGTLMapsEngineGeoJsonGeometryCollection_Type_GeometryCollection,
+    kGTLMapsEngineGeoJsonLineString_Type_LineString,
+    kGTLMapsEngineGeoJsonMultiLineString_Type_MultiLineString,
+    kGTLMapsEngineGeoJsonMultiPoint_Type_MultiPoint,
+    kGTLMapsEngineGeoJsonMultiPolygon_Type_MultiPolygon,
+    kGTLMapsEngineGeoJsonPoint_Type_Point,
+    kGTLMapsEngineGeoJsonPolygon_Type_Polygon,
+    kGTLMapsEngineLabelStyle_FontStyle_Italic,
+    kGTLMapsEngineLabelStyle_FontStyle_Normal,
+    kGTLMapsEngineLabelStyle_FontWeight_Bold,
+    kGTLMapsEngineLabelStyle_FontWeight_Normal,
+    kGTLMapsEngineLayer_DatasourceType_Image,
+    kGTLMapsEngineLayer_DatasourceType_Table,
+    kGTLMapsEngineLayer_LayerType_Image,
+    kGTLMapsEngineLayer_LayerType_Vector,
+    kGTLMapsEngineLayer_ProcessingStatus_Complete,
+    kGTLMapsEngineLayer_ProcessingStatus_Failed,
+    kGTLMapsEngineLayer_ProcessingStatus_NotReady,
+    kGTLMapsEngineLayer_ProcessingStatus_Processing,
+    kGTLMapsEngineLayer_ProcessingStatus_Ready,
+    kGTLMapsEngineLayer_PublishingStatus_NotPublished,
+    kGTLMapsEngineLayer_PublishingStatus_Published,
+    kGTLMapsEngineMap_ProcessingStatus_Complete,
+    kGTLMapsEngineMap_ProcessingStatus_Failed,
+    kGTLMapsEngineMap_ProcessingStatus_NotReady,
+    kGTLMapsEngineMap_ProcessingStatus_Processing,
+    kGTLMapsEngineMap_ProcessingStatus_Ready,
+    kGTLMapsEngineMap_PublishingStatus_NotPublished,
+    kGTLMapsEngineMap_PublishingStatus_Published,
+    kGTLMapsEngineMapFolder_Type_Folder,
+    kGTLMapsEngineMapKmlLink_Type_KmlLink,
+    kGTLMapsEngineMapLayer_Type_Layer,
+    kGTLMapsEnginePermission_Role_Owner,
+    kGTLMapsEnginePermission_Role_Reader,
+    kGTLMapsEnginePermission_Role_Viewer,
+    kGTLMapsEnginePermission_Role_Writer,
+    kGTLMapsEnginePermission_Type_Anyone,
+    kGTLMapsEnginePermission_Type_Group,
+    kGTLMapsEnginePermission_Type_User,
+    kGTLMapsEnginePublishedLayer_LayerType_Image,
+    kGTLMapsEnginePublishedLayer_LayerType_Vector,
+    kGTLMapsEngineRaster_ProcessingStatus_Complete,
+    kGTLMapsEngineRaster_ProcessingStatus_Failed,
+    kGTLMapsEngineRaster_ProcessingStatus_NotReady,
+    kGTLMapsEngineRaster_ProcessingStatus_Processing,
+    kGTLMapsEngineRaster_ProcessingStatus_Ready,
+    kGTLMapsEngineRaster_RasterType_Image,
+    kGTLMapsEngineRasterCollection_ProcessingStatus_Complete,
+    kGTLMapsEngineRasterCollection_ProcessingStatus_Failed,
+    kGTLMapsEngineRasterCollection_ProcessingStatus_NotReady,
+    kGTLMapsEngineRasterCollection_ProcessingStatus_Processing,
+    kGTLMapsEngineRasterCollection_ProcessingStatus_Ready,
+    kGTLMapsEngineRasterCollection_RasterType_Image,
+    kGTLMapsEngineScaledShape_Shape_Circle,
+    kGTLMapsEngineScalingFunction_ScalingType_Linear,
+    kGTLMapsEngineScalingFunction_ScalingType_Sqrt,
+    kGTLMapsEngineTable_ProcessingStatus_Complete,
+    kGTLMapsEngineTable_ProcessingStatus_Failed,
+    kGTLMapsEngineTable_ProcessingStatus_NotReady,
+    kGTLMapsEngineTable_ProcessingStatus_Processing,
+    kGTLMapsEngineTable_ProcessingStatus_Ready,
+    kGTLMapsEngineTableColumn_Type_Datetime,
+    kGTLMapsEngineTableColumn_Type_Double,
+    kGTLMapsEngineTableColumn_Type_Integer,
+    kGTLMapsEngineTableColumn_Type_LineStrings,
+    kGTLMapsEngineTableColumn_Type_MixedGeometry,
+    kGTLMapsEngineTableColumn_Type_Points,
+    kGTLMapsEngineTableColumn_Type_Polygons,
+    kGTLMapsEngineTableColumn_Type_String,
+    kGTLMapsEngineVectorStyle_Type_DisplayRule,
+    kGTLMapsEngineProcessingStatusComplete,
+    kGTLMapsEngineProcessingStatusFailed,
+    kGTLMapsEngineProcessingStatusNotReady,
+    kGTLMapsEngineProcessingStatusProcessing,
+    kGTLMapsEngineProcessingStatusReady,
+    kGTLMapsEngineRoleOwner,
+    kGTLMapsEngineRoleReader,
+    kGTLMapsEngineRoleWriter,
+    kGTLMapsEngineVersionDraft,
+    kGTLMapsEngineVersionPublished
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
@@ -63,6 +63,41 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryMirror class],
+    [GTLMirrorAccount class],
+    [GTLMirrorAttachment class],
+    [GTLMirrorAttachmentsListResponse class],
+    [GTLMirrorAuthToken class],
+    [GTLMirrorCommand class],
+    [GTLMirrorContact class],
+    [GTLMirrorContactsListResponse class],
+    [GTLMirrorLocation class],
+    [GTLMirrorLocationsListResponse class],
+    [GTLMirrorMenuItem class],
+    [GTLMirrorMenuValue class],
+    [GTLMirrorNotification class],
+    [GTLMirrorNotificationConfig class],
+    [GTLMirrorSetting class],
+    [GTLMirrorSubscription class],
+    [GTLMirrorSubscriptionsListResponse class],
+    [GTLMirrorTimelineItem class],
+    [GTLMirrorTimelineListResponse class],
+    [GTLMirrorUserAction class],
+    [GTLMirrorUserData class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLMirrorOrderByDisplayTime,
+    kGTLMirrorOrderByWriteTime
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
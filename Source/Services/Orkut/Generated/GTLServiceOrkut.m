@@ -73,6 +73,64 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryOrkut class],
+    [GTLOrkutAcl class],
+    [GTLOrkutAclItemsItem class],
+    [GTLOrkutActivity class],
+    [GTLOrkutActivityObject class],
+    [GTLOrkutActivityObjectReplies class],
+    [GTLOrkutActivityList class],
+    [GTLOrkutActivityobjectsResource class],
+    [GTLOrkutActivitypersonResource class],
+    [GTLOrkutActivitypersonResourceImage class],
+    [GTLOrkutActivitypersonResourceName class],
+    [GTLOrkutAuthorResource class],
+    [GTLOrkutAuthorResourceImage class],
+    [GTLOrkutBadge class],
+    [GTLOrkutBadgeList class],
+    [GTLOrkutComment class],
+    [GTLOrkutCommentInReplyTo class],
+    [GTLOrkutCommentList class],
+    [GTLOrkutCommunity class],
+    [GTLOrkutCommunityList class],
+    [GTLOrkutCommunityMembers class],
+    [GTLOrkutCommunityMembershipStatus class],
+    [GTLOrkutCommunityMembersList class],
+    [GTLOrkutCommunityMessage class],
+    [GTLOrkutCommunityMessageList class],
+    [GTLOrkutCommunityPoll class],
+    [GTLOrkutCommunityPollImage class],
+    [GTLOrkutCommunityPollComment class],
+    [GTLOrkutCommunityPollCommentList class],
+    [GTLOrkutCommunityPollList class],
+    [GTLOrkutCommunitypolloptionResource class],
+    [GTLOrkutCommunitypolloptionResourceImage class],
+    [GTLOrkutCommunityPollVote class],
+    [GTLOrkutCommunityTopic class],
+    [GTLOrkutCommunityTopicList class],
+    [GTLOrkutCounterResource class],
+    [GTLOrkutCounters class],
+    [GTLOrkutLinkResource class],
+    [GTLOrkutVisibility class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLOrkutCollectionAll,
+    kGTLOrkutCollectionScraps,
+    kGTLOrkutCollectionStream,
+    kGTLOrkutOrderByAscending,
+    kGTLOrkutOrderByDescending,
+    kGTLOrkutOrderById,
+    kGTLOrkutOrderByRanked
+  ];
+  return strings;
+}
+
 - (id)init {
   self = [super init];
   if (self) {
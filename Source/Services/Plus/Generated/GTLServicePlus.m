@@ -55,6 +55,78 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryPlus class],
+    [GTLPlusAcl class],
+    [GTLPlusAclentryResource class],
+    [GTLPlusActivity class],
+    [GTLPlusActivityActor class],
+    [GTLPlusActivityObject class],
+    [GTLPlusActivityProvider class],
+    [GTLPlusActivityActorImage class],
+    [GTLPlusActivityActorName class],
+    [GTLPlusActivityActorVerification class],
+    [GTLPlusActivityObjectActor class],
+    [GTLPlusActivityObjectAttachmentsItem class],
+    [GTLPlusActivityObjectPlusoners class],
+    [GTLPlusActivityObjectReplies class],
+    [GTLPlusActivityObjectResharers class],
+    [GTLPlusActivityObjectActorImage class],
+    [GTLPlusActivityObjectActorVerification class],
+    [GTLPlusActivityObjectAttachmentsItemEmbed class],
+    [GTLPlusActivityObjectAttachmentsItemFullImage class],
+    [GTLPlusActivityObjectAttachmentsItemImage class],
+    [GTLPlusActivityObjectAttachmentsItemThumbnailsItem class],
+    [GTLPlusActivityObjectAttachmentsItemThumbnailsItemImage class],
+    [GTLPlusActivityFeed class],
+    [GTLPlusComment class],
+    [GTLPlusCommentActor class],
+    [GTLPlusCommentInReplyToItem class],
+    [GTLPlusCommentObject class],
+    [GTLPlusCommentPlusoners class],
+    [GTLPlusCommentActorImage class],
+    [GTLPlusCommentActorVerification class],
+    [GTLPlusCommentFeed class],
+    [GTLPlusItemScope class],
+    [GTLPlusMoment class],
+    [GTLPlusMomentsFeed class],
+    [GTLPlusPeopleFeed class],
+    [GTLPlusPerson class],
+    [GTLPlusPersonAgeRange class],
+    [GTLPlusPersonCover class],
+    [GTLPlusPersonEmailsItem class],
+    [GTLPlusPersonImage class],
+    [GTLPlusPersonName class],
+    [GTLPlusPersonOrganizationsItem class],
+    [GTLPlusPersonPlacesLivedItem class],
+    [GTLPlusPersonUrlsItem class],
+    [GTLPlusPersonCoverCoverInfo class],
+    [GTLPlusPersonCoverCoverPhoto class],
+    [GTLPlusPlace class],
+    [GTLPlusPlaceAddress class],
+    [GTLPlusPlacePosition class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLPlusCollectionConnected,
+    kGTLPlusCollectionPlusoners,
+    kGTLPlusCollectionPublic,
+    kGTLPlusCollectionResharers,
+    kGTLPlusCollectionVault,
+    kGTLPlusCollectionVisible,
+    kGTLPlusOrderByAlphabetical,
+    kGTLPlusOrderByBest,
+    kGTLPlusOrderByRecent,
+    kGTLPlusSortOrderAscending,
+    kGTLPlusSortOrderDescending
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
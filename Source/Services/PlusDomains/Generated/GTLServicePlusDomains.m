@@ -58,6 +58,85 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryPlusDomains class],
+    [GTLPlusDomainsAcl class],
+    [GTLPlusDomainsAclentryResource class],
+    [GTLPlusDomainsActivity class],
+    [GTLPlusDomainsActivityActor class],
+    [GTLPlusDomainsActivityObject class],
+    [GTLPlusDomainsActivityProvider class],
+    [GTLPlusDomainsActivityActorImage class],
+    [GTLPlusDomainsActivityActorName class],
+    [GTLPlusDomainsActivityActorVerification class],
+    [GTLPlusDomainsActivityObjectActor class],
+    [GTLPlusDomainsActivityObjectAttachmentsItem class],
+    [GTLPlusDomainsActivityObjectPlusoners class],
+    [GTLPlusDomainsActivityObjectReplies class],
+    [GTLPlusDomainsActivityObjectResharers class],
+    [GTLPlusDomainsActivityObjectStatusForViewer class],
+    [GTLPlusDomainsActivityObjectActorImage class],
+    [GTLPlusDomainsActivityObjectActorVerification class],
+    [GTLPlusDomainsActivityObjectAttachmentsItemEmbed class],
+    [GTLPlusDomainsActivityObjectAttachmentsItemFullImage class],
+    [GTLPlusDomainsActivityObjectAttachmentsItemImage class],
+    [GTLPlusDomainsActivityObjectAttachmentsItemPreviewThumbnailsItem class],
+    [GTLPlusDomainsActivityObjectAttachmentsItemThumbnailsItem class],
+    [GTLPlusDomainsActivityObjectAttachmentsItemThumbnailsItemImage class],
+    [GTLPlusDomainsActivityFeed class],
+    [GTLPlusDomainsAudience class],
+    [GTLPlusDomainsAudiencesFeed class],
+    [GTLPlusDomainsCircle class],
+    [GTLPlusDomainsCirclePeople class],
+    [GTLPlusDomainsCircleFeed class],
+    [GTLPlusDomainsComment class],
+    [GTLPlusDomainsCommentActor class],
+    [GTLPlusDomainsCommentInReplyToItem class],
+    [GTLPlusDomainsCommentObject class],
+    [GTLPlusDomainsCommentPlusoners class],
+    [GTLPlusDomainsCommentActorImage class],
+    [GTLPlusDomainsCommentActorVerification class],
+    [GTLPlusDomainsCommentFeed class],
+    [GTLPlusDomainsMedia class],
+    [GTLPlusDomainsMediaAuthor class],
+    [GTLPlusDomainsMediaExif class],
+    [GTLPlusDomainsMediaAuthorImage class],
+    [GTLPlusDomainsPeopleFeed class],
+    [GTLPlusDomainsPerson class],
+    [GTLPlusDomainsPersonCover class],
+    [GTLPlusDomainsPersonEmailsItem class],
+    [GTLPlusDomainsPersonImage class],
+    [GTLPlusDomainsPersonName class],
+    [GTLPlusDomainsPersonOrganizationsItem class],
+    [GTLPlusDomainsPersonPlacesLivedItem class],
+    [GTLPlusDomainsPersonUrlsItem class],
+    [GTLPlusDomainsPersonCoverCoverInfo class],
+    [GTLPlusDomainsPersonCoverCoverPhoto class],
+    [GTLPlusDomainsPlace class],
+    [GTLPlusDomainsPlaceAddress class],
+    [GTLPlusDomainsPlacePosition class],
+    [GTLPlusDomainsVideostream class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLPlusDomainsCollectionCircled,
+    kGTLPlusDomainsCollectionCloud,
+    kGTLPlusDomainsCollectionPlusoners,
+    kGTLPlusDomainsCollectionResharers,
+    kGTLPlusDomainsCollectionSharedto,
+    kGTLPlusDomainsCollectionUser,
+    kGTLPlusDomainsOrderByAlphabetical,
+    kGTLPlusDomainsOrderByBest,
+    kGTLPlusDomainsSortOrderAscending,
+    kGTLPlusDomainsSortOrderDescending
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
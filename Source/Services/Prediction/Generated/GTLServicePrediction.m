@@ -48,6 +48,33 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryPrediction class],
+    [GTLPredictionAnalyze class],
+    [GTLPredictionAnalyzeDataDescription class],
+    [GTLPredictionAnalyzeErrorsItem class],
+    [GTLPredictionAnalyzeModelDescription class],
+    [GTLPredictionAnalyzeDataDescriptionFeaturesItem class],
+    [GTLPredictionAnalyzeDataDescriptionOutputFeature class],
+    [GTLPredictionAnalyzeModelDescriptionConfusionMatrix class],
+    [GTLPredictionAnalyzeModelDescriptionConfusionMatrixRowTotals class],
+    [GTLPredictionAnalyzeDataDescriptionFeaturesItemCategorical class],
+    [GTLPredictionAnalyzeDataDescriptionFeaturesItemNumeric class],
+    [GTLPredictionAnalyzeDataDescriptionFeaturesItemText class],
+    [GTLPredictionAnalyzeDataDescriptionOutputFeatureNumeric class],
+    [GTLPredictionAnalyzeDataDescriptionOutputFeatureTextItem class],
+    [GTLPredictionAnalyzeModelDescriptionConfusionMatrixConfusionMatrix class],
+    [GTLPredictionAnalyzeDataDescriptionFeaturesItemCategoricalValuesItem class],
+    [GTLPredictionInsert2 class],
+    [GTLPredictionInsert2ModelInfo class],
+    [GTLPredictionList class],
+    [GTLPredictionOutput class],
+    [GTLPredictionOutputOutputMultiItem class]
+  ];
+  return classes;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
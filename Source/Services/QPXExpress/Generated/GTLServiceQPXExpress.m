@@ -67,6 +67,36 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryQPXExpress class],
+    [GTLQPXExpressAircraftData class],
+    [GTLQPXExpressAirportData class],
+    [GTLQPXExpressBagDescriptor class],
+    [GTLQPXExpressCarrierData class],
+    [GTLQPXExpressCityData class],
+    [GTLQPXExpressData class],
+    [GTLQPXExpressFareInfo class],
+    [GTLQPXExpressFlightInfo class],
+    [GTLQPXExpressFreeBaggageAllowance class],
+    [GTLQPXExpressLegInfo class],
+    [GTLQPXExpressPassengerCounts class],
+    [GTLQPXExpressPricingInfo class],
+    [GTLQPXExpressSegmentInfo class],
+    [GTLQPXExpressSegmentPricing class],
+    [GTLQPXExpressSliceInfo class],
+    [GTLQPXExpressSliceInput class],
+    [GTLQPXExpressTaxData class],
+    [GTLQPXExpressTaxInfo class],
+    [GTLQPXExpressTimeOfDayRange class],
+    [GTLQPXExpressTripOption class],
+    [GTLQPXExpressTripOptionsRequest class],
+    [GTLQPXExpressTripOptionsResponse class],
+    [GTLQPXExpressTripsSearchResponse class]
+  ];
+  return classes;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
@@ -70,6 +70,40 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQuerySpectrum class],
+    [GTLSpectrumAntennaCharacteristics class],
+    [GTLSpectrumDatabaseSpec class],
+    [GTLSpectrumDbUpdateSpec class],
+    [GTLSpectrumDeviceCapabilities class],
+    [GTLSpectrumDeviceDescriptor class],
+    [GTLSpectrumDeviceOwner class],
+    [GTLSpectrumDeviceValidity class],
+    [GTLSpectrumEventTime class],
+    [GTLSpectrumFrequencyRange class],
+    [GTLSpectrumGeoLocation class],
+    [GTLSpectrumGeoLocationEllipse class],
+    [GTLSpectrumGeoLocationPoint class],
+    [GTLSpectrumGeoLocationPolygon class],
+    [GTLSpectrumGeoSpectrumSchedule class],
+    [GTLSpectrumMessage class],
+    [GTLSpectrumPawsGetSpectrumBatchResponse class],
+    [GTLSpectrumPawsGetSpectrumResponse class],
+    [GTLSpectrumPawsInitResponse class],
+    [GTLSpectrumPawsNotifySpectrumUseResponse class],
+    [GTLSpectrumPawsRegisterResponse class],
+    [GTLSpectrumPawsVerifyDeviceResponse class],
+    [GTLSpectrumRulesetInfo class],
+    [GTLSpectrumSchedule class],
+    [GTLSpectrumVcard class],
+    [GTLSpectrumVcardAddress class],
+    [GTLSpectrumVcardTelephone class],
+    [GTLSpectrumVcardTypedText class]
+  ];
+  return classes;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
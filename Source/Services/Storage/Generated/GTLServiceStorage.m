@@ -53,6 +53,64 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryStorage class],
+    [GTLStorageBucket class],
+    [GTLStorageBucketCorsItem class],
+    [GTLStorageBucketLifecycle class],
+    [GTLStorageBucketLogging class],
+    [GTLStorageBucketOwner class],
+    [GTLStorageBucketVersioning class],
+    [GTLStorageBucketWebsite class],
+    [GTLStorageBucketLifecycleRuleItem class],
+    [GTLStorageBucketLifecycleRuleItemAction class],
+    [GTLStorageBucketLifecycleRuleItemCondition class],
+    [GTLStorageBucketAccessControl class],
+    [GTLStorageBucketAccessControlProjectTeam class],
+    [GTLStorageBucketAccessControls class],
+    [GTLStorageBuckets class],
+    [GTLStorageChannel class],
+    [GTLStorageChannelParams class],
+    [GTLStorageObject class],
+    [GTLStorageObjectMetadata class],
+    [GTLStorageObjectOwner class],
+    [GTLStorageObjectAccessControl class],
+    [GTLStorageObjectAccessControlProjectTeam class],
+    [GTLStorageObjectAccessControls class],
+    [GTLStorageObjects class],
+    [GTLStorageRewriteResponse class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLStorageDestinationPredefinedAclAuthenticatedRead,
+    kGTLStorageDestinationPredefinedAclBucketOwnerFullControl,
+    kGTLStorageDestinationPredefinedAclBucketOwnerRead,
+    kGTLStorageDestinationPredefinedAclPrivate,
+    kGTLStorageDestinationPredefinedAclProjectPrivate,
+    kGTLStorageDestinationPredefinedAclPublicRead,
+    kGTLStoragePredefinedAclAuthenticatedRead,
+    kGTLStoragePredefinedAclBucketOwnerFullControl,
+    kGTLStoragePredefinedAclBucketOwnerRead,
+    kGTLStoragePredefinedAclPrivate,
+    kGTLStoragePredefinedAclProjectPrivate,
+    kGTLStoragePredefinedAclPublicRead,
+    kGTLStoragePredefinedAclPublicReadWrite,
+    kGTLStoragePredefinedDefaultObjectAclAuthenticatedRead,
+    kGTLStoragePredefinedDefaultObjectAclBucketOwnerFullControl,
+    kGTLStoragePredefinedDefaultObjectAclBucketOwnerRead,
+    kGTLStoragePredefinedDefaultObjectAclPrivate,
+    kGTLStoragePredefinedDefaultObjectAclProjectPrivate,
+    kGTLStoragePredefinedDefaultObjectAclPublicRead,
+    kGTLStorageProjectionFull,
+    kGTLStorageProjectionNoAcl
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
@@ -47,6 +47,18 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryTasks class],
+    [GTLTasksTask class],
+    [GTLTasksTaskLinksItem class],
+    [GTLTasksTaskList class],
+    [GTLTasksTaskLists class],
+    [GTLTasksTasks class]
+  ];
+  return classes;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
@@ -48,6 +48,27 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryUrlshortener class],
+    [GTLUrlshortenerAnalyticsSnapshot class],
+    [GTLUrlshortenerAnalyticsSummary class],
+    [GTLUrlshortenerStringCount class],
+    [GTLUrlshortenerUrl class],
+    [GTLUrlshortenerUrlHistory class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLUrlshortenerProjectionAnalyticsClicks,
+    kGTLUrlshortenerProjectionAnalyticsTopStrings,
+    kGTLUrlshortenerProjectionFull
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
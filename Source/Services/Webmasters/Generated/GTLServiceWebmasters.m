@@ -58,6 +58,45 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryWebmasters class],
+    [GTLWebmastersApiDataRow class],
+    [GTLWebmastersApiDimensionFilter class],
+    [GTLWebmastersApiDimensionFilterGroup class],
+    [GTLWebmastersSearchAnalyticsQueryResponse class],
+    [GTLWebmastersSitemapsListResponse class],
+    [GTLWebmastersSitesListResponse class],
+    [GTLWebmastersUrlCrawlErrorCount class],
+    [GTLWebmastersUrlCrawlErrorCountsPerType class],
+    [GTLWebmastersUrlCrawlErrorsCountsQueryResponse class],
+    [GTLWebmastersUrlCrawlErrorsSample class],
+    [GTLWebmastersUrlCrawlErrorsSamplesListResponse class],
+    [GTLWebmastersUrlSampleDetails class],
+    [GTLWebmastersWmxSite class],
+    [GTLWebmastersWmxSitemap class],
+    [GTLWebmastersWmxSitemapContent class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLWebmastersCategoryAuthPermissions,
+    kGTLWebmastersCategoryManyToOneRedirect,
+    kGTLWebmastersCategoryNotFollowed,
+    kGTLWebmastersCategoryNotFound,
+    kGTLWebmastersCategoryOther,
+    kGTLWebmastersCategoryRoboted,
+    kGTLWebmastersCategoryServerError,
+    kGTLWebmastersCategorySoft404,
+    kGTLWebmastersPlatformMobile,
+    kGTLWebmastersPlatformSmartphoneOnly,
+    kGTLWebmastersPlatformWeb
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
@@ -193,6 +193,906 @@
 }
 #endif  // DEBUG
 
++ (NSArray *)objectClasses {
+  NSArray *classes = @[
+    [GTLQueryYouTube class],
+    [GTLYouTubeAccessPolicy class],
+    [GTLYouTubeActivity class],
+    [GTLYouTubeActivityContentDetails class],
+    [GTLYouTubeActivityContentDetailsBulletin class],
+    [GTLYouTubeActivityContentDetailsChannelItem class],
+    [GTLYouTubeActivityContentDetailsComment class],
+    [GTLYouTubeActivityContentDetailsFavorite class],
+    [GTLYouTubeActivityContentDetailsLike class],
+    [GTLYouTubeActivityContentDetailsPlaylistItem class],
+    [GTLYouTubeActivityContentDetailsPromotedItem class],
+    [GTLYouTubeActivityContentDetailsRecommendation class],
+    [GTLYouTubeActivityContentDetailsSocial class],
+    [GTLYouTubeActivityContentDetailsSubscription class],
+    [GTLYouTubeActivityContentDetailsUpload class],
+    [GTLYouTubeActivityListResponse class],
+    [GTLYouTubeActivitySnippet class],
+    [GTLYouTubeCaption class],
+    [GTLYouTubeCaptionListResponse class],
+    [GTLYouTubeCaptionSnippet class],
+    [GTLYouTubeCdnSettings class],
+    [GTLYouTubeChannel class],
+    [GTLYouTubeChannelLocalizations class],
+    [GTLYouTubeChannelAuditDetails class],
+    [GTLYouTubeChannelBannerResource class],
+    [GTLYouTubeChannelBrandingSettings class],
+    [GTLYouTubeChannelContentDetails class],
+    [GTLYouTubeChannelContentDetailsRelatedPlaylists class],
+    [GTLYouTubeChannelContentOwnerDetails class],
+    [GTLYouTubeChannelConversionPing class],
+    [GTLYouTubeChannelConversionPings class],
+    [GTLYouTubeChannelId class],
+    [GTLYouTubeChannelListResponse class],
+    [GTLYouTubeChannelLocalization class],
+    [GTLYouTubeChannelSection class],
+    [GTLYouTubeChannelSectionLocalizations class],
+    [GTLYouTubeChannelSectionContentDetails class],
+    [GTLYouTubeChannelSectionListResponse class],
+    [GTLYouTubeChannelSectionLocalization class],
+    [GTLYouTubeChannelSectionSnippet class],
+    [GTLYouTubeChannelSectionTargeting class],
+    [GTLYouTubeChannelSettings class],
+    [GTLYouTubeChannelSnippet class],
+    [GTLYouTubeChannelStatistics class],
+    [GTLYouTubeChannelStatus class],
+    [GTLYouTubeChannelTopicDetails class],
+    [GTLYouTubeComment class],
+    [GTLYouTubeCommentListResponse class],
+    [GTLYouTubeCommentSnippet class],
+    [GTLYouTubeCommentThread class],
+    [GTLYouTubeCommentThreadListResponse class],
+    [GTLYouTubeCommentThreadReplies class],
+    [GTLYouTubeCommentThreadSnippet class],
+    [GTLYouTubeContentRating class],
+    [GTLYouTubeGeoPoint class],
+    [GTLYouTubeGuideCategory class],
+    [GTLYouTubeGuideCategoryListResponse class],
+    [GTLYouTubeGuideCategorySnippet class],
+    [GTLYouTubeI18nLanguage class],
+    [GTLYouTubeI18nLanguageListResponse class],
+    [GTLYouTubeI18nLanguageSnippet class],
+    [GTLYouTubeI18nRegion class],
+    [GTLYouTubeI18nRegionListResponse class],
+    [GTLYouTubeI18nRegionSnippet class],
+    [GTLYouTubeImageSettings class],
+    [GTLYouTubeIngestionInfo class],
+    [GTLYouTubeInvideoBranding class],
+    [GTLYouTubeInvideoPosition class],
+    [GTLYouTubeInvideoPromotion class],
+    [GTLYouTubeInvideoTiming class],
+    [GTLYouTubeLanguageTag class],
+    [GTLYouTubeLiveBroadcast class],
+    [GTLYouTubeLiveBroadcastContentDetails class],
+    [GTLYouTubeLiveBroadcastListResponse class],
+    [GTLYouTubeLiveBroadcastSnippet class],
+    [GTLYouTubeLiveBroadcastStatistics class],
+    [GTLYouTubeLiveBroadcastStatus class],
+    [GTLYouTubeLiveBroadcastTopic class],
+    [GTLYouTubeLiveBroadcastTopicDetails class],
+    [GTLYouTubeLiveBroadcastTopicSnippet class],
+    [GTLYouTubeLiveStream class],
+    [GTLYouTubeLiveStreamConfigurationIssue class],
+    [GTLYouTubeLiveStreamContentDetails class],
+    [GTLYouTubeLiveStreamHealthStatus class],
+    [GTLYouTubeLiveStreamListResponse class],
+    [GTLYouTubeLiveStreamSnippet class],
+    [GTLYouTubeLiveStreamStatus class],
+    [GTLYouTubeLocalizedProperty class],
+    [GTLYouTubeLocalizedString class],
+    [GTLYouTubeMonitorStreamInfo class],
+    [GTLYouTubePageInfo class],
+    [GTLYouTubePlaylist class],
+    [GTLYouTubePlaylistLocalizations class],
+    [GTLYouTubePlaylistContentDetails class],
+    [GTLYouTubePlaylistItem class],
+    [GTLYouTubePlaylistItemContentDetails class],
+    [GTLYouTubePlaylistItemListResponse class],
+    [GTLYouTubePlaylistItemSnippet class],
+    [GTLYouTubePlaylistItemStatus class],
+    [GTLYouTubePlaylistListResponse class],
+    [GTLYouTubePlaylistLocalization class],
+    [GTLYouTubePlaylistPlayer class],
+    [GTLYouTubePlaylistSnippet class],
+    [GTLYouTubePlaylistStatus class],
+    [GTLYouTubePromotedItem class],
+    [GTLYouTubePromotedItemId class],
+    [GTLYouTubePropertyValue class],
+    [GTLYouTubeResourceId class],
+    [GTLYouTubeSearchListResponse class],
+    [GTLYouTubeSearchResult class],
+    [GTLYouTubeSearchResultSnippet class],
+    [GTLYouTubeSubscription class],
+    [GTLYouTubeSubscriptionContentDetails class],
+    [GTLYouTubeSubscriptionListResponse class],
+    [GTLYouTubeSubscriptionSnippet class],
+    [GTLYouTubeSubscriptionSubscriberSnippet class],
+    [GTLYouTubeThumbnail class],
+    [GTLYouTubeThumbnailDetails class],
+    [GTLYouTubeThumbnailSetResponse class],
+    [GTLYouTubeTokenPagination class],
+    [GTLYouTubeVideo class],
+    [GTLYouTubeVideoLocalizations class],
+    [GTLYouTubeVideoAbuseReport class],
+    [GTLYouTubeVideoAbuseReportReason class],
+    [GTLYouTubeVideoAbuseReportReasonListResponse class],
+    [GTLYouTubeVideoAbuseReportReasonSnippet class],
+    [GTLYouTubeVideoAbuseReportSecondaryReason class],
+    [GTLYouTubeVideoAgeGating class],
+    [GTLYouTubeVideoCategory class],
+    [GTLYouTubeVideoCategoryListResponse class],
+    [GTLYouTubeVideoCategorySnippet class],
+    [GTLYouTubeVideoContentDetails class],
+    [GTLYouTubeVideoContentDetailsRegionRestriction class],
+    [GTLYouTubeVideoConversionPing class],
+    [GTLYouTubeVideoConversionPings class],
+    [GTLYouTubeVideoFileDetails class],
+    [GTLYouTubeVideoFileDetailsAudioStream class],
+    [GTLYouTubeVideoFileDetailsVideoStream class],
+    [GTLYouTubeVideoGetRatingResponse class],
+    [GTLYouTubeVideoListResponse class],
+    [GTLYouTubeVideoLiveStreamingDetails class],
+    [GTLYouTubeVideoLocalization class],
+    [GTLYouTubeVideoMonetizationDetails class],
+    [GTLYouTubeVideoPlayer class],
+    [GTLYouTubeVideoProcessingDetails class],
+    [GTLYouTubeVideoProcessingDetailsProcessingProgress class],
+    [GTLYouTubeVideoProjectDetails class],
+    [GTLYouTubeVideoRating class],
+    [GTLYouTubeVideoRecordingDetails class],
+    [GTLYouTubeVideoSnippet class],
+    [GTLYouTubeVideoStatistics class],
+    [GTLYouTubeVideoStatus class],
+    [GTLYouTubeVideoSuggestions class],
+    [GTLYouTubeVideoSuggestionsTagSuggestion class],
+    [GTLYouTubeVideoTopicDetails class],
+    [GTLYouTubeWatchSettings class]
+  ];
+  return classes;
+}
+
++ (NSArray *)constantStrings {
+  NSArray *strings = @[
+    kGTLYouTubeBroadcastStatusActive,
+    kGTLYouTubeBroadcastStatusAll,
+    kGTLYouTubeBroadcastStatusComplete,
+    kGTLYouTubeBroadcastStatusCompleted,
+    kGTLYouTubeBroadcastStatusLive,
+    kGTLYouTubeBroadcastStatusTesting,
+    kGTLYouTubeBroadcastStatusUpcoming,
+    kGTLYouTubeChannelTypeAny,
+    kGTLYouTubeChannelTypeShow,
+    kGTLYouTubeChartMostPopular,
+    kGTLYouTubeEventTypeCompleted,
+    kGTLYouTubeEventTypeLive,
+    kGTLYouTubeEventTypeUpcoming,
+    kGTLYouTubeModerationStatusHeldForReview,
+    kGTLYouTubeModerationStatusLikelySpam,
+    kGTLYouTubeModerationStatusPublished,
+    kGTLYouTubeModerationStatusRejected,
+    kGTLYouTubeMyRatingDislike,
+    kGTLYouTubeMyRatingLike,
+    kGTLYouTubeOrderAlphabetical,
+    kGTLYouTubeOrderDate,
+    kGTLYouTubeOrderRating,
+    kGTLYouTubeOrderRelevance,
+    kGTLYouTubeOrderTime,
+    kGTLYouTubeOrderTitle,
+    kGTLYouTubeOrderUnread,
+    kGTLYouTubeOrderVideoCount,
+    kGTLYouTubeOrderViewCount,
+    kGTLYouTubeRatingDislike,
+    kGTLYouTubeRatingLike,
+    kGTLYouTubeRatingNone,
+    kGTLYouTubeSafeSearchModerate,
+    kGTLYouTubeSafeSearchNone,
+    kGTLYouTubeSafeSearchStrict,
+    kGTLYouTubeTextFormatHtml,
+    kGTLYouTubeTextFormatPlainText,
+    kGTLYouTubeTfmtSbv,
+    kGTLYouTubeTfmtScc,
+    kGTLYouTubeTfmtSrt,
+    kGTLYouTubeTfmtTtml,
+    kGTLYouTubeTfmtVtt,
+    kGTLYouTubeVideoCaptionAny,
+    kGTLYouTubeVideoCaptionClosedCaption,
+    kGTLYouTubeVideoCaptionNone,
+    kGTLYouTubeVideoDefinitionAny,
+    kGTLYouTubeVideoDefinitionHigh,
+    kGTLYouTubeVideoDefinitionStandard,
+    kGTLYouTubeVideoDimensionAny,
+    kGTLYouTubeVideoDimensionX2d,
+    kGTLYouTubeVideoDimensionX3d,
+    kGTLYouTubeVideoDurationAny,
+    kGTLYouTubeVideoDurationLong,
+    kGTLYouTubeVideoDurationMedium,
+    kGTLYouTubeVideoDurationShort,
+    kGTLYouTubeVideoEmbeddableAny,
+    kGTLYouTubeVideoEmbeddableTrue,
+    kGTLYouTubeVideoLicenseAny,
+    kGTLYouTubeVideoLicenseCreativeCommon,
+    kGTLYouTubeVideoLicenseYoutube,
+    kGTLYouTubeVideoSyndicatedAny,
+    kGTLYouTubeVideoSyndicatedTrue,
+    kGTLYouTubeVideoTypeAny,
+    kGTLYouTubeVideoTypeEpisode,
+    kGTLYouTubeVideoTypeMovie,
+    kGTLYouTubeActivityContentDetailsPromotedItem_CtaType_Unspecified,
+    kGTLYouTubeActivityContentDetailsPromotedItem_CtaType_VisitAdvertiserSite,
+    kGTLYouTubeActivityContentDetailsRecommendation_Reason_Unspecified,
+    kGTLYouTubeActivityContentDetailsRecommendation_Reason_VideoFavorited,
+    kGTLYouTubeActivityContentDetailsRecommendation_Reason_VideoLiked,
+    kGTLYouTubeActivityContentDetailsRecommendation_Reason_VideoWatched,
+    kGTLYouTubeActivityContentDetailsSocial_Type_Facebook,
+    kGTLYouTubeActivityContentDetailsSocial_Type_GooglePlus,
+    kGTLYouTubeActivityContentDetailsSocial_Type_Twitter,
+    kGTLYouTubeActivityContentDetailsSocial_Type_Unspecified,
+    kGTLYouTubeActivitySnippet_Type_Bulletin,
+    kGTLYouTubeActivitySnippet_Type_ChannelItem,
+    kGTLYouTubeActivitySnippet_Type_Comment,
+    kGTLYouTubeActivitySnippet_Type_Favorite,
+    kGTLYouTubeActivitySnippet_Type_Like,
+    kGTLYouTubeActivitySnippet_Type_PlaylistItem,
+    kGTLYouTubeActivitySnippet_Type_PromotedItem,
+    kGTLYouTubeActivitySnippet_Type_Recommendation,
+    kGTLYouTubeActivitySnippet_Type_Social,
+    kGTLYouTubeActivitySnippet_Type_Subscription,
+    kGTLYouTubeActivitySnippet_Type_Upload,
+    kGTLYouTubeCaptionSnippet_AudioTrackType_Commentary,
+    kGTLYouTubeCaptionSnippet_AudioTrackType_Descriptive,
+    kGTLYouTubeCaptionSnippet_AudioTrackType_Primary,
+    kGTLYouTubeCaptionSnippet_AudioTrackType_Unknown,
+    kGTLYouTubeCaptionSnippet_FailureReason_ProcessingFailed,
+    kGTLYouTubeCaptionSnippet_FailureReason_UnknownFormat,
+    kGTLYouTubeCaptionSnippet_FailureReason_UnsupportedFormat,
+    kGTLYouTubeCaptionSnippet_Status_Failed,
+    kGTLYouTubeCaptionSnippet_Status_Serving,
+    kGTLYouTubeCaptionSnippet_Status_Syncing,
+    kGTLYouTubeCaptionSnippet_TrackKind_Asr,
+    kGTLYouTubeCaptionSnippet_TrackKind_Forced,
+    kGTLYouTubeCaptionSnippet_TrackKind_Standard,
+    kGTLYouTubeCdnSettings_IngestionType_Dash,
+    kGTLYouTubeCdnSettings_IngestionType_Rtmp,
+    kGTLYouTubeChannelConversionPing_Context_Cview,
+    kGTLYouTubeChannelConversionPing_Context_Subscribe,
+    kGTLYouTubeChannelConversionPing_Context_Unsubscribe,
+    kGTLYouTubeChannelSectionSnippet_Style_ChannelsectionStyleUndefined,
+    kGTLYouTubeChannelSectionSnippet_Style_HorizontalRow,
+    kGTLYouTubeChannelSectionSnippet_Style_VerticalList,
+    kGTLYouTubeChannelSectionSnippet_Type_AllPlaylists,
+    kGTLYouTubeChannelSectionSnippet_Type_ChannelsectionTypeUndefined,
+    kGTLYouTubeChannelSectionSnippet_Type_CompletedEvents,
+    kGTLYouTubeChannelSectionSnippet_Type_LikedPlaylists,
+    kGTLYouTubeChannelSectionSnippet_Type_Likes,
+    kGTLYouTubeChannelSectionSnippet_Type_LiveEvents,
+    kGTLYouTubeChannelSectionSnippet_Type_MultipleChannels,
+    kGTLYouTubeChannelSectionSnippet_Type_MultiplePlaylists,
+    kGTLYouTubeChannelSectionSnippet_Type_PopularUploads,
+    kGTLYouTubeChannelSectionSnippet_Type_PostedPlaylists,
+    kGTLYouTubeChannelSectionSnippet_Type_PostedVideos,
+    kGTLYouTubeChannelSectionSnippet_Type_RecentActivity,
+    kGTLYouTubeChannelSectionSnippet_Type_RecentPosts,
+    kGTLYouTubeChannelSectionSnippet_Type_RecentUploads,
+    kGTLYouTubeChannelSectionSnippet_Type_SinglePlaylist,
+    kGTLYouTubeChannelSectionSnippet_Type_Subscriptions,
+    kGTLYouTubeChannelSectionSnippet_Type_UpcomingEvents,
+    kGTLYouTubeChannelStatus_LongUploadsStatus_Allowed,
+    kGTLYouTubeChannelStatus_LongUploadsStatus_Disallowed,
+    kGTLYouTubeChannelStatus_LongUploadsStatus_Eligible,
+    kGTLYouTubeChannelStatus_LongUploadsStatus_LongUploadsUnspecified,
+    kGTLYouTubeChannelStatus_PrivacyStatus_Private,
+    kGTLYouTubeChannelStatus_PrivacyStatus_Public,
+    kGTLYouTubeChannelStatus_PrivacyStatus_Unlisted,
+    kGTLYouTubeCommentSnippet_ModerationStatus_HeldForReview,
+    kGTLYouTubeCommentSnippet_ModerationStatus_LikelySpam,
+    kGTLYouTubeCommentSnippet_ModerationStatus_Published,
+    kGTLYouTubeCommentSnippet_ModerationStatus_Rejected,
+    kGTLYouTubeCommentSnippet_ViewerRating_Dislike,
+    kGTLYouTubeCommentSnippet_ViewerRating_Like,
+    kGTLYouTubeCommentSnippet_ViewerRating_None,
+    kGTLYouTubeCommentSnippet_ViewerRating_Unspecified,
+    kGTLYouTubeContentRating_AcbRating_AcbC,
+    kGTLYouTubeContentRating_AcbRating_AcbE,
+    kGTLYouTubeContentRating_AcbRating_AcbG,
+    kGTLYouTubeContentRating_AcbRating_AcbM,
+    kGTLYouTubeContentRating_AcbRating_AcbMa15plus,
+    kGTLYouTubeContentRating_AcbRating_AcbP,
+    kGTLYouTubeContentRating_AcbRating_AcbPg,
+    kGTLYouTubeContentRating_AcbRating_AcbR18plus,
+    kGTLYouTubeContentRating_AcbRating_AcbUnrated,
+    kGTLYouTubeContentRating_AgcomRating_AgcomT,
+    kGTLYouTubeContentRating_AgcomRating_AgcomUnrated,
+    kGTLYouTubeContentRating_AgcomRating_AgcomVm14,
+    kGTLYouTubeContentRating_AgcomRating_AgcomVm18,
+    kGTLYouTubeContentRating_AnatelRating_AnatelA,
+    kGTLYouTubeContentRating_AnatelRating_AnatelF,
+    kGTLYouTubeContentRating_AnatelRating_AnatelI,
+    kGTLYouTubeContentRating_AnatelRating_AnatelI10,
+    kGTLYouTubeContentRating_AnatelRating_AnatelI12,
+    kGTLYouTubeContentRating_AnatelRating_AnatelI7,
+    kGTLYouTubeContentRating_AnatelRating_AnatelR,
+    kGTLYouTubeContentRating_AnatelRating_AnatelUnrated,
+    kGTLYouTubeContentRating_BbfcRating_Bbfc12,
+    kGTLYouTubeContentRating_BbfcRating_Bbfc12a,
+    kGTLYouTubeContentRating_BbfcRating_Bbfc15,
+    kGTLYouTubeContentRating_BbfcRating_Bbfc18,
+    kGTLYouTubeContentRating_BbfcRating_BbfcPg,
+    kGTLYouTubeContentRating_BbfcRating_BbfcR18,
+    kGTLYouTubeContentRating_BbfcRating_BbfcU,
+    kGTLYouTubeContentRating_BbfcRating_BbfcUnrated,
+    kGTLYouTubeContentRating_BfvcRating_Bfvc13,
+    kGTLYouTubeContentRating_BfvcRating_Bfvc15,
+    kGTLYouTubeContentRating_BfvcRating_Bfvc18,
+    kGTLYouTubeContentRating_BfvcRating_Bfvc20,
+    kGTLYouTubeContentRating_BfvcRating_BfvcB,
+    kGTLYouTubeContentRating_BfvcRating_BfvcE,
+    kGTLYouTubeContentRating_BfvcRating_BfvcG,
+    kGTLYouTubeContentRating_BfvcRating_BfvcUnrated,
+    kGTLYouTubeContentRating_BmukkRating_Bmukk10,
+    kGTLYouTubeContentRating_BmukkRating_Bmukk12,
+    kGTLYouTubeContentRating_BmukkRating_Bmukk14,
+    kGTLYouTubeContentRating_BmukkRating_Bmukk16,
+    kGTLYouTubeContentRating_BmukkRating_Bmukk6,
+    kGTLYouTubeContentRating_BmukkRating_Bmukk8,
+    kGTLYouTubeContentRating_BmukkRating_BmukkAa,
+    kGTLYouTubeContentRating_BmukkRating_BmukkUnrated,
+    kGTLYouTubeContentRating_CatvfrRating_Catvfr13plus,
+    kGTLYouTubeContentRating_CatvfrRating_Catvfr16plus,
+    kGTLYouTubeContentRating_CatvfrRating_Catvfr18plus,
+    kGTLYouTubeContentRating_CatvfrRating_Catvfr8plus,
+    kGTLYouTubeContentRating_CatvfrRating_CatvfrG,
+    kGTLYouTubeContentRating_CatvfrRating_CatvfrUnrated,
+    kGTLYouTubeContentRating_CatvRating_Catv14plus,
+    kGTLYouTubeContentRating_CatvRating_Catv18plus,
+    kGTLYouTubeContentRating_CatvRating_CatvC,
+    kGTLYouTubeContentRating_CatvRating_CatvC8,
+    kGTLYouTubeContentRating_CatvRating_CatvG,
+    kGTLYouTubeContentRating_CatvRating_CatvPg,
+    kGTLYouTubeContentRating_CatvRating_CatvUnrated,
+    kGTLYouTubeContentRating_CbfcRating_CbfcA,
+    kGTLYouTubeContentRating_CbfcRating_CbfcS,
+    kGTLYouTubeContentRating_CbfcRating_CbfcU,
+    kGTLYouTubeContentRating_CbfcRating_CbfcUA,
+    kGTLYouTubeContentRating_CbfcRating_CbfcUnrated,
+    kGTLYouTubeContentRating_CccRating_Ccc14,
+    kGTLYouTubeContentRating_CccRating_Ccc18,
+    kGTLYouTubeContentRating_CccRating_Ccc18s,
+    kGTLYouTubeContentRating_CccRating_Ccc18v,
+    kGTLYouTubeContentRating_CccRating_Ccc6,
+    kGTLYouTubeContentRating_CccRating_CccTe,
+    kGTLYouTubeContentRating_CccRating_CccUnrated,
+    kGTLYouTubeContentRating_CceRating_CceM12,
+    kGTLYouTubeContentRating_CceRating_CceM16,
+    kGTLYouTubeContentRating_CceRating_CceM18,
+    kGTLYouTubeContentRating_CceRating_CceM4,
+    kGTLYouTubeContentRating_CceRating_CceM6,
+    kGTLYouTubeContentRating_CceRating_CceUnrated,
+    kGTLYouTubeContentRating_ChfilmRating_Chfilm0,
+    kGTLYouTubeContentRating_ChfilmRating_Chfilm12,
+    kGTLYouTubeContentRating_ChfilmRating_Chfilm16,
+    kGTLYouTubeContentRating_ChfilmRating_Chfilm18,
+    kGTLYouTubeContentRating_ChfilmRating_Chfilm6,
+    kGTLYouTubeContentRating_ChfilmRating_ChfilmUnrated,
+    kGTLYouTubeContentRating_ChvrsRating_Chvrs14a,
+    kGTLYouTubeContentRating_ChvrsRating_Chvrs18a,
+    kGTLYouTubeContentRating_ChvrsRating_ChvrsE,
+    kGTLYouTubeContentRating_ChvrsRating_ChvrsG,
+    kGTLYouTubeContentRating_ChvrsRating_ChvrsPg,
+    kGTLYouTubeContentRating_ChvrsRating_ChvrsR,
+    kGTLYouTubeContentRating_ChvrsRating_ChvrsUnrated,
+    kGTLYouTubeContentRating_CicfRating_CicfE,
+    kGTLYouTubeContentRating_CicfRating_CicfKntEna,
+    kGTLYouTubeContentRating_CicfRating_CicfKtEa,
+    kGTLYouTubeContentRating_CicfRating_CicfUnrated,
+    kGTLYouTubeContentRating_CnaRating_Cna12,
+    kGTLYouTubeContentRating_CnaRating_Cna15,
+    kGTLYouTubeContentRating_CnaRating_Cna18,
+    kGTLYouTubeContentRating_CnaRating_Cna18plus,
+    kGTLYouTubeContentRating_CnaRating_CnaAp,
+    kGTLYouTubeContentRating_CnaRating_CnaUnrated,
+    kGTLYouTubeContentRating_CsaRating_Csa10,
+    kGTLYouTubeContentRating_CsaRating_Csa12,
+    kGTLYouTubeContentRating_CsaRating_Csa16,
+    kGTLYouTubeContentRating_CsaRating_Csa18,
+    kGTLYouTubeContentRating_CsaRating_CsaInterdiction,
+    kGTLYouTubeContentRating_CsaRating_CsaUnrated,
+    kGTLYouTubeContentRating_CscfRating_Cscf12,
+    kGTLYouTubeContentRating_CscfRating_Cscf16,
+    kGTLYouTubeContentRating_CscfRating_Cscf18,
+    kGTLYouTubeContentRating_CscfRating_Cscf6,
+    kGTLYouTubeContentRating_CscfRating_Cscf9,
+    kGTLYouTubeContentRating_CscfRating_CscfA,
+    kGTLYouTubeContentRating_CscfRating_CscfAl,
+    kGTLYouTubeContentRating_CscfRating_CscfUnrated,
+    kGTLYouTubeContentRating_CzfilmRating_Czfilm12,
+    kGTLYouTubeContentRating_CzfilmRating_Czfilm14,
+    kGTLYouTubeContentRating_CzfilmRating_Czfilm18,
+    kGTLYouTubeContentRating_CzfilmRating_CzfilmU,
+    kGTLYouTubeContentRating_CzfilmRating_CzfilmUnrated,
+    kGTLYouTubeContentRating_DjctqRating_Djctq10,
+    kGTLYouTubeContentRating_DjctqRating_Djctq12,
+    kGTLYouTubeContentRating_DjctqRating_Djctq14,
+    kGTLYouTubeContentRating_DjctqRating_Djctq16,
+    kGTLYouTubeContentRating_DjctqRating_Djctq18,
+    kGTLYouTubeContentRating_DjctqRating_DjctqL,
+    kGTLYouTubeContentRating_DjctqRating_DjctqUnrated,
+    kGTLYouTubeContentRating_DjctqRatingReasons_DjctqCriminalActs,
+    kGTLYouTubeContentRating_DjctqRatingReasons_DjctqDrugs,
+    kGTLYouTubeContentRating_DjctqRatingReasons_DjctqExplicitSex,
+    kGTLYouTubeContentRating_DjctqRatingReasons_DjctqExtremeViolence,
+    kGTLYouTubeContentRating_DjctqRatingReasons_DjctqIllegalDrugs,
+    kGTLYouTubeContentRating_DjctqRatingReasons_DjctqImpactingContent,
+    kGTLYouTubeContentRating_DjctqRatingReasons_DjctqInappropriateLanguage,
+    kGTLYouTubeContentRating_DjctqRatingReasons_DjctqLegalDrugs,
+    kGTLYouTubeContentRating_DjctqRatingReasons_DjctqNudity,
+    kGTLYouTubeContentRating_DjctqRatingReasons_DjctqSex,
+    kGTLYouTubeContentRating_DjctqRatingReasons_DjctqSexualContent,
+    kGTLYouTubeContentRating_DjctqRatingReasons_DjctqViolence,
+    kGTLYouTubeContentRating_EefilmRating_EefilmK12,
+    kGTLYouTubeContentRating_EefilmRating_EefilmK14,
+    kGTLYouTubeContentRating_EefilmRating_EefilmK16,
+    kGTLYouTubeContentRating_EefilmRating_EefilmK6,
+    kGTLYouTubeContentRating_EefilmRating_EefilmL,
+    kGTLYouTubeContentRating_EefilmRating_EefilmMs12,
+    kGTLYouTubeContentRating_EefilmRating_EefilmMs6,
+    kGTLYouTubeContentRating_EefilmRating_EefilmPere,
+    kGTLYouTubeContentRating_EefilmRating_EefilmUnrated,
+    kGTLYouTubeContentRating_EgfilmRating_Egfilm18,
+    kGTLYouTubeContentRating_EgfilmRating_EgfilmBn,
+    kGTLYouTubeContentRating_EgfilmRating_EgfilmGn,
+    kGTLYouTubeContentRating_EgfilmRating_EgfilmUnrated,
+    kGTLYouTubeContentRating_EirinRating_EirinG,
+    kGTLYouTubeContentRating_EirinRating_EirinPg12,
+    kGTLYouTubeContentRating_EirinRating_EirinR15plus,
+    kGTLYouTubeContentRating_EirinRating_EirinR18plus,
+    kGTLYouTubeContentRating_EirinRating_EirinUnrated,
+    kGTLYouTubeContentRating_FcbmRating_Fcbm18,
+    kGTLYouTubeContentRating_FcbmRating_Fcbm18pa,
+    kGTLYouTubeContentRating_FcbmRating_Fcbm18pl,
+    kGTLYouTubeContentRating_FcbmRating_Fcbm18sg,
+    kGTLYouTubeContentRating_FcbmRating_Fcbm18sx,
+    kGTLYouTubeContentRating_FcbmRating_FcbmP13,
+    kGTLYouTubeContentRating_FcbmRating_FcbmPg13,
+    kGTLYouTubeContentRating_FcbmRating_FcbmU,
+    kGTLYouTubeContentRating_FcbmRating_FcbmUnrated,
+    kGTLYouTubeContentRating_FcoRating_FcoI,
+    kGTLYouTubeContentRating_FcoRating_FcoIia,
+    kGTLYouTubeContentRating_FcoRating_FcoIib,
+    kGTLYouTubeContentRating_FcoRating_FcoIii,
+    kGTLYouTubeContentRating_FcoRating_FcoUnrated,
+    kGTLYouTubeContentRating_FmocRating_Fmoc10,
+    kGTLYouTubeContentRating_FmocRating_Fmoc12,
+    kGTLYouTubeContentRating_FmocRating_Fmoc16,
+    kGTLYouTubeContentRating_FmocRating_Fmoc18,
+    kGTLYouTubeContentRating_FmocRating_FmocE,
+    kGTLYouTubeContentRating_FmocRating_FmocU,
+    kGTLYouTubeContentRating_FmocRating_FmocUnrated,
+    kGTLYouTubeContentRating_FpbRating_Fpb1012Pg,
+    kGTLYouTubeContentRating_FpbRating_Fpb13,
+    kGTLYouTubeContentRating_FpbRating_Fpb16,
+    kGTLYouTubeContentRating_FpbRating_Fpb18,
+    kGTLYouTubeContentRating_FpbRating_Fpb79Pg,
+    kGTLYouTubeContentRating_FpbRating_FpbA,
+    kGTLYouTubeContentRating_FpbRating_FpbPg,
+    kGTLYouTubeContentRating_FpbRating_FpbUnrated,
+    kGTLYouTubeContentRating_FpbRating_FpbX18,
+    kGTLYouTubeContentRating_FpbRating_FpbXx,
+    kGTLYouTubeContentRating_FskRating_Fsk0,
+    kGTLYouTubeContentRating_FskRating_Fsk12,
+    kGTLYouTubeContentRating_FskRating_Fsk16,
+    kGTLYouTubeContentRating_FskRating_Fsk18,
+    kGTLYouTubeContentRating_FskRating_Fsk6,
+    kGTLYouTubeContentRating_FskRating_FskUnrated,
+    kGTLYouTubeContentRating_GrfilmRating_GrfilmE,
+    kGTLYouTubeContentRating_GrfilmRating_GrfilmK,
+    kGTLYouTubeContentRating_GrfilmRating_GrfilmK13,
+    kGTLYouTubeContentRating_GrfilmRating_GrfilmK17,
+    kGTLYouTubeContentRating_GrfilmRating_GrfilmUnrated,
+    kGTLYouTubeContentRating_IcaaRating_Icaa12,
+    kGTLYouTubeContentRating_IcaaRating_Icaa13,
+    kGTLYouTubeContentRating_IcaaRating_Icaa16,
+    kGTLYouTubeContentRating_IcaaRating_Icaa18,
+    kGTLYouTubeContentRating_IcaaRating_Icaa7,
+    kGTLYouTubeContentRating_IcaaRating_IcaaApta,
+    kGTLYouTubeContentRating_IcaaRating_IcaaUnrated,
+    kGTLYouTubeContentRating_IcaaRating_IcaaX,
+    kGTLYouTubeContentRating_IfcoRating_Ifco12,
+    kGTLYouTubeContentRating_IfcoRating_Ifco12a,
+    kGTLYouTubeContentRating_IfcoRating_Ifco15,
+    kGTLYouTubeContentRating_IfcoRating_Ifco15a,
+    kGTLYouTubeContentRating_IfcoRating_Ifco16,
+    kGTLYouTubeContentRating_IfcoRating_Ifco18,
+    kGTLYouTubeContentRating_IfcoRating_IfcoG,
+    kGTLYouTubeContentRating_IfcoRating_IfcoPg,
+    kGTLYouTubeContentRating_IfcoRating_IfcoUnrated,
+    kGTLYouTubeContentRating_IlfilmRating_Ilfilm12,
+    kGTLYouTubeContentRating_IlfilmRating_Ilfilm16,
+    kGTLYouTubeContentRating_IlfilmRating_Ilfilm18,
+    kGTLYouTubeContentRating_IlfilmRating_IlfilmAa,
+    kGTLYouTubeContentRating_IlfilmRating_IlfilmUnrated,
+    kGTLYouTubeContentRating_IncaaRating_IncaaAtp,
+    kGTLYouTubeContentRating_IncaaRating_IncaaC,
+    kGTLYouTubeContentRating_IncaaRating_IncaaSam13,
+    kGTLYouTubeContentRating_IncaaRating_IncaaSam16,
+    kGTLYouTubeContentRating_IncaaRating_IncaaSam18,
+    kGTLYouTubeContentRating_IncaaRating_IncaaUnrated,
+    kGTLYouTubeContentRating_KfcbRating_Kfcb16plus,
+    kGTLYouTubeContentRating_KfcbRating_KfcbG,
+    kGTLYouTubeContentRating_KfcbRating_KfcbPg,
+    kGTLYouTubeContentRating_KfcbRating_KfcbR,
+    kGTLYouTubeContentRating_KfcbRating_KfcbUnrated,
+    kGTLYouTubeContentRating_KijkwijzerRating_Kijkwijzer12,
+    kGTLYouTubeContentRating_KijkwijzerRating_Kijkwijzer16,
+    kGTLYouTubeContentRating_KijkwijzerRating_Kijkwijzer18,
+    kGTLYouTubeContentRating_KijkwijzerRating_Kijkwijzer6,
+    kGTLYouTubeContentRating_KijkwijzerRating_Kijkwijzer9,
+    kGTLYouTubeContentRating_KijkwijzerRating_KijkwijzerAl,
+    kGTLYouTubeContentRating_KijkwijzerRating_KijkwijzerUnrated,
+    kGTLYouTubeContentRating_KmrbRating_Kmrb12plus,
+    kGTLYouTubeContentRating_KmrbRating_Kmrb15plus,
+    kGTLYouTubeContentRating_KmrbRating_KmrbAll,
+    kGTLYouTubeContentRating_KmrbRating_KmrbR,
+    kGTLYouTubeContentRating_KmrbRating_KmrbTeenr,
+    kGTLYouTubeContentRating_KmrbRating_KmrbUnrated,
+    kGTLYouTubeContentRating_LsfRating_Lsf13,
+    kGTLYouTubeContentRating_LsfRating_Lsf17,
+    kGTLYouTubeContentRating_LsfRating_Lsf21,
+    kGTLYouTubeContentRating_LsfRating_LsfA,
+    kGTLYouTubeContentRating_LsfRating_LsfBo,
+    kGTLYouTubeContentRating_LsfRating_LsfD,
+    kGTLYouTubeContentRating_LsfRating_LsfR,
+    kGTLYouTubeContentRating_LsfRating_LsfSu,
+    kGTLYouTubeContentRating_LsfRating_LsfUnrated,
+    kGTLYouTubeContentRating_MccaaRating_Mccaa12,
+    kGTLYouTubeContentRating_MccaaRating_Mccaa12a,
+    kGTLYouTubeContentRating_MccaaRating_Mccaa14,
+    kGTLYouTubeContentRating_MccaaRating_Mccaa15,
+    kGTLYouTubeContentRating_MccaaRating_Mccaa16,
+    kGTLYouTubeContentRating_MccaaRating_Mccaa18,
+    kGTLYouTubeContentRating_MccaaRating_MccaaPg,
+    kGTLYouTubeContentRating_MccaaRating_MccaaU,
+    kGTLYouTubeContentRating_MccaaRating_MccaaUnrated,
+    kGTLYouTubeContentRating_MccypRating_Mccyp11,
+    kGTLYouTubeContentRating_MccypRating_Mccyp15,
+    kGTLYouTubeContentRating_MccypRating_Mccyp7,
+    kGTLYouTubeContentRating_MccypRating_MccypA,
+    kGTLYouTubeContentRating_MccypRating_MccypUnrated,
+    kGTLYouTubeContentRating_MdaRating_MdaG,
+    kGTLYouTubeContentRating_MdaRating_MdaM18,
+    kGTLYouTubeContentRating_MdaRating_MdaNc16,
+    kGTLYouTubeContentRating_MdaRating_MdaPg,
+    kGTLYouTubeContentRating_MdaRating_MdaPg13,
+    kGTLYouTubeContentRating_MdaRating_MdaR21,
+    kGTLYouTubeContentRating_MdaRating_MdaUnrated,
+    kGTLYouTubeContentRating_MedietilsynetRating_Medietilsynet11,
+    kGTLYouTubeContentRating_MedietilsynetRating_Medietilsynet15,
+    kGTLYouTubeContentRating_MedietilsynetRating_Medietilsynet18,
+    kGTLYouTubeContentRating_MedietilsynetRating_Medietilsynet7,
+    kGTLYouTubeContentRating_MedietilsynetRating_MedietilsynetA,
+    kGTLYouTubeContentRating_MedietilsynetRating_MedietilsynetUnrated,
+    kGTLYouTubeContentRating_MekuRating_Meku12,
+    kGTLYouTubeContentRating_MekuRating_Meku16,
+    kGTLYouTubeContentRating_MekuRating_Meku18,
+    kGTLYouTubeContentRating_MekuRating_Meku7,
+    kGTLYouTubeContentRating_MekuRating_MekuS,
+    kGTLYouTubeContentRating_MekuRating_MekuUnrated,
+    kGTLYouTubeContentRating_MibacRating_MibacT,
+    kGTLYouTubeContentRating_MibacRating_MibacUnrated,
+    kGTLYouTubeContentRating_MibacRating_MibacVap,
+    kGTLYouTubeContentRating_MibacRating_MibacVm12,
+    kGTLYouTubeContentRating_MibacRating_MibacVm14,
+    kGTLYouTubeContentRating_MibacRating_MibacVm18,
+    kGTLYouTubeContentRating_MocRating_Moc12,
+    kGTLYouTubeContentRating_MocRating_Moc15,
+    kGTLYouTubeContentRating_MocRating_Moc18,
+    kGTLYouTubeContentRating_MocRating_Moc7,
+    kGTLYouTubeContentRating_MocRating_MocBanned,
+    kGTLYouTubeContentRating_MocRating_MocE,
+    kGTLYouTubeContentRating_MocRating_MocT,
+    kGTLYouTubeContentRating_MocRating_MocUnrated,
+    kGTLYouTubeContentRating_MocRating_MocX,
+    kGTLYouTubeContentRating_MoctwRating_MoctwG,
+    kGTLYouTubeContentRating_MoctwRating_MoctwP,
+    kGTLYouTubeContentRating_MoctwRating_MoctwPg,
+    kGTLYouTubeContentRating_MoctwRating_MoctwR,
+    kGTLYouTubeContentRating_MoctwRating_MoctwUnrated,
+    kGTLYouTubeContentRating_MpaaRating_MpaaG,
+    kGTLYouTubeContentRating_MpaaRating_MpaaNc17,
+    kGTLYouTubeContentRating_MpaaRating_MpaaPg,
+    kGTLYouTubeContentRating_MpaaRating_MpaaPg13,
+    kGTLYouTubeContentRating_MpaaRating_MpaaR,
+    kGTLYouTubeContentRating_MpaaRating_MpaaUnrated,
+    kGTLYouTubeContentRating_MtrcbRating_MtrcbG,
+    kGTLYouTubeContentRating_MtrcbRating_MtrcbPg,
+    kGTLYouTubeContentRating_MtrcbRating_MtrcbR13,
+    kGTLYouTubeContentRating_MtrcbRating_MtrcbR16,
+    kGTLYouTubeContentRating_MtrcbRating_MtrcbR18,
+    kGTLYouTubeContentRating_MtrcbRating_MtrcbUnrated,
+    kGTLYouTubeContentRating_MtrcbRating_MtrcbX,
+    kGTLYouTubeContentRating_NbcplRating_Nbcpl18plus,
+    kGTLYouTubeContentRating_NbcplRating_NbcplI,
+    kGTLYouTubeContentRating_NbcplRating_NbcplIi,
+    kGTLYouTubeContentRating_NbcplRating_NbcplIii,
+    kGTLYouTubeContentRating_NbcplRating_NbcplIv,
+    kGTLYouTubeContentRating_NbcplRating_NbcplUnrated,
+    kGTLYouTubeContentRating_NbcRating_Nbc12plus,
+    kGTLYouTubeContentRating_NbcRating_Nbc15plus,
+    kGTLYouTubeContentRating_NbcRating_Nbc18plus,
+    kGTLYouTubeContentRating_NbcRating_Nbc18plusr,
+    kGTLYouTubeContentRating_NbcRating_NbcG,
+    kGTLYouTubeContentRating_NbcRating_NbcPg,
+    kGTLYouTubeContentRating_NbcRating_NbcPu,
+    kGTLYouTubeContentRating_NbcRating_NbcUnrated,
+    kGTLYouTubeContentRating_NfrcRating_NfrcA,
+    kGTLYouTubeContentRating_NfrcRating_NfrcB,
+    kGTLYouTubeContentRating_NfrcRating_NfrcC,
+    kGTLYouTubeContentRating_NfrcRating_NfrcD,
+    kGTLYouTubeContentRating_NfrcRating_NfrcUnrated,
+    kGTLYouTubeContentRating_NfrcRating_NfrcX,
+    kGTLYouTubeContentRating_NfvcbRating_Nfvcb12,
+    kGTLYouTubeContentRating_NfvcbRating_Nfvcb12a,
+    kGTLYouTubeContentRating_NfvcbRating_Nfvcb15,
+    kGTLYouTubeContentRating_NfvcbRating_Nfvcb18,
+    kGTLYouTubeContentRating_NfvcbRating_NfvcbG,
+    kGTLYouTubeContentRating_NfvcbRating_NfvcbPg,
+    kGTLYouTubeContentRating_NfvcbRating_NfvcbRe,
+    kGTLYouTubeContentRating_NfvcbRating_NfvcbUnrated,
+    kGTLYouTubeContentRating_NkclvRating_Nkclv12plus,
+    kGTLYouTubeContentRating_NkclvRating_Nkclv18plus,
+    kGTLYouTubeContentRating_NkclvRating_Nkclv7plus,
+    kGTLYouTubeContentRating_NkclvRating_NkclvU,
+    kGTLYouTubeContentRating_NkclvRating_NkclvUnrated,
+    kGTLYouTubeContentRating_OflcRating_OflcG,
+    kGTLYouTubeContentRating_OflcRating_OflcM,
+    kGTLYouTubeContentRating_OflcRating_OflcPg,
+    kGTLYouTubeContentRating_OflcRating_OflcR13,
+    kGTLYouTubeContentRating_OflcRating_OflcR15,
+    kGTLYouTubeContentRating_OflcRating_OflcR16,
+    kGTLYouTubeContentRating_OflcRating_OflcR18,
+    kGTLYouTubeContentRating_OflcRating_OflcRp13,
+    kGTLYouTubeContentRating_OflcRating_OflcRp16,
+    kGTLYouTubeContentRating_OflcRating_OflcUnrated,
+    kGTLYouTubeContentRating_PefilmRating_Pefilm14,
+    kGTLYouTubeContentRating_PefilmRating_Pefilm18,
+    kGTLYouTubeContentRating_PefilmRating_PefilmPg,
+    kGTLYouTubeContentRating_PefilmRating_PefilmPt,
+    kGTLYouTubeContentRating_PefilmRating_PefilmUnrated,
+    kGTLYouTubeContentRating_RcnofRating_RcnofI,
+    kGTLYouTubeContentRating_RcnofRating_RcnofIi,
+    kGTLYouTubeContentRating_RcnofRating_RcnofIii,
+    kGTLYouTubeContentRating_RcnofRating_RcnofIv,
+    kGTLYouTubeContentRating_RcnofRating_RcnofUnrated,
+    kGTLYouTubeContentRating_RcnofRating_RcnofV,
+    kGTLYouTubeContentRating_RcnofRating_RcnofVi,
+    kGTLYouTubeContentRating_ResorteviolenciaRating_ResorteviolenciaA,
+    kGTLYouTubeContentRating_ResorteviolenciaRating_ResorteviolenciaB,
+    kGTLYouTubeContentRating_ResorteviolenciaRating_ResorteviolenciaC,
+    kGTLYouTubeContentRating_ResorteviolenciaRating_ResorteviolenciaD,
+    kGTLYouTubeContentRating_ResorteviolenciaRating_ResorteviolenciaE,
+    kGTLYouTubeContentRating_ResorteviolenciaRating_ResorteviolenciaUnrated,
+    kGTLYouTubeContentRating_RtcRating_RtcA,
+    kGTLYouTubeContentRating_RtcRating_RtcAa,
+    kGTLYouTubeContentRating_RtcRating_RtcB,
+    kGTLYouTubeContentRating_RtcRating_RtcB15,
+    kGTLYouTubeContentRating_RtcRating_RtcC,
+    kGTLYouTubeContentRating_RtcRating_RtcD,
+    kGTLYouTubeContentRating_RtcRating_RtcUnrated,
+    kGTLYouTubeContentRating_RteRating_RteCh,
+    kGTLYouTubeContentRating_RteRating_RteGa,
+    kGTLYouTubeContentRating_RteRating_RteMa,
+    kGTLYouTubeContentRating_RteRating_RtePs,
+    kGTLYouTubeContentRating_RteRating_RteUnrated,
+    kGTLYouTubeContentRating_RussiaRating_Russia0,
+    kGTLYouTubeContentRating_RussiaRating_Russia12,
+    kGTLYouTubeContentRating_RussiaRating_Russia16,
+    kGTLYouTubeContentRating_RussiaRating_Russia18,
+    kGTLYouTubeContentRating_RussiaRating_Russia6,
+    kGTLYouTubeContentRating_RussiaRating_RussiaUnrated,
+    kGTLYouTubeContentRating_SkfilmRating_SkfilmG,
+    kGTLYouTubeContentRating_SkfilmRating_SkfilmP2,
+    kGTLYouTubeContentRating_SkfilmRating_SkfilmP5,
+    kGTLYouTubeContentRating_SkfilmRating_SkfilmP8,
+    kGTLYouTubeContentRating_SkfilmRating_SkfilmUnrated,
+    kGTLYouTubeContentRating_SmaisRating_Smais12,
+    kGTLYouTubeContentRating_SmaisRating_Smais14,
+    kGTLYouTubeContentRating_SmaisRating_Smais16,
+    kGTLYouTubeContentRating_SmaisRating_Smais18,
+    kGTLYouTubeContentRating_SmaisRating_Smais7,
+    kGTLYouTubeContentRating_SmaisRating_SmaisL,
+    kGTLYouTubeContentRating_SmaisRating_SmaisUnrated,
+    kGTLYouTubeContentRating_SmsaRating_Smsa11,
+    kGTLYouTubeContentRating_SmsaRating_Smsa15,
+    kGTLYouTubeContentRating_SmsaRating_Smsa7,
+    kGTLYouTubeContentRating_SmsaRating_SmsaA,
+    kGTLYouTubeContentRating_SmsaRating_SmsaUnrated,
+    kGTLYouTubeContentRating_TvpgRating_Pg14,
+    kGTLYouTubeContentRating_TvpgRating_TvpgG,
+    kGTLYouTubeContentRating_TvpgRating_TvpgMa,
+    kGTLYouTubeContentRating_TvpgRating_TvpgPg,
+    kGTLYouTubeContentRating_TvpgRating_TvpgUnrated,
+    kGTLYouTubeContentRating_TvpgRating_TvpgY,
+    kGTLYouTubeContentRating_TvpgRating_TvpgY7,
+    kGTLYouTubeContentRating_TvpgRating_TvpgY7Fv,
+    kGTLYouTubeContentRating_YtRating_YtAgeRestricted,
+    kGTLYouTubeInvideoPosition_CornerPosition_BottomLeft,
+    kGTLYouTubeInvideoPosition_CornerPosition_BottomRight,
+    kGTLYouTubeInvideoPosition_CornerPosition_TopLeft,
+    kGTLYouTubeInvideoPosition_CornerPosition_TopRight,
+    kGTLYouTubeInvideoPosition_Type_Corner,
+    kGTLYouTubeInvideoTiming_Type_OffsetFromEnd,
+    kGTLYouTubeInvideoTiming_Type_OffsetFromStart,
+    kGTLYouTubeLiveBroadcastStatus_LifeCycleStatus_Abandoned,
+    kGTLYouTubeLiveBroadcastStatus_LifeCycleStatus_Complete,
+    kGTLYouTubeLiveBroadcastStatus_LifeCycleStatus_CompleteStarting,
+    kGTLYouTubeLiveBroadcastStatus_LifeCycleStatus_Created,
+    kGTLYouTubeLiveBroadcastStatus_LifeCycleStatus_Live,
+    kGTLYouTubeLiveBroadcastStatus_LifeCycleStatus_LiveStarting,
+    kGTLYouTubeLiveBroadcastStatus_LifeCycleStatus_Ready,
+    kGTLYouTubeLiveBroadcastStatus_LifeCycleStatus_Reclaimed,
+    kGTLYouTubeLiveBroadcastStatus_LifeCycleStatus_Revoked,
+    kGTLYouTubeLiveBroadcastStatus_LifeCycleStatus_Testing,
+    kGTLYouTubeLiveBroadcastStatus_LifeCycleStatus_TestStarting,
+    kGTLYouTubeLiveBroadcastStatus_LiveBroadcastPriority_High,
+    kGTLYouTubeLiveBroadcastStatus_LiveBroadcastPriority_Low,
+    kGTLYouTubeLiveBroadcastStatus_LiveBroadcastPriority_Normal,
+    kGTLYouTubeLiveBroadcastStatus_PrivacyStatus_Private,
+    kGTLYouTubeLiveBroadcastStatus_PrivacyStatus_Public,
+    kGTLYouTubeLiveBroadcastStatus_PrivacyStatus_Unlisted,
+    kGTLYouTubeLiveBroadcastStatus_RecordingStatus_NotRecording,
+    kGTLYouTubeLiveBroadcastStatus_RecordingStatus_Recorded,
+    kGTLYouTubeLiveBroadcastStatus_RecordingStatus_Recording,
+    kGTLYouTubeLiveBroadcastTopic_Type_VideoGame,
+    kGTLYouTubeLiveStreamConfigurationIssue_Severity_Error,
+    kGTLYouTubeLiveStreamConfigurationIssue_Severity_Info,
+    kGTLYouTubeLiveStreamConfigurationIssue_Severity_Warning,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_AudioBitrateHigh,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_AudioBitrateLow,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_AudioBitrateMismatch,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_AudioCodec,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_AudioCodecMismatch,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_AudioSampleRate,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_AudioSampleRateMismatch,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_AudioStereoMismatch,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_AudioTooManyChannels,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_BadContainer,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_BitrateHigh,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_BitrateLow,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_FrameRateHigh,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_FramerateMismatch,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_GopMismatch,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_GopSizeLong,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_GopSizeOver,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_GopSizeShort,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_InterlacedVideo,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_MultipleAudioStreams,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_MultipleVideoStreams,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_NoAudioStream,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_NoVideoStream,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_OpenGop,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_ResolutionMismatch,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_VideoBitrateMismatch,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_VideoCodec,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_VideoCodecMismatch,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_VideoIngestionStarved,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_VideoInterlaceMismatch,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_VideoProfileMismatch,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_VideoResolutionSuboptimal,
+    kGTLYouTubeLiveStreamConfigurationIssue_Type_VideoResolutionUnsupported,
+    kGTLYouTubeLiveStreamHealthStatus_Status_Bad,
+    kGTLYouTubeLiveStreamHealthStatus_Status_Good,
+    kGTLYouTubeLiveStreamHealthStatus_Status_NoData,
+    kGTLYouTubeLiveStreamHealthStatus_Status_Ok,
+    kGTLYouTubeLiveStreamHealthStatus_Status_Revoked,
+    kGTLYouTubeLiveStreamStatus_StreamStatus_Active,
+    kGTLYouTubeLiveStreamStatus_StreamStatus_Created,
+    kGTLYouTubeLiveStreamStatus_StreamStatus_Error,
+    kGTLYouTubeLiveStreamStatus_StreamStatus_Inactive,
+    kGTLYouTubeLiveStreamStatus_StreamStatus_Ready,
+    kGTLYouTubePlaylistItemStatus_PrivacyStatus_Private,
+    kGTLYouTubePlaylistItemStatus_PrivacyStatus_Public,
+    kGTLYouTubePlaylistItemStatus_PrivacyStatus_Unlisted,
+    kGTLYouTubePlaylistStatus_PrivacyStatus_Private,
+    kGTLYouTubePlaylistStatus_PrivacyStatus_Public,
+    kGTLYouTubePlaylistStatus_PrivacyStatus_Unlisted,
+    kGTLYouTubePromotedItemId_Type_RecentUpload,
+    kGTLYouTubePromotedItemId_Type_Video,
+    kGTLYouTubePromotedItemId_Type_Website,
+    kGTLYouTubeSearchResultSnippet_LiveBroadcastContent_Live,
+    kGTLYouTubeSearchResultSnippet_LiveBroadcastContent_None,
+    kGTLYouTubeSearchResultSnippet_LiveBroadcastContent_Upcoming,
+    kGTLYouTubeSubscriptionContentDetails_ActivityType_All,
+    kGTLYouTubeSubscriptionContentDetails_ActivityType_Uploads,
+    kGTLYouTubeVideoAgeGating_VideoGameRating_Anyone,
+    kGTLYouTubeVideoAgeGating_VideoGameRating_M15Plus,
+    kGTLYouTubeVideoAgeGating_VideoGameRating_M16Plus,
+    kGTLYouTubeVideoAgeGating_VideoGameRating_M17Plus,
+    kGTLYouTubeVideoContentDetails_Caption_False,
+    kGTLYouTubeVideoContentDetails_Caption_True,
+    kGTLYouTubeVideoContentDetails_Definition_Hd,
+    kGTLYouTubeVideoContentDetails_Definition_Sd,
+    kGTLYouTubeVideoConversionPing_Context_Comment,
+    kGTLYouTubeVideoConversionPing_Context_Dislike,
+    kGTLYouTubeVideoConversionPing_Context_Like,
+    kGTLYouTubeVideoConversionPing_Context_Share,
+    kGTLYouTubeVideoFileDetails_FileType_Archive,
+    kGTLYouTubeVideoFileDetails_FileType_Audio,
+    kGTLYouTubeVideoFileDetails_FileType_Document,
+    kGTLYouTubeVideoFileDetails_FileType_Image,
+    kGTLYouTubeVideoFileDetails_FileType_Other,
+    kGTLYouTubeVideoFileDetails_FileType_Project,
+    kGTLYouTubeVideoFileDetails_FileType_Video,
+    kGTLYouTubeVideoFileDetailsVideoStream_Rotation_Clockwise,
+    kGTLYouTubeVideoFileDetailsVideoStream_Rotation_CounterClockwise,
+    kGTLYouTubeVideoFileDetailsVideoStream_Rotation_None,
+    kGTLYouTubeVideoFileDetailsVideoStream_Rotation_Other,
+    kGTLYouTubeVideoFileDetailsVideoStream_Rotation_UpsideDown,
+    kGTLYouTubeVideoProcessingDetails_ProcessingFailureReason_Other,
+    kGTLYouTubeVideoProcessingDetails_ProcessingFailureReason_StreamingFailed,
+    kGTLYouTubeVideoProcessingDetails_ProcessingFailureReason_TranscodeFailed,
+    kGTLYouTubeVideoProcessingDetails_ProcessingFailureReason_UploadFailed,
+    kGTLYouTubeVideoProcessingDetails_ProcessingStatus_Failed,
+    kGTLYouTubeVideoProcessingDetails_ProcessingStatus_Processing,
+    kGTLYouTubeVideoProcessingDetails_ProcessingStatus_Succeeded,
+    kGTLYouTubeVideoProcessingDetails_ProcessingStatus_Terminated,
+    kGTLYouTubeVideoRating_Rating_Dislike,
+    kGTLYouTubeVideoRating_Rating_Like,
+    kGTLYouTubeVideoRating_Rating_None,
+    kGTLYouTubeVideoRating_Rating_Unspecified,
+    kGTLYouTubeVideoSnippet_LiveBroadcastContent_Live,
+    kGTLYouTubeVideoSnippet_LiveBroadcastContent_None,
+    kGTLYouTubeVideoSnippet_LiveBroadcastContent_Upcoming,
+    kGTLYouTubeVideoStatus_FailureReason_Codec,
+    kGTLYouTubeVideoStatus_FailureReason_Conversion,
+    kGTLYouTubeVideoStatus_FailureReason_EmptyFile,
+    kGTLYouTubeVideoStatus_FailureReason_InvalidFile,
+    kGTLYouTubeVideoStatus_FailureReason_TooSmall,
+    kGTLYouTubeVideoStatus_FailureReason_UploadAborted,
+    kGTLYouTubeVideoStatus_License_CreativeCommon,
+    kGTLYouTubeVideoStatus_License_Youtube,
+    kGTLYouTubeVideoStatus_PrivacyStatus_Private,
+    kGTLYouTubeVideoStatus_PrivacyStatus_Public,
+    kGTLYouTubeVideoStatus_PrivacyStatus_Unlisted,
+    kGTLYouTubeVideoStatus_RejectionReason_Claim,
+    kGTLYouTubeVideoStatus_RejectionReason_Copyright,
+    kGTLYouTubeVideoStatus_RejectionReason_Duplicate,
+    kGTLYouTubeVideoStatus_RejectionReason_Inappropriate,
+    kGTLYouTubeVideoStatus_RejectionReason_Length,
+    kGTLYouTubeVideoStatus_RejectionReason_TermsOfUse,
+    kGTLYouTubeVideoStatus_RejectionReason_Trademark,
+    kGTLYouTubeVideoStatus_RejectionReason_UploaderAccountClosed,
+    kGTLYouTubeVideoStatus_RejectionReason_UploaderAccountSuspended,
+    kGTLYouTubeVideoStatus_UploadStatus_Deleted,
+    kGTLYouTubeVideoStatus_UploadStatus_Failed,
+    kGTLYouTubeVideoStatus_UploadStatus_Processed,
+    kGTLYouTubeVideoStatus_UploadStatus_Rejected,
+    kGTLYouTubeVideoStatus_UploadStatus_Uploaded,
+    kGTLYouTubeVideoSuggestions_EditorSuggestions_AudioQuietAudioSwap,
+    kGTLYouTubeVideoSuggestions_EditorSuggestions_VideoAutoLevels,
+    kGTLYouTubeVideoSuggestions_EditorSuggestions_VideoCrop,
+    kGTLYouTubeVideoSuggestions_EditorSuggestions_VideoStabilize,
+    kGTLYouTubeVideoSuggestions_ProcessingErrors_ArchiveFile,
+    kGTLYouTubeVideoSuggestions_ProcessingErrors_AudioFile,
+    kGTLYouTubeVideoSuggestions_ProcessingErrors_DocFile,
+    kGTLYouTubeVideoSuggestions_ProcessingErrors_ImageFile,
+    kGTLYouTubeVideoSuggestions_ProcessingErrors_NotAVideoFile,
+    kGTLYouTubeVideoSuggestions_ProcessingErrors_ProjectFile,
+    kGTLYouTubeVideoSuggestions_ProcessingHints_NonStreamableMov,
+    kGTLYouTubeVideoSuggestions_ProcessingHints_SendBestQualityVideo,
+    kGTLYouTubeVideoSuggestions_ProcessingWarnings_HasEditlist,
+    kGTLYouTubeVideoSuggestions_ProcessingWarnings_InconsistentResolution,
+    kGTLYouTubeVideoSuggestions_ProcessingWarnings_ProblematicAudioCodec,
+    kGTLYouTubeVideoSuggestions_ProcessingWarnings_ProblematicVideoCodec,
+    kGTLYouTubeVideoSuggestions_ProcessingWarnings_UnknownAudioCodec,
+    kGTLYouTubeVideoSuggestions_ProcessingWarnings_UnknownContainer,
+    kGTLYouTubeVideoSuggestions_ProcessingWarnings_UnknownVideoCodec
+  ];
+  return strings;
+}
+
 - (instancetype)init {
   self = [super init];
   if (self) {
@@ -75,5 +75,165 @@
   data = GTLDecodeWebSafeBase64(str);
   expectedData = [testStr dataUsingEncoding:NSUTF8StringEncoding];
   XCTAssertEqualObjects(data, expectedData, @"test string ws");
+
+  str = @"ARAf*j1M"; // not in the alphabet
+  data = GTLDecodeBase64(str);
+  XCTAssertNil(data, @"invalid character");
+
+  str = @"ARAf-j1M"; // web-safe character
+  data = GTLDecodeBase64(str);
+  XCTAssertNil(data, @"web-safe character");
+  data = GTLDecodeWebSafeBase64(str);
+  XCTAssertEqual(data.length, (NSUInteger)6, @"web-safe character ws");
+
+  str = @"AR==ARAf"; // padding before the end
+  data = GTLDecodeBase64(str);
+  XCTAssertNil(data, @"early padding");
+}
+
+- (NSData *)randomDataOfLength:(NSUInteger)length {
+  NSMutableData *data = [NSMutableData dataWithLength:length];
+  uint8_t *bytes = data.mutableBytes;
+  for (NSUInteger idx = 0; idx < length; idx++) {
+    bytes[idx] = (uint8_t)arc4random();
+  }
+  return data;
+}
+
+- (void)testBase64Lengths {
+  // Lengths around the sizes of the blocks encoded together
+  for (NSUInteger length = 0; length < 300; length++) {
+    NSData *data = [self randomDataOfLength:length];
+    NSString *expected = [data base64EncodedStringWithOptions:0];
+    NSString *expectedWeb =
+      [[expected stringByReplacingOccurrencesOfString:@"+" withString:@"-"]
+                 stringByReplacingOccurrencesOfString:@"/" withString:@"_"];
+
+    XCTAssertEqualObjects(GTLEncodeBase64(data), expected, @"%lu", (unsigned long)length);
+    XCTAssertEqualObjects(GTLEncodeWebSafeBase64(data), expectedWeb, @"%lu", (unsigned long)length);
+    XCTAssertEqualObjects(GTLDecodeBase64(expected), data, @"%lu", (unsigned long)length);
+    XCTAssertEqualObjects(GTLDecodeWebSafeBase64(expectedWeb), data, @"%lu", (unsigned long)length);
+
+    // A character outside the alphabet anywhere is rejected
+    if (length > 0) {
+      NSUInteger position = arc4random_uniform((uint32_t)(length * 4 / 3));
+      NSString *invalid =
+        [expectedWeb stringByReplacingCharactersInRange:NSMakeRange(position, 1)
+                                             withString:@"+"];
+      XCTAssertNil(GTLDecodeWebSafeBase64(invalid), @"%lu", (unsigned long)length);
+    }
+  }
+}
+
+- (void)testBase64StreamingDecoder {
+  NSData *data = [self randomDataOfLength:100000];
+  NSString *encoded = GTLEncodeWebSafeBase64(data);
+  NSData *encodedData = [encoded dataUsingEncoding:NSASCIIStringEncoding];
+
+  // Chunks of any size, with and without padding
+  NSString *unpadded = [encoded stringByTrimmingCharactersInSet:
+                        [NSCharacterSet characterSetWithCharactersInString:@"="]];
+  XCTAssertNotEqual(unpadded.length, encoded.length);
+  NSData *unpaddedData = [unpadded dataUsingEncoding:NSASCIIStringEncoding];
+
+  for (NSData *input in @[ encodedData, unpaddedData ]) {
+    for (NSUInteger chunkSize = 1; chunkSize < 20000; chunkSize = chunkSize * 3 + 1) {
+      NSMutableData *output = [NSMutableData data];
+      GTLBase64Decoder *decoder =
+        [[[GTLBase64Decoder alloc] initWithMutableData:output
+                                               webSafe:YES] autorelease];
+      for (NSUInteger offset = 0; offset < input.length; offset += chunkSize) {
+        NSUInteger length = MIN(chunkSize, input.length - offset);
+        XCTAssertTrue([decoder appendData:[input subdataWithRange:NSMakeRange(offset, length)]]);
+      }
+      XCTAssertTrue([decoder finish]);
+      XCTAssertTrue(decoder.isValid);
+      XCTAssertEqualObjects(output, data, @"chunk size %lu", (unsigned long)chunkSize);
+    }
+  }
+
+  // Strings
+  NSMutableData *output = [NSMutableData data];
+  GTLBase64Decoder *decoder =
+    [[[GTLBase64Decoder alloc] initWithMutableData:output
+                                           webSafe:YES] autorelease];
+  XCTAssertTrue([decoder appendString:[encoded substringToIndex:1001]]);
+  XCTAssertTrue([decoder appendString:[encoded substringFromIndex:1001]]);
+  XCTAssertTrue([decoder finish]);
+  XCTAssertEqualObjects(output, data);
+
+  // Data after padding, and invalid endings
+  decoder = [[[GTLBase64Decoder alloc] initWithMutableData:[NSMutableData data]
+                                                   webSafe:NO] autorelease];
+  XCTAssertTrue([decoder appendString:@"QQ=="]);
+  XCTAssertFalse([decoder appendString:@"QQ=="]);
+  XCTAssertFalse([decoder finish]);
+  XCTAssertFalse(decoder.isValid);
+
+  decoder = [[[GTLBase64Decoder alloc] initWithMutableData:[NSMutableData data]
+                                                   webSafe:NO] autorelease];
+  XCTAssertTrue([decoder appendString:@"QUJ"]);
+  XCTAssertTrue([decoder appendString:@"DR"]);
+  XCTAssertFalse([decoder finish]);
+
+  decoder = [[[GTLBase64Decoder alloc] initWithMutableData:[NSMutableData data]
+                                                   webSafe:NO] autorelease];
+  XCTAssertFalse([decoder appendString:@"QUJD\u00e9RA=="]);
+
+  // Files
+  NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:
+                    [[NSProcessInfo processInfo] globallyUniqueString]];
+  XCTAssertTrue([[NSFileManager defaultManager] createFileAtPath:path
+                                                        contents:nil
+                                                      attributes:nil]);
+  NSFileHandle *fileHandle = [NSFileHandle fileHandleForWritingAtPath:path];
+  decoder = [[[GTLBase64Decoder alloc] initWithFileHandle:fileHandle
+                                                  webSafe:YES] autorelease];
+  XCTAssertTrue([decoder appendData:unpaddedData]);
+  XCTAssertTrue([decoder finish]);
+  [fileHandle closeFile];
+  XCTAssertEqualObjects([NSData dataWithContentsOfFile:path], data);
+  [[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+}
+
+#pragma mark Performance
+
+- (void)testBase64EncodingPerformance {
+  // A large attachment
+  NSData *data = [self randomDataOfLength:8 * 1024 * 1024];
+
+  [self measureBlock:^{
+    for (int idx = 0; idx < 10; idx++) {
+      @autoreleasepool {
+        GTLEncodeWebSafeBase64(data);
+      }
+    }
+  }];
+}
+
+- (void)testBase64DecodingPerformance {
+  NSString *encoded = GTLEncodeWebSafeBase64([self randomDataOfLength:8 * 1024 * 1024]);
+
+  [self measureBlock:^{
+    for (int idx = 0; idx < 10; idx++) {
+      @autoreleasepool {
+        GTLDecodeWebSafeBase64(encoded);
+      }
+    }
+  }];
 }
+
+- (void)testNSDataBase64DecodingPerformance {
+  // For comparison with testBase64DecodingPerformance
+  NSString *encoded = GTLEncodeBase64([self randomDataOfLength:8 * 1024 * 1024]);
+
+  [self measureBlock:^{
+    for (int idx = 0; idx < 10; idx++) {
+      @autoreleasepool {
+        [[[NSData alloc] initWithBase64EncodedString:encoded options:0] release];
+      }
+    }
+  }];
+}
+
 @end
@@ -202,4 +202,110 @@
                   (NSInteger)[dateTime.timeZone daylightSavingTimeOffset]));
 }
 
+- (void)testDateConversion {
+  // Dates of RFC 3339 strings are computed without NSCalendar; compare them
+  // with NSCalendar's.
+  NSArray *strings = @[ @"2006-10-14T15:00:00-01:00",
+                        @"2006-10-14T15:00:00Z",
+                        @"2006-10-14T15:00:00.735+05:30",
+                        @"2000-02-29T23:59:59.999-08:00",
+                        @"2100-03-01T00:00:00Z",
+                        @"1970-01-01T00:00:00Z",
+                        @"1600-01-01T12:34:56Z",
+                        @"2006-10-14",
+                        @"1999-12-31" ];
+#if GTL_NEW_CALENDAR_ENUMS
+  NSString *calendarID = NSCalendarIdentifierGregorian;
+#else
+  NSString *calendarID = NSGregorianCalendar;
+#endif
+  NSCalendar *cal =
+    [[[NSCalendar alloc] initWithCalendarIdentifier:calendarID] autorelease];
+
+  for (NSString *str in strings) {
+    GTLDateTime *dateTime = [GTLDateTime dateTimeWithRFC3339String:str];
+    XCTAssertEqualObjects(dateTime.RFC3339String, str);
+
+    NSDateComponents *components = [[dateTime.dateComponents copy] autorelease];
+    NSTimeInterval extraSeconds = dateTime.milliseconds / 1000.0;
+    if (dateTime.hasTime) {
+      cal.timeZone = dateTime.timeZone;
+    } else {
+      components.hour = 12;
+      components.minute = 0;
+      components.second = 0;
+      cal.timeZone = [NSTimeZone timeZoneWithName:@"Universal"];
+      extraSeconds = 0;
+    }
+    NSDate *expected = [cal dateFromComponents:components];
+    expected = [expected dateByAddingTimeInterval:extraSeconds];
+    XCTAssertEqualObjects(dateTime.date, expected, @"%@", str);
+  }
+
+  // Components are made from the string's fields.
+  GTLDateTime *dateTime =
+    [GTLDateTime dateTimeWithRFC3339String:@"2011-05-03T23:14:20.12Z"];
+  NSDateComponents *components = dateTime.dateComponents;
+  XCTAssertEqual(components.year, 2011);
+  XCTAssertEqual(components.month, 5);
+  XCTAssertEqual(components.day, 3);
+  XCTAssertEqual(components.hour, 23);
+  XCTAssertEqual(components.minute, 14);
+  XCTAssertEqual(components.second, 20);
+  XCTAssertEqual(dateTime.milliseconds, 120);
+  XCTAssertTrue(dateTime.dateComponents == components);
+
+  // Strings not in the servers' fixed format are still scanned.
+  dateTime = [GTLDateTime dateTimeWithRFC3339String:@"2011-5-3T9:14:20.5-8:00"];
+  XCTAssertEqualObjects(dateTime.RFC3339String, @"2011-05-03T09:14:20.500-08:00");
+}
+
+#pragma mark Performance
+
+- (NSArray *)timestampStrings {
+  NSMutableArray *strings = [NSMutableArray array];
+  for (int idx = 0; idx < 1000; idx++) {
+    NSString *str =
+      [NSString stringWithFormat:@"20%02d-%02d-%02dT%02d:%02d:%02d.%03dZ",
+       idx % 30, idx % 12 + 1, idx % 28 + 1, idx % 24, idx % 60, (idx * 7) % 60,
+       idx];
+    [strings addObject:str];
+  }
+  return strings;
+}
+
+- (void)testRFC3339ParsingPerformance {
+  // A million timestamps, as in the items of large list responses
+  NSArray *strings = [self timestampStrings];
+
+  [self measureBlock:^{
+    for (int idx = 0; idx < 1000; idx++) {
+      @autoreleasepool {
+        for (NSString *str in strings) {
+          [[GTLDateTime dateTimeWithRFC3339String:str] date];
+        }
+      }
+    }
+  }];
+}
+
+- (void)testRFC3339FormattingPerformance {
+  NSMutableArray *dates = [NSMutableArray array];
+  for (NSString *str in [self timestampStrings]) {
+    GTLDateTime *dateTime = [GTLDateTime dateTimeWithRFC3339String:str];
+    [dates addObject:dateTime.date];
+  }
+  NSTimeZone *tz = [NSTimeZone timeZoneForSecondsFromGMT:-8 * 60 * 60];
+
+  [self measureBlock:^{
+    for (int idx = 0; idx < 1000; idx++) {
+      @autoreleasepool {
+        for (NSDate *date in dates) {
+          [[GTLDateTime dateTimeWithDate:date timeZone:tz] RFC3339String];
+        }
+      }
+    }
+  }];
+}
+
 @end
@@ -18,8 +18,12 @@
 #import <objc/runtime.h>
 
 #import "GTLObject.h"
+#import "GTLBatchResult.h"
 #import "GTLDateTime.h"
+#import "GTLErrorObject.h"
 #import "GTLJSONParser.h"
+#import "GTLRuntimeCommon.h"
+#import "GTLTasksTask.h"
 
 // Custom subclass for testing the property handling.
 @class GTLTestingObject;
@@ -118,6 +122,264 @@ static Class gAdditionalPropsClass = Nil;
 }
 @end
 
+// The same properties as GTLTestingObject, but with the accessors implemented
+// the way the ServiceGenerator's --staticAccessors mode writes them.
+@interface GTLTestingStaticObject : GTLObject
+@property (copy) NSString *aStr;
+@property (retain) NSNumber *aNum;
+@property (retain) GTLDateTime *aDate;
+@property (retain) GTLTestingStaticObject *child;
+@property (retain) id anything;
+@property (retain) NSArray *arrayString;
+@property (retain) NSArray *arrayKids;
+@end
+
+@implementation GTLTestingStaticObject
+@dynamic aStr, aNum, aDate, child, anything, arrayString, arrayKids;
+
++ (NSDictionary *)propertyToJSONKeyMap {
+  return @{ @"aStr" : @"a_str",
+            @"aNum" : @"a.num",
+            @"aDate" : @"a_date" };
+}
+
++ (NSDictionary *)arrayPropertyToClassMap {
+  return @{ @"arrayString" : [NSString class],
+            @"arrayKids" : [GTLTestingStaticObject class] };
+}
+
+- (NSString *)aStr {
+  return [self JSONValueForKey:@"a_str"];
+}
+
+- (void)setAStr:(NSString *)value {
+  [self setJSONString:value forKey:@"a_str"];
+}
+
+- (NSNumber *)aNum {
+  return [self JSONNumberForKey:@"a.num"];
+}
+
+- (void)setANum:(NSNumber *)value {
+  [self setJSONValue:value forKey:@"a.num"];
+}
+
+- (GTLDateTime *)aDate {
+  return [self JSONDateTimeForKey:@"a_date"];
+}
+
+- (void)setADate:(GTLDateTime *)value {
+  [self setJSONDateTime:value forKey:@"a_date"];
+}
+
+- (GTLTestingStaticObject *)child {
+  return [self JSONObjectForKey:@"child" objectClass:[GTLTestingStaticObject class]];
+}
+
+- (void)setChild:(GTLTestingStaticObject *)value {
+  [self setJSONObject:value forKey:@"child"];
+}
+
+- (id)anything {
+  return [self JSONAnyObjectForKey:@"anything"];
+}
+
+- (void)setAnything:(id)value {
+  [self setJSONAnyObject:value forKey:@"anything"];
+}
+
+- (NSArray *)arrayString {
+  return [self JSONArrayForKey:@"arrayString" itemClass:[NSString class]];
+}
+
+- (void)setArrayString:(NSArray *)value {
+  [self setJSONArray:value forKey:@"arrayString" itemClass:[NSString class]];
+}
+
+- (NSArray *)arrayKids {
+  return [self JSONArrayForKey:@"arrayKids" itemClass:[GTLTestingStaticObject class]];
+}
+
+- (void)setArrayKids:(NSArray *)value {
+  [self setJSONArray:value forKey:@"arrayKids" itemClass:[GTLTestingStaticObject class]];
+}
+@end
+
+// GTLTasksTask, a generated class, with its accessors implemented the way
+// the ServiceGenerator's --staticAccessors mode writes them.
+@interface GTLTestingStaticTasksTask : GTLTasksTask
+@end
+
+@implementation GTLTestingStaticTasksTask
+
+- (GTLDateTime *)completed {
+  return [self JSONDateTimeForKey:@"completed"];
+}
+
+- (void)setCompleted:(GTLDateTime *)value {
+  [self setJSONDateTime:value forKey:@"completed"];
+}
+
+- (NSNumber *)deleted {
+  return [self JSONNumberForKey:@"deleted"];
+}
+
+- (void)setDeleted:(NSNumber *)value {
+  [self setJSONValue:value forKey:@"deleted"];
+}
+
+- (GTLDateTime *)due {
+  return [self JSONDateTimeForKey:@"due"];
+}
+
+- (void)setDue:(GTLDateTime *)value {
+  [self setJSONDateTime:value forKey:@"due"];
+}
+
+- (NSString *)ETag {
+  return [self JSONValueForKey:@"etag"];
+}
+
+- (void)setETag:(NSString *)value {
+  [self setJSONString:value forKey:@"etag"];
+}
+
+- (NSNumber *)hidden {
+  return [self JSONNumberForKey:@"hidden"];
+}
+
+- (void)setHidden:(NSNumber *)value {
+  [self setJSONValue:value forKey:@"hidden"];
+}
+
+- (NSString *)identifier {
+  return [self JSONValueForKey:@"id"];
+}
+
+- (void)setIdentifier:(NSString *)value {
+  [self setJSONString:value forKey:@"id"];
+}
+
+- (NSString *)kind {
+  return [self JSONValueForKey:@"kind"];
+}
+
+- (void)setKind:(NSString *)value {
+  [self setJSONString:value forKey:@"kind"];
+}
+
+- (NSArray *)links {
+  return [self JSONArrayForKey:@"links" itemClass:[GTLTasksTaskLinksItem class]];
+}
+
+- (void)setLinks:(NSArray *)value {
+  [self setJSONArray:value forKey:@"links" itemClass:[GTLTasksTaskLinksItem class]];
+}
+
+- (NSString *)notes {
+  return [self JSONValueForKey:@"notes"];
+}
+
+- (void)setNotes:(NSString *)value {
+  [self setJSONString:value forKey:@"notes"];
+}
+
+- (NSString *)parent {
+  return [self JSONValueForKey:@"parent"];
+}
+
+- (void)setParent:(NSString *)value {
+  [self setJSONString:value forKey:@"parent"];
+}
+
+- (NSString *)position {
+  return [self JSONValueForKey:@"position"];
+}
+
+- (void)setPosition:(NSString *)value {
+  [self setJSONString:value forKey:@"position"];
+}
+
+- (NSString *)selfLink {
+  return [self JSONValueForKey:@"selfLink"];
+}
+
+- (void)setSelfLink:(NSString *)value {
+  [self setJSONString:value forKey:@"selfLink"];
+}
+
+- (NSString *)status {
+  return [self JSONValueForKey:@"status"];
+}
+
+- (void)setStatus:(NSString *)value {
+  [self setJSONString:value forKey:@"status"];
+}
+
+- (NSString *)title {
+  return [self JSONValueForKey:@"title"];
+}
+
+- (void)setTitle:(NSString *)value {
+  [self setJSONString:value forKey:@"title"];
+}
+
+- (GTLDateTime *)updated {
+  return [self JSONDateTimeForKey:@"updated"];
+}
+
+- (void)setUpdated:(GTLDateTime *)value {
+  [self setJSONDateTime:value forKey:@"updated"];
+}
+@end
+
+// An operation which reports itself cancelled once it has been checked a
+// number of times, as though it were cancelled partway through decoding.
+@interface GTLTestingCancellingOperation : NSOperation {
+  NSUInteger numberOfChecks_;
+  NSUInteger numberOfChecksBeforeCancelling_;
+}
+@property (assign) NSUInteger numberOfChecksBeforeCancelling;
+@property (readonly) NSUInteger numberOfChecks;
+@end
+
+@implementation GTLTestingCancellingOperation
+@synthesize numberOfChecksBeforeCancelling = numberOfChecksBeforeCancelling_;
+
+- (BOOL)isCancelled {
+  @synchronized(self) {
+    if (numberOfChecks_ < NSUIntegerMax) ++numberOfChecks_;
+    return (numberOfChecks_ > numberOfChecksBeforeCancelling_);
+  }
+}
+
+- (NSUInteger)numberOfChecks {
+  @synchronized(self) {
+    return numberOfChecks_;
+  }
+}
+@end
+
+static NSString * const kAccessorTestJSON =
+  @"{\"a_str\":\"a string\",\"a.num\":1234,"
+  @"\"a_date\":\"2011-01-14T15:00:00Z\","
+  @"\"child\":{\"a_str\":\"kid\",\"a.num\":\"12\"},"
+  @"\"anything\":{\"a\":1},"
+  @"\"arrayString\":[\"x\",\"y\"],"
+  @"\"arrayKids\":[{\"a_str\":\"k1\"},{\"a_str\":\"k2\"}]}";
+
+static NSString * const kTasksTaskTestJSON =
+  @"{\"kind\":\"tasks#task\",\"id\":\"MTYzNjk4NjA5NzQ0NDUxMzY0Mjc6MDox\","
+  @"\"etag\":\"\\\"wJmMV1rNiXahO5uJfhQl7r4nLUI/LTEzNzgxNTkyMQ\\\"\","
+  @"\"title\":\"Task One\",\"notes\":\"Some notes\","
+  @"\"updated\":\"2011-05-07T01:39:58.000Z\","
+  @"\"selfLink\":\"https://www.googleapis.com/tasks/v1/lists/x/tasks/y\","
+  @"\"position\":\"00000000000000000001\",\"status\":\"completed\","
+  @"\"due\":\"2011-05-10T00:00:00.000Z\","
+  @"\"completed\":\"2011-05-07T01:39:58.000Z\",\"hidden\":true,"
+  @"\"links\":[{\"type\":\"email\",\"description\":\"An email\","
+  @"\"link\":\"https://mail.google.com/mail/#all/1\"}]}";
+
 @interface GTLObjectTest : XCTestCase
 @end
 
@@ -1319,6 +1581,509 @@ static Class gAdditionalPropsClass = Nil;
   XCTAssertEqualObjects([collection itemForIdentifier:@"obj0"], items[0]);
 }
 
+#pragma mark GTLBatchResult
+
+// Returns the JSON of a batch response with enough responses to be decoded
+// in parallel: collections, deletes, and failures.
+- (NSMutableArray *)batchResponsesJSONWithCount:(NSUInteger)numberOfResponses
+                                       classMap:(NSMutableDictionary *)classMap {
+  NSMutableArray *json = [NSMutableArray array];
+  for (NSUInteger idx = 0; idx < numberOfResponses; idx++) {
+    NSString *requestID = [NSString stringWithFormat:@"gtl_%lu", (unsigned long)idx];
+    NSMutableDictionary *response = [NSMutableDictionary dictionary];
+    response[@"id"] = requestID;
+    if (idx % 5 == 0) {
+      response[@"error"] = [NSMutableDictionary dictionaryWithDictionary:
+                            @{ @"code" : @404, @"message" : @"Not Found" }];
+    } else if (idx % 5 == 1) {
+      // no result, as for a delete
+    } else {
+      NSMutableDictionary *item =
+        [NSMutableDictionary dictionaryWithObject:requestID forKey:@"a_str"];
+      response[@"result"] =
+        [NSMutableDictionary dictionaryWithObject:[NSMutableArray arrayWithObject:item]
+                                           forKey:@"items"];
+      classMap[requestID] = [GTLTestingCollection class];
+    }
+    [json addObject:response];
+  }
+  return json;
+}
+
+- (void)testBatchResultDecoding {
+  const NSUInteger kNumberOfResponses = 200;
+  NSMutableDictionary *classMap = [NSMutableDictionary dictionary];
+  NSMutableArray *json = [self batchResponsesJSONWithCount:kNumberOfResponses
+                                                  classMap:classMap];
+
+  GTLBatchResult *batchResult = [GTLBatchResult object];
+  batchResult.JSON = (NSMutableDictionary *)json;
+  [batchResult createItemsWithClassMap:classMap];
+
+  XCTAssertEqual(batchResult.failures.count, kNumberOfResponses / 5);
+  XCTAssertEqual(batchResult.successes.count, kNumberOfResponses * 4 / 5);
+  for (NSUInteger idx = 0; idx < kNumberOfResponses; idx++) {
+    NSString *requestID = [NSString stringWithFormat:@"gtl_%lu", (unsigned long)idx];
+    if (idx % 5 == 0) {
+      GTLErrorObject *errorObj = batchResult.failures[requestID];
+      XCTAssertEqualObjects(errorObj.code, @404);
+    } else if (idx % 5 == 1) {
+      XCTAssertEqualObjects(batchResult.successes[requestID], [NSNull null]);
+    } else {
+      GTLTestingCollection *collection = batchResult.successes[requestID];
+      XCTAssertTrue([collection isKindOfClass:[GTLTestingCollection class]]);
+      XCTAssertEqualObjects([collection.items[0] aStr], requestID);
+    }
+  }
+}
+
+- (void)testBatchResultDecodingCancellation {
+  const NSUInteger kNumberOfResponses = 200;
+  NSMutableDictionary *classMap = [NSMutableDictionary dictionary];
+  NSMutableArray *json = [self batchResponsesJSONWithCount:kNumberOfResponses
+                                                  classMap:classMap];
+
+  // An operation which is not cancelled gets all of the results
+  GTLTestingCancellingOperation *operation =
+    [[[GTLTestingCancellingOperation alloc] init] autorelease];
+  operation.numberOfChecksBeforeCancelling = NSUIntegerMax;
+  GTLBatchResult *batchResult =
+    (GTLBatchResult *)[GTLObject objectForJSON:(NSMutableDictionary *)json
+                                  defaultClass:[GTLBatchResult class]
+                                    surrogates:nil
+                                 batchClassMap:classMap
+                                     operation:operation];
+  XCTAssertTrue([batchResult isKindOfClass:[GTLBatchResult class]]);
+  XCTAssertEqual(batchResult.successes.count, kNumberOfResponses * 4 / 5);
+
+  // Cancelling partway through decoding stops it long before the last
+  // response, and no object is returned
+  operation = [[[GTLTestingCancellingOperation alloc] init] autorelease];
+  operation.numberOfChecksBeforeCancelling = 10;
+  batchResult =
+    (GTLBatchResult *)[GTLObject objectForJSON:(NSMutableDictionary *)json
+                                  defaultClass:[GTLBatchResult class]
+                                    surrogates:nil
+                                 batchClassMap:classMap
+                                     operation:operation];
+  XCTAssertNil(batchResult);
+  XCTAssertTrue(operation.isCancelled);
+  XCTAssertTrue(operation.numberOfChecks < kNumberOfResponses,
+                @"%lu checks", (unsigned long)operation.numberOfChecks);
+}
+
+#pragma mark Copying
+
+- (void)testCopiesShareUnchangedJSON {
+  GTLTestingObject *original = [GTLTestingObject object];
+  original.aStr = @"top";
+  original.child = [GTLTestingObject object];
+  original.child.aStr = @"kid";
+  original.child.child = [GTLTestingObject object];
+  original.child.child.aStr = @"grandkid";
+  GTLTestingObject *kid1 = [GTLTestingObject object];
+  kid1.aStr = @"kid1";
+  original.arrayKids = @[ kid1 ];
+
+  // Make the original from JSON alone, so no child objects are cached yet.
+  original = [GTLTestingObject objectWithJSON:original.JSON];
+
+  GTLTestingObject *copy1 = [[original copySharingNestedJSON] autorelease];
+  XCTAssertEqualObjects(copy1, original);
+  XCTAssertEqual(copy1.hash, original.hash);
+
+  // Changes through either object's children don't show in the other.
+  copy1.child.child.aStr = @"changed grandkid";
+  XCTAssertEqualObjects(original.child.child.aStr, @"grandkid");
+  original.child.aStr = @"changed kid";
+  XCTAssertEqualObjects(copy1.child.aStr, @"kid");
+  GTLTestingObject *copiedKid1 = copy1.arrayKids[0];
+  copiedKid1.aStr = @"changed kid1";
+  XCTAssertEqualObjects([original.arrayKids[0] aStr], @"kid1");
+
+  // Children cached before copying are copied along with their JSON.
+  GTLTestingObject *copy2 = [[copy1 copySharingNestedJSON] autorelease];
+  XCTAssertEqualObjects(copy2, copy1);
+  XCTAssertEqualObjects(copy2.child.child.aStr, @"changed grandkid");
+  copy1.child.child.aStr = @"grandkid again";
+  copiedKid1.aStr = @"kid1 again";
+  XCTAssertEqualObjects(copy2.child.child.aStr, @"changed grandkid");
+  XCTAssertEqualObjects([copy2.arrayKids[0] aStr], @"changed kid1");
+
+  copy2.child.aStr = @"copy2 kid";
+  XCTAssertEqualObjects(copy1.child.aStr, @"kid");
+  XCTAssertEqualObjects(original.child.aStr, @"changed kid");
+
+  // Result arrays' JSON is an array of items.
+  NSMutableArray *itemsJSON = [NSMutableArray arrayWithObject:
+    [NSMutableDictionary dictionaryWithObject:@"item" forKey:@"a_str"]];
+  GTLTestingResultArray *resultArray = [GTLTestingResultArray object];
+  resultArray.JSON = (NSMutableDictionary *)itemsJSON;
+  GTLTestingResultArray *resultArrayCopy = [[resultArray copySharingNestedJSON] autorelease];
+  [resultArrayCopy.items[0] setAStr:@"changed item"];
+  XCTAssertEqualObjects([resultArray.items[0] aStr], @"item");
+
+  // Reading a child that isn't cached copies its shared JSON only once.
+  GTLTestingObject *mismatched = [GTLTestingObject object];
+  [mismatched setJSONValue:[NSMutableArray arrayWithObject:@"x"] forKey:@"child"];
+  GTLTestingObject *mismatchedCopy = [[mismatched copySharingNestedJSON] autorelease];
+  XCTAssertEqualObjects((id)mismatchedCopy.child, (@[ @"x" ]));
+  id childJSON = mismatchedCopy.JSON[@"child"];
+  XCTAssertEqualObjects((id)mismatchedCopy.child, (@[ @"x" ]));
+  XCTAssertTrue(mismatchedCopy.JSON[@"child"] == childJSON);
+}
+
+- (void)testCopiesAreDeep {
+  GTLTestingObject *original = [GTLTestingObject object];
+  original.child = [GTLTestingObject object];
+  original.child.aStr = @"kid";
+  original = [GTLTestingObject objectWithJSON:original.JSON];
+
+  GTLTestingObject *copied = [[original copy] autorelease];
+  XCTAssertEqualObjects(copied, original);
+  XCTAssertEqual(copied.hash, original.hash);
+
+  // Changing the nested JSON of the copy directly doesn't reach the original.
+  copied.JSON[@"child"][@"a_str"] = @"changed kid";
+  XCTAssertEqualObjects(original.JSON[@"child"][@"a_str"], @"kid");
+  XCTAssertEqualObjects(original.child.aStr, @"kid");
+}
+
+- (void)testCopyPerformance {
+  // Copy an object with many children, then change one of them.
+  GTLTestingCollection *collection = [GTLTestingCollection object];
+  collection.items = [self hashTestObjectsWithCount:10000];
+  collection = [GTLTestingCollection objectWithJSON:collection.JSON];
+
+  [self measureBlock:^{
+    for (int idx = 0; idx < 100; idx++) {
+      GTLTestingCollection *copy =
+        [[collection copySharingNestedJSON] autorelease];
+      XCTAssertNotNil(copy.JSON);
+      [copy setJSONValue:@"changed" forKey:@"a_str"];
+    }
+  }];
+}
+
+#pragma mark Hashing
+
+- (void)testHash {
+  // Equal objects have equal hashes.
+  GTLTestingObject *obj1 = [GTLTestingObject object];
+  obj1.aStr = @"a string";
+  obj1.aNum = @123;
+  obj1.child = [GTLTestingObject object];
+  obj1.child.aStr = @"kid";
+
+  GTLTestingObject *obj2 = [[obj1 copy] autorelease];
+  XCTAssertEqualObjects(obj1, obj2);
+  XCTAssertEqual(obj1.hash, obj2.hash);
+
+  // Setters change the cached hash.
+  NSUInteger oldHash = obj1.hash;
+  obj1.aNum = @456;
+  XCTAssertNotEqualObjects(obj1, obj2);
+  XCTAssertNotEqual(obj1.hash, oldHash);
+
+  obj2.aNum = @456;
+  XCTAssertEqualObjects(obj1, obj2);
+  XCTAssertEqual(obj1.hash, obj2.hash);
+
+  // Setting the JSON changes the cached hash.
+  obj2.JSON = [NSMutableDictionary dictionaryWithObject:@"other" forKey:@"a_str"];
+  XCTAssertNotEqual(obj1.hash, obj2.hash);
+
+  // Objects with an id hash by kind, id, and etag, but still compare all of
+  // their JSON.
+  GTLTestingObject *obj3 = [GTLTestingObject object];
+  [obj3 setJSONValue:@"abc" forKey:@"id"];
+  [obj3 setJSONValue:@"test#object" forKey:@"kind"];
+  obj3.aStr = @"first";
+
+  GTLTestingObject *obj4 = [GTLTestingObject object];
+  [obj4 setJSONValue:@"abc" forKey:@"id"];
+  [obj4 setJSONValue:@"test#object" forKey:@"kind"];
+  obj4.aStr = @"second";
+
+  XCTAssertEqual(obj3.hash, obj4.hash);
+  XCTAssertNotEqualObjects(obj3, obj4);
+
+  [obj4 setJSONValue:@"\"etag2\"" forKey:@"etag"];
+  XCTAssertNotEqual(obj3.hash, obj4.hash);
+
+  // Sets find objects by value.
+  NSSet *set = [NSSet setWithObjects:obj1, obj3, nil];
+  XCTAssertTrue([set containsObject:[[obj1 copy] autorelease]]);
+  XCTAssertTrue([set containsObject:[[obj3 copy] autorelease]]);
+  XCTAssertFalse([set containsObject:obj4]);
+}
+
+- (NSArray *)hashTestObjectsWithCount:(NSUInteger)count {
+  NSMutableArray *objects = [NSMutableArray arrayWithCapacity:count];
+  for (NSUInteger idx = 0; idx < count; idx++) {
+    GTLTestingObject *obj = [GTLTestingObject object];
+    [obj setJSONValue:@"test#object" forKey:@"kind"];
+    [obj setJSONValue:[NSString stringWithFormat:@"id%lu", (unsigned long)idx]
+               forKey:@"id"];
+    [obj setJSONValue:[NSString stringWithFormat:@"\"%lu\"", (unsigned long)idx % 7]
+               forKey:@"etag"];
+    obj.aStr = @"title";
+    [objects addObject:obj];
+  }
+  return objects;
+}
+
+- (void)testHashSetMembershipPerformance {
+  // Build a set of 100k objects and look up an equal copy of each.
+  const NSUInteger kNumberOfObjects = 100000;
+  NSArray *objects = [self hashTestObjectsWithCount:kNumberOfObjects];
+  NSMutableArray *copies = [NSMutableArray arrayWithCapacity:kNumberOfObjects];
+  for (GTLTestingObject *obj in objects) {
+    [copies addObject:[[obj copy] autorelease]];
+  }
+
+  [self measureBlock:^{
+    NSSet *set = [NSSet setWithArray:objects];
+    XCTAssertEqual(set.count, kNumberOfObjects);
+
+    NSUInteger numberFound = 0;
+    for (GTLTestingObject *obj in copies) {
+      if ([set containsObject:obj]) ++numberFound;
+    }
+    XCTAssertEqual(numberFound, kNumberOfObjects);
+  }];
+}
+
+#pragma mark Generated Accessors
+
+- (void)testStaticAccessors {
+  // Objects with generated accessors must behave just like dynamic ones.
+  NSError *err = nil;
+  NSMutableDictionary *json = [GTLJSONParser objectWithString:kAccessorTestJSON
+                                                        error:&err];
+  XCTAssertNil(err);
+  GTLTestingObject *dynamicObj = [GTLTestingObject objectWithJSON:json];
+
+  json = [GTLJSONParser objectWithString:kAccessorTestJSON error:&err];
+  XCTAssertNil(err);
+  GTLTestingStaticObject *staticObj = [GTLTestingStaticObject objectWithJSON:json];
+
+  XCTAssertEqualObjects(staticObj.aStr, dynamicObj.aStr);
+  XCTAssertEqualObjects(staticObj.aNum, dynamicObj.aNum);
+  XCTAssertEqualObjects(staticObj.aDate, dynamicObj.aDate);
+  XCTAssertTrue(staticObj.aDate == staticObj.aDate);  // cached
+  XCTAssertTrue([staticObj.child isKindOfClass:[GTLTestingStaticObject class]]);
+  XCTAssertTrue(staticObj.child == staticObj.child);  // cached
+  XCTAssertEqualObjects(staticObj.child.aStr, @"kid");
+  XCTAssertEqualObjects(staticObj.child.aNum, dynamicObj.child.aNum);
+  XCTAssertTrue([staticObj.child.aNum isKindOfClass:[NSNumber class]]);
+  XCTAssertEqualObjects([staticObj.anything JSON], [dynamicObj.anything JSON]);
+  XCTAssertEqualObjects(staticObj.arrayString, dynamicObj.arrayString);
+  XCTAssertEqual(staticObj.arrayKids.count, (NSUInteger)2);
+  XCTAssertTrue([staticObj.arrayKids[1] isKindOfClass:[GTLTestingStaticObject class]]);
+  XCTAssertEqualObjects([staticObj.arrayKids[1] aStr], @"k2");
+  XCTAssertNil(staticObj.additionalJSONKeys);
+
+  // Setters produce the same JSON.
+  GTLTestingObject *dynamicObj2 = [GTLTestingObject object];
+  GTLTestingStaticObject *staticObj2 = [GTLTestingStaticObject object];
+  NSMutableString *mutableStr = [NSMutableString stringWithString:@"abc"];
+  GTLDateTime *dateTime = [GTLDateTime dateTimeWithRFC3339String:@"2011-01-14T15:00:00Z"];
+
+  dynamicObj2.aStr = mutableStr;
+  staticObj2.aStr = mutableStr;
+  dynamicObj2.aNum = @3;
+  staticObj2.aNum = @3;
+  dynamicObj2.aDate = dateTime;
+  staticObj2.aDate = dateTime;
+  dynamicObj2.child = [GTLTestingObject object];
+  staticObj2.child = [GTLTestingStaticObject object];
+  dynamicObj2.anything = @[ @"a", @1 ];
+  staticObj2.anything = @[ @"a", @1 ];
+  dynamicObj2.arrayString = @[ @"x" ];
+  staticObj2.arrayString = @[ @"x" ];
+  [mutableStr appendString:@"def"];
+  XCTAssertEqualObjects(staticObj2.JSON, dynamicObj2.JSON);
+  XCTAssertEqualObjects(staticObj2.aStr, @"abc");
+  XCTAssertTrue(staticObj2.aDate == dateTime);
+
+  // NSNull comes through as it does for dynamic properties.
+  staticObj2.child = [GTLObject nullValue];
+  staticObj2.aDate = [GTLObject nullValue];
+  XCTAssertEqualObjects(staticObj2.child, [NSNull null]);
+  XCTAssertEqualObjects(staticObj2.aDate, [NSNull null]);
+}
+
+- (void)testChildCacheSlots {
+  // Only the properties made from their JSON get slots, keyed by JSON key.
+  NSDictionary *slotMap =
+    [GTLRuntimeCommon childCacheSlotMapForClass:[GTLTestingObject class]];
+  NSSet *expectedKeys = [NSSet setWithObjects:@"a_date", @"date2", @"child",
+                         @"anything", @"arrayString", @"arrayNumber",
+                         @"arrayDate", @"arrayKids", @"arrayAnything", nil];
+  XCTAssertEqualObjects([NSSet setWithArray:slotMap.allKeys], expectedKeys);
+  NSSet *slots = [NSSet setWithArray:slotMap.allValues];
+  XCTAssertEqual(slots.count, slotMap.count);
+  for (NSNumber *slot in slots) {
+    XCTAssertLessThan(slot.unsignedIntegerValue, slotMap.count);
+  }
+
+  // Subclasses keep the superclass's slots.
+  NSDictionary *subclassMap =
+    [GTLRuntimeCommon childCacheSlotMapForClass:[GTLTestingObjectWithPrimeKey class]];
+  for (NSString *key in slotMap) {
+    XCTAssertEqualObjects(subclassMap[key], slotMap[key]);
+  }
+
+  // Children cached through a property are found by key, and the reverse.
+  NSError *err = nil;
+  NSMutableDictionary *json = [GTLJSONParser objectWithString:kAccessorTestJSON
+                                                        error:&err];
+  XCTAssertNil(err);
+  GTLTestingObjectWithPrimeKey *obj =
+    [GTLTestingObjectWithPrimeKey objectWithJSON:json];
+  GTLDateTime *dateTime = obj.aDate;
+  XCTAssertNotNil(dateTime);
+  XCTAssertTrue([obj JSONDateTimeForKey:@"a_date"] == dateTime);
+
+  GTLTestingObject *child = [GTLTestingObject object];
+  [obj setJSONObject:child forKey:@"child"];
+  XCTAssertTrue(obj.child == child);
+  XCTAssertTrue(obj.arrayKids == obj.arrayKids);
+
+  // Keys without slots are still cached.
+  obj.JSON[@"extra"] = @{ @"a_str" : @"x" };
+  id extra = [obj additionalPropertyForName:@"extra"];
+  XCTAssertTrue([obj additionalPropertyForName:@"extra"] == extra);
+
+  // Slots outside the class's map are cached by key instead.
+  id<GTLRuntimeCommon> runtimeObj = (id<GTLRuntimeCommon>)obj;
+  NSUInteger badSlot = subclassMap.count + 5;
+  [runtimeObj setCacheChild:child atSlot:badSlot forKey:@"stray"];
+  XCTAssertTrue([runtimeObj cacheChildAtSlot:badSlot forKey:@"stray"] == child);
+  XCTAssertTrue([runtimeObj cacheChildForKey:@"stray"] == child);
+
+  // Copies don't share the cached children.
+  GTLTestingObjectWithPrimeKey *copied = [[obj copy] autorelease];
+  XCTAssertEqualObjects(copied.aDate, dateTime);
+  XCTAssertFalse(copied.child == child);
+  XCTAssertEqualObjects(copied.child.JSON, child.JSON);
+}
+
+- (void)testCachedChildAccessPerformance {
+  NSError *err = nil;
+  NSMutableDictionary *json = [GTLJSONParser objectWithString:kAccessorTestJSON
+                                                        error:&err];
+  XCTAssertNil(err);
+  GTLTestingObject *obj = [GTLTestingObject objectWithJSON:json];
+  [self measureBlock:^{
+    for (int i = 0; i < 1000000; i++) {
+      (void)obj.aDate;
+      (void)obj.child;
+      (void)obj.arrayKids;
+    }
+  }];
+}
+
+- (void)testAccessorPerformanceDynamic {
+  NSError *err = nil;
+  NSDictionary *json = [GTLJSONParser objectWithString:kAccessorTestJSON
+                                                 error:&err];
+  XCTAssertNil(err);
+  [self measureBlock:^{
+    for (int i = 0; i < 10000; i++) {
+      NSMutableDictionary *copied = [[json mutableCopy] autorelease];
+      GTLTestingObject *obj = [GTLTestingObject objectWithJSON:copied];
+      (void)obj.aStr;
+      (void)obj.aNum;
+      (void)obj.aDate;
+      (void)obj.child.aStr;
+      (void)obj.arrayString;
+      obj.aStr = @"changed";
+    }
+  }];
+}
+
+- (void)testAccessorPerformanceStatic {
+  NSError *err = nil;
+  NSDictionary *json = [GTLJSONParser objectWithString:kAccessorTestJSON
+                                                 error:&err];
+  XCTAssertNil(err);
+  [self measureBlock:^{
+    for (int i = 0; i < 10000; i++) {
+      NSMutableDictionary *copied = [[json mutableCopy] autorelease];
+      GTLTestingStaticObject *obj = [GTLTestingStaticObject objectWithJSON:copied];
+      (void)obj.aStr;
+      (void)obj.aNum;
+      (void)obj.aDate;
+      (void)obj.child.aStr;
+      (void)obj.arrayString;
+      obj.aStr = @"changed";
+    }
+  }];
+}
+
+// The same measurements as above, on a generated class that ships with the
+// library, in each of the generator's modes.
+
+- (void)testTasksTaskStaticAccessors {
+  NSError *err = nil;
+  NSMutableDictionary *json = [GTLJSONParser objectWithString:kTasksTaskTestJSON
+                                                        error:&err];
+  XCTAssertNil(err);
+  GTLTasksTask *dynamicTask =
+    [GTLTasksTask objectWithJSON:[[json mutableCopy] autorelease]];
+  GTLTestingStaticTasksTask *staticTask =
+    [GTLTestingStaticTasksTask objectWithJSON:[[json mutableCopy] autorelease]];
+
+  for (GTLTasksTask *task in @[ dynamicTask, staticTask ]) {
+    XCTAssertEqualObjects(task.title, @"Task One");
+    XCTAssertEqualObjects(task.identifier, @"MTYzNjk4NjA5NzQ0NDUxMzY0Mjc6MDox");
+    XCTAssertEqualObjects(task.hidden, @YES);
+    XCTAssertTrue([task.due isKindOfClass:[GTLDateTime class]]);
+    XCTAssertTrue(task.due == task.due);
+    XCTAssertEqual(task.links.count, (NSUInteger)1);
+    XCTAssertEqualObjects([task.links[0] descriptionProperty], @"An email");
+    XCTAssertTrue(task.links == task.links);
+
+    task.title = @"Renamed";
+    task.due = nil;
+    XCTAssertEqualObjects(task.JSON[@"title"], @"Renamed");
+    XCTAssertNil(task.JSON[@"due"]);
+    XCTAssertNil(task.due);
+  }
+  XCTAssertEqualObjects(dynamicTask.JSON, staticTask.JSON);
+}
+
+- (void)measureTasksTaskAccessorsWithClass:(Class)taskClass {
+  NSError *err = nil;
+  NSDictionary *json = [GTLJSONParser objectWithString:kTasksTaskTestJSON
+                                                 error:&err];
+  XCTAssertNil(err);
+  [self measureBlock:^{
+    for (int i = 0; i < 10000; i++) {
+      NSMutableDictionary *copied = [[json mutableCopy] autorelease];
+      GTLTasksTask *task = [taskClass objectWithJSON:copied];
+      (void)task.title;
+      (void)task.notes;
+      (void)task.status;
+      (void)task.hidden;
+      (void)task.updated;
+      (void)task.due;
+      (void)[task.links[0] link];
+      task.title = @"changed";
+    }
+  }];
+}
+
+- (void)testTasksTaskAccessorPerformanceDynamic {
+  [self measureTasksTaskAccessorsWithClass:[GTLTasksTask class]];
+}
+
+- (void)testTasksTaskAccessorPerformanceStatic {
+  [self measureTasksTaskAccessorsWithClass:[GTLTestingStaticTasksTask class]];
+}
+
 #pragma mark GTLResultArray Parsing
 
 - (void)testResultArrayParsing {
@@ -15,6 +15,8 @@
 
 #import <XCTest/XCTest.h>
 
+#import <objc/runtime.h>
+
 #import "GTLService.h"
 #import "GTMHTTPFetcherTestServer.h"
 
@@ -108,6 +110,60 @@
 
 @end
 
+//
+// Service and object classes for testing class preparation
+//
+
+@interface GTLPreparedTestObject : GTLObject
+@property (copy) NSString *name;
+@property (retain) NSNumber *count;
+@property (readonly) NSArray *labels;
+@end
+
+@implementation GTLPreparedTestObject
+@dynamic name, count, labels;
++ (NSDictionary *)arrayPropertyToClassMap {
+  return @{ @"labels" : [NSString class] };
+}
+@end
+
+@interface GTLPreparedTestService : GTLService
+@end
+
+@implementation GTLPreparedTestService
++ (NSArray *)objectClasses {
+  return @[ [GTLPreparedTestObject class] ];
+}
+@end
+
+//
+// Service class whose RPC URL changes with each fetch, for testing retries
+//
+
+@interface GTLChangingURLTestService : GTLService {
+  NSMutableArray *rpcURLs_;
+}
+// Each fetch uses the next URL; the last is used for the remaining fetches.
+@property (retain) NSMutableArray *rpcURLs;
+@end
+
+@implementation GTLChangingURLTestService
+@synthesize rpcURLs = rpcURLs_;
+
+- (void)dealloc {
+  [rpcURLs_ release];
+  [super dealloc];
+}
+
+- (NSURL *)rpcURL {
+  NSURL *url = [[rpcURLs_.firstObject retain] autorelease];
+  if (rpcURLs_.count > 1) {
+    [rpcURLs_ removeObjectAtIndex:0];
+  }
+  return url;
+}
+@end
+
 //
 // Subclasses for testing surrogates
 //
@@ -279,9 +335,15 @@ static NSString *const kBatchRPCPageBName = @"TaskBatchPage1b.rpc";
 
   ticket = [service fetchObjectWithURL:feedURL
                      completionHandler:completionBlock];
+  XCTAssertEqual(ticket.parsePriority, NSOperationQueuePriorityNormal);
+  ticket.parsePriority = NSOperationQueuePriorityHigh;
   [self service:service waitForTicket:ticket];
   XCTAssertTrue(ticket.hasCalledCallback);
 
+  // the parse was timed
+  XCTAssertTrue(ticket.parseQueueWaitTime >= 0);
+  XCTAssertTrue(ticket.parseTime > 0);
+
   //
   // test fetch error
   //
@@ -307,6 +369,267 @@ static NSString *const kBatchRPCPageBName = @"TaskBatchPage1b.rpc";
   XCTAssertEqual(parseStartedCount_, 1);
 }
 
+- (void)testServiceRESTFetchClientParseQueue {
+
+  if (!isServerRunning_) return;
+
+  // A small response is parsed on the client's queue rather than on the
+  // service's own queue for small responses.
+  GTLService *service = [[[GTLService alloc] init] autorelease];
+  service.allowInsecureQueries = YES;
+  NSOperationQueue *parseQueue = [[[NSOperationQueue alloc] init] autorelease];
+  [parseQueue setSuspended:YES];
+  service.parseQueue = parseQueue;
+
+  NSURL *feedURL = [testServer_ localURLForFile:kRESTValidFileName];
+  GTLServiceTicket *ticket =
+    [service fetchObjectWithURL:feedURL
+              completionHandler:^(GTLServiceTicket *ticket, id object, NSError *error) {
+      GTLTasksTasks *feed = object;
+      XCTAssertNil(error);
+      XCTAssertEqual(feed.items.count, (NSUInteger) 2);
+    }];
+
+  // The parse waits on the suspended queue.
+  NSDate *giveUpDate = [NSDate dateWithTimeIntervalSinceNow:kTimeoutInterval];
+  while (parseQueue.operationCount == 0 && [giveUpDate timeIntervalSinceNow] > 0) {
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+  }
+  XCTAssertEqual(parseQueue.operationCount, (NSUInteger) 1);
+  XCTAssertFalse(ticket.hasCalledCallback);
+
+  [parseQueue setSuspended:NO];
+  [self service:service waitForTicket:ticket];
+  XCTAssertTrue(ticket.hasCalledCallback);
+}
+
+- (void)testServiceRESTIncrementalParseFetch {
+
+  if (!isServerRunning_) return;
+
+  GTLService *service = [[[GTLService alloc] init] autorelease];
+  service.allowInsecureQueries = YES;
+  service.shouldParseIncrementally = YES;
+
+  GTLServiceCompletionHandler completionBlock;
+  GTLServiceTicket *ticket;
+  NSURL *feedURL;
+
+  //
+  // test:  download feed, parsing as it arrives
+  //
+
+  feedURL = [testServer_ localURLForFile:kRESTValidFileName];
+  completionBlock = ^(GTLServiceTicket *ticket, id object, NSError *error) {
+    GTLTasksTasks *feed = object;
+
+    XCTAssertNil(error);
+    XCTAssertEqual(feed.items.count, (NSUInteger) 2);
+
+    GTLTasksTask *item = feed[0];
+    XCTAssertEqualObjects(item.updated.RFC3339String, @"2011-04-29T22:14:47.779Z");
+    XCTAssertEqualObjects(item.title, @"task one");
+
+    // the fetcher should not have kept a copy of the response
+    XCTAssertEqual(ticket.objectFetcher.downloadedData.length, (NSUInteger) 0);
+  };
+
+  ticket = [service fetchObjectWithURL:feedURL
+                     completionHandler:completionBlock];
+  [self service:service waitForTicket:ticket];
+  XCTAssertTrue(ticket.hasCalledCallback);
+
+  //
+  // test fetch error; the error body is still parsed into a structured error
+  //
+  feedURL = [testServer_ localURLForFile:kRESTErrorFileName];
+
+  completionBlock = ^(GTLServiceTicket *ticket, id object, NSError *error) {
+    NSDictionary *userInfo = [error userInfo];
+    GTLErrorObject *errObj = userInfo[kGTLStructuredErrorKey];
+
+    XCTAssertNil(object);
+    XCTAssertEqualObjects(errObj.message, @"Server Status 499");
+    XCTAssertEqual([errObj.code intValue], 499);
+
+    // the fetcher keeps the error body, for the fetcher service's throttle check
+    XCTAssertTrue(ticket.objectFetcher.downloadedData.length > 0);
+  };
+
+  ticket = [service fetchObjectWithURL:feedURL
+                     completionHandler:completionBlock];
+  [self service:service waitForTicket:ticket];
+  XCTAssertTrue(ticket.hasCalledCallback);
+
+  XCTAssertEqual(parseStartedCount_, 1);
+}
+
+- (void)testServiceRESTIncrementalParseWithETagCache {
+
+  if (!isServerRunning_) return;
+
+  GTLService *service = [[[GTLService alloc] init] autorelease];
+  service.allowInsecureQueries = YES;
+  service.fetcherService.fetchHistory.shouldCacheETaggedData = YES;
+
+  NSURL *feedURL = [testServer_ localURLForFile:kRESTValidFileName];
+  GTLServiceCompletionHandler completionBlock =
+    ^(GTLServiceTicket *ticket, id object, NSError *error) {
+      GTLTasksTasks *feed = object;
+      XCTAssertNil(error);
+      XCTAssertEqual(feed.items.count, (NSUInteger) 2);
+      XCTAssertEqualObjects([feed[0] title], @"task one");
+    };
+
+  // The first fetch leaves its ETag and data in the fetch history
+  GTLServiceTicket *ticket1 = [service fetchObjectWithURL:feedURL
+                                        completionHandler:completionBlock];
+  [self service:service waitForTicket:ticket1];
+  XCTAssertTrue(ticket1.hasCalledCallback);
+  XCTAssertEqual(ticket1.statusCode, (NSInteger) 200);
+
+  // A streamed fetch doesn't send the remembered ETag, so it gets the data
+  // rather than a Not Modified status
+  service.shouldParseIncrementally = YES;
+  GTLServiceTicket *ticket2 = [service fetchObjectWithURL:feedURL
+                                        completionHandler:completionBlock];
+  [self service:service waitForTicket:ticket2];
+  XCTAssertTrue(ticket2.hasCalledCallback);
+  XCTAssertEqual(ticket2.statusCode, (NSInteger) 200);
+  XCTAssertTrue(ticket2.parseTime > 0);
+
+  // The streamed fetch cleared the history for the URL, so the next fetch
+  // is not conditional either
+  service.shouldParseIncrementally = NO;
+  GTLServiceTicket *ticket3 = [service fetchObjectWithURL:feedURL
+                                        completionHandler:completionBlock];
+  [self service:service waitForTicket:ticket3];
+  XCTAssertTrue(ticket3.hasCalledCallback);
+  XCTAssertEqual(ticket3.statusCode, (NSInteger) 200);
+  XCTAssertTrue(ticket3.parseTime > 0);
+}
+
+- (void)testServiceRESTNotModifiedFetch {
+
+  if (!isServerRunning_) return;
+
+  GTLService *service = [[[GTLService alloc] init] autorelease];
+  service.allowInsecureQueries = YES;
+  service.fetcherService.fetchHistory.shouldCacheETaggedData = YES;
+  XCTAssertEqual(service.parsedObjectCacheCapacity, (NSUInteger) 20);
+
+  NSURL *feedURL = [testServer_ localURLForFile:kRESTValidFileName];
+  GTLServiceCompletionHandler completionBlock =
+    ^(GTLServiceTicket *ticket, id object, NSError *error) {
+      GTLTasksTasks *feed = object;
+      XCTAssertNil(error);
+      XCTAssertEqual(feed.items.count, (NSUInteger) 2);
+      XCTAssertEqualObjects([feed[0] title], @"task one");
+    };
+
+  // The first fetch is parsed, and the object kept
+  GTLServiceTicket *ticket1 = [service fetchObjectWithURL:feedURL
+                                        completionHandler:completionBlock];
+  [self service:service waitForTicket:ticket1];
+  XCTAssertTrue(ticket1.hasCalledCallback);
+  XCTAssertEqual(ticket1.statusCode, (NSInteger) 200);
+  XCTAssertTrue(ticket1.parseTime > 0);
+  GTLTasksTasks *feed1 = (GTLTasksTasks *)ticket1.fetchedObject;
+
+  // Changes to the first object don't reach the kept one
+  [feed1[0] setTitle:@"changed"];
+
+  // The repeated fetch is Not Modified, and gets a copy of the kept object
+  GTLServiceTicket *ticket2 = [service fetchObjectWithURL:feedURL
+                                        completionHandler:completionBlock];
+  [self service:service waitForTicket:ticket2];
+  XCTAssertTrue(ticket2.hasCalledCallback);
+  XCTAssertEqual(ticket2.statusCode, (NSInteger) 304);
+  XCTAssertEqual(ticket2.parseTime, 0.0);
+  GTLTasksTasks *feed2 = (GTLTasksTasks *)ticket2.fetchedObject;
+  XCTAssertTrue([feed2 isKindOfClass:[GTLTasksTasks class]]);
+  XCTAssertFalse(feed2 == feed1);
+  XCTAssertEqualObjects([feed2[0] title], @"task one");
+
+  // Without the cache, the data is parsed again
+  service.parsedObjectCacheCapacity = 0;
+  GTLServiceTicket *ticket3 = [service fetchObjectWithURL:feedURL
+                                        completionHandler:completionBlock];
+  [self service:service waitForTicket:ticket3];
+  XCTAssertTrue(ticket3.hasCalledCallback);
+  XCTAssertTrue(ticket3.parseTime > 0);
+}
+
+- (void)testServiceRPCRepeatedQueryNotCached {
+
+  if (!isServerRunning_) return;
+
+  GTLService *service = [[[GTLService alloc] init] autorelease];
+  service.rpcURL = [testServer_ localURLForFile:kRPCValidName];
+  service.apiVersion = @"v1";
+  service.allowInsecureQueries = YES;
+  service.fetcherService.fetchHistory.shouldCacheETaggedData = YES;
+
+  GTLServiceCompletionHandler completionBlock =
+    ^(GTLServiceTicket *ticket, id object, NSError *error) {
+      GTLTasksTasks *tasks = object;
+      XCTAssertNil(error);
+      XCTAssertEqual(tasks.items.count, (NSUInteger) 2);
+      XCTAssertEqualObjects([tasks[0] title], @"task one");
+    };
+
+  GTLQueryTasksTest *query =
+      [GTLQueryTasksTest queryForTasksListWithTasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"];
+  query.showCompleted = YES;
+  query.showHidden = NO;
+  query.showDeleted = NO;
+  query.requestID = @"gtl_12";
+
+  // RPC queries are posted, so the repeated query is not Not Modified, and
+  // each response is parsed
+  GTLServiceTicket *ticket1 = [service executeQuery:query
+                                  completionHandler:completionBlock];
+  [self service:service waitForTicket:ticket1];
+  XCTAssertTrue(ticket1.hasCalledCallback);
+  XCTAssertEqual(ticket1.statusCode, (NSInteger) 200);
+  XCTAssertTrue(ticket1.parseTime > 0);
+
+  GTLServiceTicket *ticket2 = [service executeQuery:query
+                                  completionHandler:completionBlock];
+  [self service:service waitForTicket:ticket2];
+  XCTAssertTrue(ticket2.hasCalledCallback);
+  XCTAssertEqual(ticket2.statusCode, (NSInteger) 200);
+  XCTAssertTrue(ticket2.parseTime > 0);
+  XCTAssertFalse(ticket2.fetchedObject == ticket1.fetchedObject);
+}
+
+- (void)testPrepareObjectClasses {
+  // Getters and setters for name and count, and a getter for labels
+  NSUInteger numberAdded = [GTLPreparedTestService prepareObjectClasses];
+  XCTAssertEqual(numberAdded, (NSUInteger)5);
+
+  // The methods are now present without being resolved at runtime
+  Class objClass = [GTLPreparedTestObject class];
+  XCTAssertTrue(class_getInstanceMethod(objClass, @selector(name)) != NULL);
+  XCTAssertTrue(class_getInstanceMethod(objClass, @selector(setCount:)) != NULL);
+  XCTAssertTrue(class_getInstanceMethod(objClass, @selector(labels)) != NULL);
+
+  // Preparing again adds nothing
+  XCTAssertEqual([GTLPreparedTestService prepareObjectClasses], (NSUInteger)0);
+
+  GTLPreparedTestObject *obj = [GTLPreparedTestObject object];
+  obj.name = @"prepared";
+  obj.count = @3;
+  [obj setJSONValue:@[ @"a", @"b" ] forKey:@"labels"];
+  XCTAssertEqualObjects(obj.JSON, (@{ @"name" : @"prepared",
+                                      @"count" : @3,
+                                      @"labels" : @[ @"a", @"b" ] }));
+  XCTAssertEqualObjects(obj.labels, (@[ @"a", @"b" ]));
+
+  // The base class has no classes to prepare
+  XCTAssertEqual([GTLService prepareObjectClasses], (NSUInteger)0);
+}
+
 - (void)testServiceRPCFetch {
 
   // test:  fetch single query, with valid authorization
@@ -591,6 +914,110 @@ static NSString *const kBatchRPCPageBName = @"TaskBatchPage1b.rpc";
   XCTAssertTrue(ticket.hasCalledCallback);
 }
 
+- (void)testServiceRPCPagedFetchLimit {
+
+  // Test that the service's page limit is copied to the ticket, and that
+  // pages within the limit are all fetched
+  //
+  // tests for files "TaskPage1a.request.txt" and "TaskPage1a.response.txt"
+  //   and for the page 1b versions
+
+  if (!isServerRunning_) return;
+
+  GTLService *service = [[[GTLService alloc] init] autorelease];
+  service.rpcURL = [testServer_ localURLForFile:kRPCPageAName];
+  service.apiVersion = @"v1";
+  service.shouldFetchNextPages = YES;
+  service.allowInsecureQueries = YES;
+  XCTAssertEqual(service.maxNumberOfNextPagesFetched, (NSUInteger) 25);
+
+  service.maxNumberOfNextPagesFetched = 1;
+
+  GTLQueryTasksTest *query = [GTLQueryTasksTest queryForTasksListWithTasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"];
+  query.requestID = @"gtl_17";
+  query.maxResults = 2;
+
+  GTLServiceTicket *ticket = [service executeQuery:query
+                                 completionHandler:^(GTLServiceTicket *callbackTicket, id object, NSError *error) {
+    GTLTasksTasks *tasks = object;
+
+    XCTAssertNil(error);
+
+    // both pages' items are present
+    XCTAssertEqual(tasks.items.count, (NSUInteger) 4);
+    XCTAssertEqualObjects([tasks[3] title], @"task four");
+    XCTAssertEqual(callbackTicket.pagesFetchedCounter, (NSUInteger) 1);
+  }];
+  XCTAssertEqual(ticket.maxNumberOfNextPagesFetched, (NSUInteger) 1);
+
+  service.rpcURL = [testServer_ localURLForFile:kRPCPageBName];
+
+  [self service:service waitForTicket:ticket];
+  XCTAssertTrue(ticket.hasCalledCallback);
+}
+
+- (void)testServiceRPCStreamedPages {
+
+  // Test delivering each page to a page block, fetching the next page only
+  // when the block continues
+  //
+  // tests for files "TaskPage1a.request.txt" and "TaskPage1a.response.txt"
+  //   and for the page 1b versions
+
+  if (!isServerRunning_) return;
+
+  GTLService *service = [[[GTLService alloc] init] autorelease];
+  service.rpcURL = [testServer_ localURLForFile:kRPCPageAName];
+  service.apiVersion = @"v1";
+  service.allowInsecureQueries = YES;
+
+  NSMutableArray *titles = [NSMutableArray array];
+  __block NSUInteger numberOfPages = 0;
+
+  service.pageBlock = ^(GTLServiceTicket *ticket, id page, BOOL isLastPage,
+                        GTLServicePageContinuation continuation) {
+    GTLTasksTasks *tasks = page;
+    XCTAssertEqual(tasks.items.count, (NSUInteger) 2);
+    for (GTLTasksTask *task in tasks) {
+      [titles addObject:task.title];
+    }
+    ++numberOfPages;
+    XCTAssertEqual(isLastPage, (BOOL)(numberOfPages == 2));
+    XCTAssertFalse(ticket.hasCalledCallback);
+
+    // Continue later, as a consumer applying backpressure would
+    dispatch_async(dispatch_get_main_queue(), ^{
+      continuation(YES);
+    });
+  };
+
+  GTLQueryTasksTest *query = [GTLQueryTasksTest queryForTasksListWithTasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"];
+  query.requestID = @"gtl_17";
+  query.maxResults = 2;
+
+  GTLServiceTicket *ticket = [service executeQuery:query
+                                 completionHandler:^(GTLServiceTicket *callbackTicket, id object, NSError *error) {
+    GTLTasksTasks *tasks = object;
+
+    XCTAssertNil(error);
+
+    // The callback gets only the final page
+    XCTAssertEqual(tasks.items.count, (NSUInteger) 2);
+    XCTAssertEqualObjects([tasks[0] title], @"task three");
+  }];
+
+  // The second page comes from the page B file
+  service.rpcURL = [testServer_ localURLForFile:kRPCPageBName];
+
+  [self service:service waitForTicket:ticket];
+  XCTAssertTrue(ticket.hasCalledCallback);
+  XCTAssertNil(ticket.pageBlock);
+
+  XCTAssertEqual(numberOfPages, (NSUInteger) 2);
+  NSArray *expected = @[ @"task one", @"task two", @"task three", @"task four" ];
+  XCTAssertEqualObjects(titles, expected);
+}
+
 - (void)testServiceRPCBatchFetch {
   
   // test:  fetch query batch
@@ -700,6 +1127,482 @@ static NSString *const kBatchRPCPageBName = @"TaskBatchPage1b.rpc";
   XCTAssertNil(query2.completionBlock, @"Query callback not cleared");
 }
 
+- (void)testServiceRPCCoalescedFetch {
+
+  // test:  queries executed separately within the coalescing interval are
+  // sent as one batch
+  //
+  // tests for files "TaskBatch1.request.txt" and "TaskBatch1.response.txt"
+
+  if (!isServerRunning_) return;
+
+  GTLService *service = [[[GTLService alloc] init] autorelease];
+  service.rpcURL = [testServer_ localURLForFile:kBatchRPCName];
+  service.apiVersion = @"v1";
+  service.allowInsecureQueries = YES;
+  service.coalescingInterval = 0.05;
+
+  GTLTasksTask *task1 = [GTLTasksTask object];
+  task1.identifier = @"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDox";
+  task1.status = @"needsAction";
+  task1.title = @"task one";
+  GTLQueryTasksTest *query1 = [GTLQueryTasksTest queryForTasksUpdateWithObject:task1
+                                                                      tasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"
+                                                                          task:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDox"];
+  query1.requestID = @"gtl_19";
+
+  GTLTasksTask *task2 = [GTLTasksTask object];
+  task2.status = @"needsAction";
+  task2.title = @"task two";
+  task2.identifier = @"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDoy";
+  GTLQueryTasksTest *query2 = [GTLQueryTasksTest queryForTasksUpdateWithObject:task2
+                                                                      tasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"
+                                                                          task:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDoy"];
+  query2.requestID = @"gtl_18";
+
+  GTLQueryTasksTest *query3 = [GTLQueryTasksTest queryForTasksDeleteWithTasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"
+                                                                            task:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDoz"];
+  query3.requestID = @"gtl_20";
+
+  __block NSUInteger numberOfQueryCallbacks = 0;
+  query2.completionBlock = ^(GTLServiceTicket *ticket, id object, NSError *error) {
+    ++numberOfQueryCallbacks;
+  };
+
+  GTLServiceTicket *ticket1 = [service executeQuery:query1
+                                  completionHandler:^(GTLServiceTicket *ticket, id object, NSError *error) {
+    XCTAssertNil(error);
+    XCTAssertEqualObjects([object identifier], @"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDox");
+    XCTAssertEqualObjects(ticket.fetchedObject, object);
+  }];
+  GTLServiceTicket *ticket2 = [service executeQuery:query2
+                                  completionHandler:^(GTLServiceTicket *ticket, id object, NSError *error) {
+    XCTAssertNil(object);
+    GTLErrorObject *errorObj = [[error userInfo] objectForKey:kGTLStructuredErrorKey];
+    XCTAssertEqual(errorObj.code.intValue, 400);
+  }];
+  GTLServiceTicket *ticket3 = [service executeQuery:query3
+                                  completionHandler:^(GTLServiceTicket *ticket, id object, NSError *error) {
+    XCTAssertNil(error);
+    XCTAssertEqual(object, [NSNull null]);
+  }];
+
+  // The queries are waiting to be sent together
+  XCTAssertNotNil(ticket1);
+  XCTAssertNil(ticket1.objectFetcher);
+  XCTAssertNotEqual(ticket1, ticket2);
+
+  [self service:service waitForTicket:ticket1];
+  [self service:service waitForTicket:ticket2];
+  [self service:service waitForTicket:ticket3];
+  XCTAssertTrue(ticket1.hasCalledCallback);
+  XCTAssertTrue(ticket2.hasCalledCallback);
+  XCTAssertTrue(ticket3.hasCalledCallback);
+  XCTAssertEqual(numberOfQueryCallbacks, (NSUInteger) 1);
+
+  // A held query canceled from another thread is dropped, and nothing is sent
+  // when the interval ends
+  int parseCount = parseStartedCount_;
+  GTLServiceTicket *ticket4 = [service executeQuery:query3
+                                  completionHandler:^(GTLServiceTicket *ticket, id object, NSError *error) {
+    XCTFail(@"canceled query called back");
+  }];
+  dispatch_sync(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    [ticket4 cancelTicket];
+  });
+  [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.2]];
+  XCTAssertFalse(ticket4.hasCalledCallback);
+  XCTAssertEqual(parseStartedCount_, parseCount);
+}
+
+- (void)testServiceRPCSharedFetch {
+
+  // test:  identical queries executed while one is in flight share its fetch,
+  // and each ticket gets its own copy of the result
+  //
+  // tests for files "Task1.request.txt" and "Task1.response.txt"
+
+  if (!isServerRunning_) return;
+
+  GTLService *service = [[[GTLService alloc] init] autorelease];
+  service.rpcURL = [testServer_ localURLForFile:kRPCValidName];
+  service.apiVersion = @"v1";
+  service.allowInsecureQueries = YES;
+  service.shouldShareIdenticalQueries = YES;
+
+  GTLQueryTasksTest *query =
+      [GTLQueryTasksTest queryForTasksListWithTasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"];
+  query.showCompleted = YES;
+  query.showHidden = NO;
+  query.showDeleted = NO;
+  query.requestID = @"gtl_12";
+  query.canShareFetch = YES;
+
+  __block NSUInteger numberOfQueryCallbacks = 0;
+  query.completionBlock = ^(GTLServiceTicket *ticket, id object, NSError *error) {
+    ++numberOfQueryCallbacks;
+  };
+
+  GTLServiceCompletionHandler completionBlock = ^(GTLServiceTicket *ticket,
+                                                  id object, NSError *error) {
+    XCTAssertNil(error);
+    GTLTasksTasks *tasks = object;
+    XCTAssertEqual(tasks.items.count, (NSUInteger) 2);
+    XCTAssertEqual(ticket.fetchedObject, object);
+  };
+
+  GTLServiceTicket *ticket1 = [service executeQuery:query
+                                  completionHandler:completionBlock];
+  GTLServiceTicket *ticket2 = [service executeQuery:query
+                                  completionHandler:completionBlock];
+  GTLServiceTicket *ticket3 = [service executeQuery:query
+                                  completionHandler:completionBlock];
+  XCTAssertNotNil(ticket1);
+  XCTAssertNil(ticket1.objectFetcher);
+  XCTAssertNotEqual(ticket1, ticket2);
+
+  // Leaving does not stop the fetch for the tickets still waiting
+  [ticket3 cancelTicket];
+
+  [self service:service waitForTicket:ticket1];
+  [self service:service waitForTicket:ticket2];
+  XCTAssertTrue(ticket1.hasCalledCallback);
+  XCTAssertTrue(ticket2.hasCalledCallback);
+  XCTAssertFalse(ticket3.hasCalledCallback);
+  XCTAssertEqual(numberOfQueryCallbacks, (NSUInteger) 2);
+  XCTAssertEqual(parseStartedCount_, 1);
+
+  XCTAssertNotEqual(ticket1.fetchedObject, ticket2.fetchedObject);
+  XCTAssertEqualObjects(ticket1.fetchedObject, ticket2.fetchedObject);
+
+  //
+  // test: the fetch is stopped when every waiting ticket is canceled
+  //
+
+  GTLServiceTicket *ticket4 = [service executeQuery:query
+                                  completionHandler:completionBlock];
+  GTLServiceTicket *ticket5 = [service executeQuery:query
+                                  completionHandler:completionBlock];
+  [ticket4 cancelTicket];
+  [ticket5 cancelTicket];
+
+  // A query executed afterwards starts a fetch of its own
+  GTLServiceTicket *ticket6 = [service executeQuery:query
+                                  completionHandler:completionBlock];
+  [self service:service waitForTicket:ticket6];
+  XCTAssertTrue(ticket6.hasCalledCallback);
+  XCTAssertFalse(ticket4.hasCalledCallback);
+  XCTAssertFalse(ticket5.hasCalledCallback);
+  XCTAssertEqual(numberOfQueryCallbacks, (NSUInteger) 3);
+  XCTAssertEqual(parseStartedCount_, 2);
+
+  //
+  // test: a query not marked as free of side effects always fetches
+  //
+
+  query.canShareFetch = NO;
+  GTLServiceTicket *ticket7 = [service executeQuery:query
+                                  completionHandler:completionBlock];
+  GTLServiceTicket *ticket8 = [service executeQuery:query
+                                  completionHandler:completionBlock];
+  XCTAssertNotNil(ticket7.objectFetcher);
+  XCTAssertNotNil(ticket8.objectFetcher);
+  [self service:service waitForTicket:ticket7];
+  [self service:service waitForTicket:ticket8];
+  XCTAssertEqual(numberOfQueryCallbacks, (NSUInteger) 5);
+  XCTAssertEqual(parseStartedCount_, 4);
+}
+
+- (void)testServiceRPCFetcherServiceClient {
+
+  // test:  the service's fetcher service client and priority are given to the
+  // ticket and its fetcher, and a query's own replace them
+  //
+  // tests for files "Task1.request.txt" and "Task1.response.txt"
+
+  if (!isServerRunning_) return;
+
+  GTLService *service = [[[GTLService alloc] init] autorelease];
+  service.rpcURL = [testServer_ localURLForFile:kRPCValidName];
+  service.apiVersion = @"v1";
+  service.allowInsecureQueries = YES;
+  service.fetcherServiceClient = @"background";
+  service.fetcherServicePriority = 1;
+
+  GTLServiceCompletionHandler completionBlock = ^(GTLServiceTicket *ticket,
+                                                  id object, NSError *error) {
+    GTLTasksTasks *tasks = object;
+    XCTAssertNil(error);
+    XCTAssertEqual(tasks.items.count, (NSUInteger) 2);
+  };
+
+  GTLQueryTasksTest *query =
+      [GTLQueryTasksTest queryForTasksListWithTasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"];
+  query.showCompleted = YES;
+  query.showHidden = NO;
+  query.showDeleted = NO;
+  query.requestID = @"gtl_12";
+
+  GTLServiceTicket *ticket = [service executeQuery:query
+                                 completionHandler:completionBlock];
+  XCTAssertEqualObjects(ticket.fetcherServiceClient, @"background");
+  XCTAssertEqual(ticket.fetcherServicePriority, (NSInteger) 1);
+#if !GTL_USE_SESSION_FETCHER
+  XCTAssertEqualObjects(ticket.objectFetcher.serviceClient, @"background");
+  XCTAssertEqual(ticket.objectFetcher.servicePriority, (NSInteger) 1);
+#endif
+  [self service:service waitForTicket:ticket];
+  XCTAssertTrue(ticket.hasCalledCallback);
+
+  query = [GTLQueryTasksTest queryForTasksListWithTasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"];
+  query.showCompleted = YES;
+  query.showHidden = NO;
+  query.showDeleted = NO;
+  query.requestID = @"gtl_12";
+  query.fetcherServiceClient = @"interactive";
+  query.fetcherServicePriority = -1;
+
+  ticket = [service executeQuery:query
+               completionHandler:completionBlock];
+  XCTAssertEqualObjects(ticket.fetcherServiceClient, @"interactive");
+  XCTAssertEqual(ticket.fetcherServicePriority, (NSInteger) -1);
+#if !GTL_USE_SESSION_FETCHER
+  XCTAssertEqualObjects(ticket.objectFetcher.serviceClient, @"interactive");
+  XCTAssertEqual(ticket.objectFetcher.servicePriority, (NSInteger) -1);
+#endif
+  [self service:service waitForTicket:ticket];
+  XCTAssertTrue(ticket.hasCalledCallback);
+}
+
+- (void)testServiceRPCRateLimitedFetch {
+
+  // test:  queries over the rate limiter's budget are held, and services
+  // sharing a rate limiter share its budget
+  //
+  // tests for files "Task1.request.txt" and "Task1.response.txt"
+
+  if (!isServerRunning_) return;
+
+  GTLServiceRateLimiter *rateLimiter = [GTLServiceRateLimiter rateLimiter];
+  [rateLimiter setRate:10 burst:2 forMethodName:@"tasks.tasks.list"];
+
+  GTLService *service1 = [[[GTLService alloc] init] autorelease];
+  GTLService *service2 = [[[GTLService alloc] init] autorelease];
+  for (GTLService *service in @[ service1, service2 ]) {
+    service.rpcURL = [testServer_ localURLForFile:kRPCValidName];
+    service.apiVersion = @"v1";
+    service.allowInsecureQueries = YES;
+    service.rateLimiter = rateLimiter;
+  }
+
+  GTLQueryTasksTest *query =
+      [GTLQueryTasksTest queryForTasksListWithTasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"];
+  query.showCompleted = YES;
+  query.showHidden = NO;
+  query.showDeleted = NO;
+  query.requestID = @"gtl_12";
+
+  GTLServiceCompletionHandler completionBlock = ^(GTLServiceTicket *ticket,
+                                                  id object, NSError *error) {
+    XCTAssertNil(error);
+    GTLTasksTasks *tasks = object;
+    XCTAssertEqual(tasks.items.count, (NSUInteger) 2);
+  };
+
+  NSDate *startDate = [NSDate date];
+
+  // The burst is sent at once, and the queries after it are spaced out
+  GTLServiceTicket *ticket1 = [service1 executeQuery:query
+                                   completionHandler:completionBlock];
+  GTLServiceTicket *ticket2 = [service2 executeQuery:query
+                                   completionHandler:completionBlock];
+  GTLServiceTicket *ticket3 = [service1 executeQuery:query
+                                   completionHandler:completionBlock];
+  GTLServiceTicket *ticket4 = [service2 executeQuery:query
+                                   completionHandler:completionBlock];
+  GTLServiceTicket *ticket5 = [service1 executeQuery:query
+                                   completionHandler:completionBlock];
+
+  XCTAssertEqual(ticket1.rateLimitDelay, 0.0);
+  XCTAssertEqual(ticket2.rateLimitDelay, 0.0);
+  XCTAssertEqualWithAccuracy(ticket3.rateLimitDelay, 0.1, 0.05);
+  XCTAssertEqualWithAccuracy(ticket4.rateLimitDelay, 0.2, 0.05);
+  XCTAssertEqualWithAccuracy(ticket5.rateLimitDelay, 0.3, 0.05);
+  XCTAssertNotNil(ticket3.objectFetcher);
+  XCTAssertFalse(ticket3.objectFetcher.isFetching);
+
+  // A held query that is canceled is never sent
+  [ticket4 cancelTicket];
+
+  [self service:service1 waitForTicket:ticket1];
+  [self service:service2 waitForTicket:ticket2];
+  [self service:service1 waitForTicket:ticket3];
+  [self service:service1 waitForTicket:ticket5];
+  XCTAssertTrue(ticket1.hasCalledCallback);
+  XCTAssertTrue(ticket2.hasCalledCallback);
+  XCTAssertTrue(ticket3.hasCalledCallback);
+  XCTAssertFalse(ticket4.hasCalledCallback);
+  XCTAssertTrue(ticket5.hasCalledCallback);
+  XCTAssertGreaterThanOrEqual(-startDate.timeIntervalSinceNow, 0.25);
+
+  // Other methods are not limited
+  GTLQueryTasksTest *getQuery =
+      [GTLQueryTasksTest queryForTasksGetWithTasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"
+                                                 task:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDox"];
+  GTLServiceTicket *getTicket = [service1 executeQuery:getQuery
+                                     completionHandler:nil];
+  XCTAssertEqual(getTicket.rateLimitDelay, 0.0);
+  [getTicket cancelTicket];
+}
+
+- (void)testServiceRPCShardedBatchFailure {
+
+  // test:  a batch split into shards reports one result to each query's
+  // completion block and to the ticket, even when every shard fails
+  //
+  // there is no file for this batch, so each shard's fetch fails with a 404
+
+  if (!isServerRunning_) return;
+
+  GTLService *service = [[[GTLService alloc] init] autorelease];
+  service.rpcURL = [testServer_ localURLForFile:@"TaskBatchShards.rpc"];
+  service.apiVersion = @"v1";
+  service.allowInsecureQueries = YES;
+  service.maxQueriesPerBatch = 2;
+
+  GTLBatchQuery *batchQuery = [GTLBatchQuery batchQuery];
+  __block NSUInteger numberOfQueryCallbacks = 0;
+  for (int idx = 0; idx < 5; idx++) {
+    GTLQueryTasksTest *query = [GTLQueryTasksTest queryForTasksGetWithTasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"
+                                                                          task:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDox"];
+    query.completionBlock = ^(GTLServiceTicket *ticket, id object, NSError *error) {
+      XCTAssertNil(object);
+      XCTAssertNotNil(error);
+      ++numberOfQueryCallbacks;
+    };
+    [batchQuery addQuery:query];
+  }
+
+  GTLServiceTicket *ticket = [service executeQuery:batchQuery
+                                 completionHandler:^(GTLServiceTicket *callbackTicket, id object, NSError *error) {
+    XCTAssertNil(object);
+    XCTAssertNotNil(error);
+  }];
+  XCTAssertNotNil(ticket);
+  XCTAssertEqual(ticket.originalQuery, batchQuery);
+
+  [self service:service waitForTicket:ticket];
+  XCTAssertTrue(ticket.hasCalledCallback);
+  XCTAssertEqual(numberOfQueryCallbacks, (NSUInteger) 5);
+  XCTAssertNil([batchQuery.queries[0] completionBlock], @"Query callback not cleared");
+
+  // Canceling the ticket of a split batch stops the fetches of its shards
+  GTLBatchQuery *canceledQuery = [GTLBatchQuery batchQuery];
+  for (int idx = 0; idx < 5; idx++) {
+    GTLQueryTasksTest *query = [GTLQueryTasksTest queryForTasksGetWithTasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"
+                                                                          task:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDox"];
+    query.completionBlock = ^(GTLServiceTicket *ticket, id object, NSError *error) {
+      XCTFail(@"canceled shard called back");
+    };
+    [canceledQuery addQuery:query];
+  }
+  int parseCount = parseStartedCount_;
+  GTLServiceTicket *canceledTicket = [service executeQuery:canceledQuery
+                                         completionHandler:^(GTLServiceTicket *callbackTicket, id object, NSError *error) {
+    XCTFail(@"canceled batch called back");
+  }];
+  XCTAssertNotNil(canceledTicket);
+  [canceledTicket cancelTicket];
+  [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.2]];
+  XCTAssertFalse(canceledTicket.hasCalledCallback);
+  XCTAssertEqual(parseStartedCount_, parseCount);
+}
+
+- (void)testServiceRPCShardedBatchRetry {
+
+  // test:  a shard of a split batch that fails with a server error is sent
+  // again after a delay, and its results are merged with the other shard's
+  //
+  // the first shard is the batch of "TaskBatch1.request.txt"; the second
+  // shard has no file, so its fetch fails with a 404 and is not retried
+
+  if (!isServerRunning_) return;
+
+  NSURL *batchURL = [testServer_ localURLForFile:kBatchRPCName];
+  NSURL *unavailableURL =
+    [NSURL URLWithString:[batchURL.absoluteString stringByAppendingString:@"?status=503"]];
+
+  GTLChangingURLTestService *service = [[[GTLChangingURLTestService alloc] init] autorelease];
+  service.rpcURLs = [NSMutableArray arrayWithObjects:unavailableURL, batchURL, nil];
+  service.apiVersion = @"v1";
+  service.allowInsecureQueries = YES;
+  service.maxQueriesPerBatch = 3;
+
+  GTLTasksTask *task1 = [GTLTasksTask object];
+  task1.identifier = @"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDox";
+  task1.status = @"needsAction";
+  task1.title = @"task one";
+  GTLQueryTasksTest *query1 = [GTLQueryTasksTest queryForTasksUpdateWithObject:task1
+                                                                      tasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"
+                                                                          task:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDox"];
+  query1.requestID = @"gtl_19";
+
+  GTLTasksTask *task2 = [GTLTasksTask object];
+  task2.status = @"needsAction";
+  task2.title = @"task two";
+  task2.identifier = @"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDoy";
+  GTLQueryTasksTest *query2 = [GTLQueryTasksTest queryForTasksUpdateWithObject:task2
+                                                                      tasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"
+                                                                          task:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDoy"];
+  query2.requestID = @"gtl_18";
+
+  GTLQueryTasksTest *query3 = [GTLQueryTasksTest queryForTasksDeleteWithTasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"
+                                                                            task:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDoz"];
+  query3.requestID = @"gtl_20";
+
+  GTLQueryTasksTest *query4 = [GTLQueryTasksTest queryForTasksGetWithTasklist:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDow"
+                                                                         task:@"MDg0NTg2OTA1ODg4OTI3MzgyMzQ6NDo0"];
+  query4.requestID = @"gtl_21";
+
+  GTLBatchQuery *batchQuery = [GTLBatchQuery batchQuery];
+  [batchQuery addQuery:query1];
+  [batchQuery addQuery:query2];
+  [batchQuery addQuery:query3];
+  [batchQuery addQuery:query4];
+
+  GTLServiceCompletionHandler completionBlock = ^(GTLServiceTicket *ticket,
+                                                  id object, NSError *error) {
+    GTLBatchResult *batchResult = object;
+    XCTAssertNil(error);
+
+    // the retried shard's results
+    NSDictionary *successes = batchResult.successes;
+    XCTAssertEqual(successes.count, (NSUInteger) 2);
+    XCTAssertEqualObjects([successes[@"gtl_19"] title], @"task one");
+
+    NSDictionary *failures = batchResult.failures;
+    XCTAssertEqual(failures.count, (NSUInteger) 2);
+    GTLErrorObject *errorObj = failures[@"gtl_18"];
+    XCTAssertEqual(errorObj.code.intValue, 400);
+
+    // the failed shard's error, with its domain
+    errorObj = failures[@"gtl_21"];
+    XCTAssertEqual(errorObj.code.intValue, 404);
+    GTLErrorObjectData *errData = errorObj.data.lastObject;
+    XCTAssertNotNil(errData.domain);
+  };
+
+  NSDate *startDate = [NSDate date];
+  GTLServiceTicket *ticket = [service executeQuery:batchQuery
+                                 completionHandler:completionBlock];
+  [self service:service waitForTicket:ticket];
+  XCTAssertTrue(ticket.hasCalledCallback);
+
+  // the retry waited before sending the shard again
+  XCTAssertTrue([[NSDate date] timeIntervalSinceDate:startDate] >= 0.5);
+  XCTAssertEqual(service.rpcURLs.count, (NSUInteger) 1);
+}
+
 - (void)testServiceRPCPagedBatchFetch {
   // Test token-based paging on queries in a batch fetch
   //
@@ -16,6 +16,7 @@
 #import <XCTest/XCTest.h>
 
 #import "GTLUtilities.h"
+#import "GTLJSONParser.h"
 
 @interface GTLUtilitiesTest : XCTestCase
 @end
@@ -213,6 +214,525 @@
   }
 }
 
+- (void)testJSONStreamParser {
+  NSString *jsonStr = @"{\"kind\":\"tasks#tasks\", \"count\": 12345,"
+    @" \"ratio\": -1.5e3, \"items\": [ {\"title\": \"t\\u00e8sk \\\"one\\\"\","
+    @" \"done\": true, \"notes\": null}, {\"emoji\": \"\\ud83d\\ude00\"},"
+    @" [], {} ], \"off\": false}";
+  NSData *jsonData = [jsonStr dataUsingEncoding:NSUTF8StringEncoding];
+
+  NSError *error = nil;
+  id expected = [GTLJSONParser objectWithData:jsonData error:&error];
+  XCTAssertNil(error);
+  XCTAssertNotNil(expected);
+
+  // Feed the data in every chunk size, so tokens are split at every offset.
+  const char *bytes = jsonData.bytes;
+  NSUInteger length = jsonData.length;
+  for (NSUInteger chunkSize = 1; chunkSize <= length; chunkSize++) {
+    GTLJSONStreamParser *parser = [[[GTLJSONStreamParser alloc] init] autorelease];
+    for (NSUInteger offset = 0; offset < length; offset += chunkSize) {
+      NSUInteger size = MIN(chunkSize, length - offset);
+      NSData *chunk = [NSData dataWithBytes:bytes + offset length:size];
+      XCTAssertTrue([parser appendData:chunk], @"chunk size %lu",
+                    (unsigned long)chunkSize);
+    }
+    id obj = [parser finishWithError:&error];
+    XCTAssertNil(error, @"chunk size %lu", (unsigned long)chunkSize);
+    XCTAssertEqualObjects(obj, expected, @"chunk size %lu",
+                          (unsigned long)chunkSize);
+    XCTAssertTrue([obj isKindOfClass:[NSMutableDictionary class]]);
+    XCTAssertEqual(parser.totalBytes, (unsigned long long)length);
+  }
+
+  // A byte order mark at the start is skipped, even when split between chunks
+  NSMutableData *bomData = [NSMutableData dataWithBytes:"\xEF\xBB\xBF" length:3];
+  [bomData appendData:jsonData];
+  for (NSUInteger split = 0; split <= bomData.length; split++) {
+    GTLJSONStreamParser *parser = [[[GTLJSONStreamParser alloc] init] autorelease];
+    XCTAssertTrue([parser appendData:[bomData subdataWithRange:NSMakeRange(0, split)]]);
+    XCTAssertTrue([parser appendData:[bomData subdataWithRange:NSMakeRange(split, bomData.length - split)]]);
+    XCTAssertEqualObjects([parser finishWithError:&error], expected,
+                          @"split at %lu", (unsigned long)split);
+  }
+
+  // A long string arriving in many small chunks, with an escape split
+  // between two of them
+  NSMutableData *longData = [NSMutableData dataWithBytes:"[\"" length:2];
+  NSMutableString *longStr = [NSMutableString string];
+  for (int idx = 0; idx < 99999; idx++) {
+    [longStr appendString:@"0123456789"];
+  }
+  [longStr appendString:@"012345"];
+  [longData appendData:[longStr dataUsingEncoding:NSUTF8StringEncoding]];
+  [longData appendBytes:"\\u00e8\"]" length:8];
+  XCTAssertEqual([longData rangeOfData:[NSData dataWithBytes:"\\" length:1]
+                               options:0
+                                 range:NSMakeRange(0, longData.length)].location,
+                 (NSUInteger)999998);
+  GTLJSONStreamParser *longParser = [[[GTLJSONStreamParser alloc] init] autorelease];
+  for (NSUInteger offset = 0; offset < longData.length; offset += 1000) {
+    NSUInteger size = MIN((NSUInteger)1000, longData.length - offset);
+    XCTAssertTrue([longParser appendData:[longData subdataWithRange:NSMakeRange(offset, size)]]);
+  }
+  NSArray *longArray = [longParser finishWithError:&error];
+  XCTAssertNil(error);
+  XCTAssertEqualObjects(longArray[0],
+                        [longStr stringByAppendingFormat:@"%C", (unichar)0x00E8]);
+
+  // Incomplete and malformed JSON
+  NSArray *badStrings = @[ @"{\"a\": 1", @"[1, 2,]", @"{\"a\" 1}", @"[tru]",
+                           @"\"fragment\"", @"{} []", @"[\"unterminated]",
+                           @"[\"tab\t\"]", @"[01]", @"[+1]", @"[-]", @"[1.]" ];
+  for (NSString *badStr in badStrings) {
+    // Every way of splitting the JSON in two fails.
+    NSData *badData = [badStr dataUsingEncoding:NSUTF8StringEncoding];
+    for (NSUInteger split = 0; split <= badData.length; split++) {
+      GTLJSONStreamParser *parser = [[[GTLJSONStreamParser alloc] init] autorelease];
+      [parser appendData:[badData subdataWithRange:NSMakeRange(0, split)]];
+      [parser appendData:[badData subdataWithRange:NSMakeRange(split, badData.length - split)]];
+      error = nil;
+      XCTAssertNil([parser finishWithError:&error], @"%@ split at %lu", badStr,
+                   (unsigned long)split);
+      XCTAssertNotNil(error, @"%@ split at %lu", badStr, (unsigned long)split);
+    }
+
+    GTLJSONStreamParser *parser = [[[GTLJSONStreamParser alloc] init] autorelease];
+    [parser appendData:[badStr dataUsingEncoding:NSUTF8StringEncoding]];
+    error = nil;
+    XCTAssertNil([parser finishWithError:&error], @"%@", badStr);
+    XCTAssertNotNil(error, @"%@", badStr);
+  }
+}
+
+- (void)testJSONLazyParser {
+  NSString *jsonStr = @"{\"kind\":\"tasks#tasks\", \"count\": 12345,"
+    @" \"items\": [ {\"title\": \"t\\u00e8sk\", \"done\": true, \"notes\": null},"
+    @" {\"t\\u00eftle\": \"two\", \"nested\": {\"a\": [1, 2.5, \"x\"]}} ] }";
+  NSData *jsonData = [jsonStr dataUsingEncoding:NSUTF8StringEncoding];
+
+  NSError *error = nil;
+  NSMutableDictionary *expected = [GTLJSONParser objectWithData:jsonData
+                                                          error:&error];
+  XCTAssertNil(error);
+
+  NSMutableDictionary *lazy = [GTLJSONParser lazyObjectWithData:jsonData
+                                                          error:&error];
+  XCTAssertNil(error);
+  XCTAssertTrue([lazy isKindOfClass:[NSMutableDictionary class]]);
+
+  // Individual values
+  XCTAssertEqualObjects(lazy[@"kind"], @"tasks#tasks");
+  XCTAssertEqualObjects(lazy[@"count"], @12345);
+  XCTAssertNil(lazy[@"missing"]);
+
+  NSArray *items = lazy[@"items"];
+  XCTAssertTrue([items isKindOfClass:[NSMutableArray class]]);
+  XCTAssertEqual(items.count, (NSUInteger)2);
+  XCTAssertEqualObjects(items[0][@"notes"], [NSNull null]);
+  XCTAssertEqualObjects(items[1][[NSString stringWithFormat:@"t%Ctle", (unichar)0x00EF]],
+                        @"two");
+
+  // Repeated access returns the same object
+  XCTAssertTrue(lazy[@"items"] == items);
+
+  // The whole tree
+  XCTAssertEqualObjects(lazy, expected);
+
+  // Mutation
+  NSMutableDictionary *nested = items[1][@"nested"];
+  [nested setObject:@"b" forKey:@"b"];
+  [nested removeObjectForKey:@"a"];
+  XCTAssertEqualObjects(nested, @{ @"b" : @"b" });
+
+  // Malformed JSON
+  NSArray *badStrings = @[ @"{\"a\": 1", @"[1, 2,]", @"{\"a\" 1}", @"[tru]",
+                           @"\"fragment\"", @"{} []" ];
+  for (NSString *badStr in badStrings) {
+    NSData *badData = [badStr dataUsingEncoding:NSUTF8StringEncoding];
+    error = nil;
+    XCTAssertNil([GTLJSONParser lazyObjectWithData:badData error:&error], @"%@", badStr);
+    XCTAssertNotNil(error, @"%@", badStr);
+  }
+
+  // Malformed strings and numbers fail up front with the decoder's error,
+  // rather than being dropped when their objects are first read.
+  NSArray *badTokens = @[ @"{\"a\": \"\\x\"}", @"{\"a\": [01]}", @"{\"a\": 1.}",
+                          @"{\"\\u12zz\": 1}", @"{\"a\": {\"b\": \"tab\t\"}}" ];
+  for (NSString *badStr in badTokens) {
+    NSData *badData = [badStr dataUsingEncoding:NSUTF8StringEncoding];
+    NSError *expectedError = nil;
+    XCTAssertNil([GTLJSONParser objectWithData:badData error:&expectedError]);
+    error = nil;
+    XCTAssertNil([GTLJSONParser lazyObjectWithData:badData error:&error], @"%@", badStr);
+    XCTAssertEqualObjects(error, expectedError, @"%@", badStr);
+    XCTAssertEqual(error.code, NSPropertyListReadCorruptError, @"%@", badStr);
+  }
+
+  // A repeated key counts once and finds its last value.
+  NSData *dupData = [@"{\"dup\": 1, \"other\": 2, \"dup\": 3}"
+                     dataUsingEncoding:NSUTF8StringEncoding];
+  NSDictionary *dup = [GTLJSONParser lazyObjectWithData:dupData error:&error];
+  XCTAssertEqual(dup.count, (NSUInteger)2);
+  XCTAssertEqualObjects(dup[@"dup"], @3);
+  XCTAssertEqualObjects(dup, (@{ @"dup" : @3, @"other" : @2 }));
+
+  // Threads reading at once see the same values.
+  NSDictionary *shared = [GTLJSONParser lazyObjectWithData:jsonData error:&error];
+  id sharedItems[8] = { nil };
+  id *sharedItemsPtr = sharedItems;
+  dispatch_apply(8, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),
+                 ^(size_t idx) {
+    sharedItemsPtr[idx] = shared[@"items"];
+    XCTAssertEqualObjects(shared[@"kind"], @"tasks#tasks");
+  });
+  for (size_t idx = 0; idx < 8; idx++) {
+    XCTAssertTrue(sharedItems[idx] == sharedItems[0]);
+  }
+  XCTAssertEqualObjects(shared, expected);
+}
+
+- (void)testJSONDecoder {
+  NSString *jsonStr = @"{\"kind\":\"tasks#tasks\", \"count\": 12345,"
+    @" \"ratio\": -1.5e3, \"small\": 0.000125,"
+    @" \"items\": [ {\"title\": \"tèsk \\\"one\\\"\", \"done\": true,"
+    @" \"notes\": null}, {\"emoji\": \"\\ud83d\\ude00\"}, [], {} ],"
+    @" \"off\": false}";
+  NSData *jsonData = [jsonStr dataUsingEncoding:NSUTF8StringEncoding];
+
+  NSError *error = nil;
+  NSMutableDictionary *obj = [GTLJSONParser objectWithData:jsonData error:&error];
+  XCTAssertNil(error);
+  XCTAssertTrue([obj isKindOfClass:[NSMutableDictionary class]]);
+  XCTAssertTrue([obj[@"items"] isKindOfClass:[NSMutableArray class]]);
+  XCTAssertTrue([obj[@"items"][0] isKindOfClass:[NSMutableDictionary class]]);
+
+  XCTAssertEqualObjects(obj[@"count"], @12345);
+  XCTAssertEqualObjects(obj[@"ratio"], @(-1500.0));
+  XCTAssertEqualObjects(obj[@"small"], @0.000125);
+  XCTAssertEqualObjects(obj[@"items"][0][@"title"], @"tèsk \"one\"");
+  XCTAssertEqualObjects(obj[@"items"][1][@"emoji"], @"\U0001F600");
+  XCTAssertEqualObjects(obj[@"off"], @NO);
+
+  // The tree matches NSJSONSerialization's.
+  id expected = [NSJSONSerialization JSONObjectWithData:jsonData
+                                                options:NSJSONReadingMutableContainers
+                                                  error:&error];
+  XCTAssertEqualObjects(obj, expected);
+
+  // Numbers beyond the fast paths, a byte order mark, and a repeated key
+  NSMutableData *bomData = [NSMutableData dataWithBytes:"\xEF\xBB\xBF" length:3];
+  [bomData appendData:[@"{\"big\": 18446744073709551615,"
+                        @" \"neg\": -9223372036854775808,"
+                        @" \"long\": 3.14159265358979323846,"
+                        @" \"dup\": 1, \"dup\": 2}"
+                       dataUsingEncoding:NSUTF8StringEncoding]];
+  NSDictionary *numbers = [GTLJSONParser objectWithData:bomData error:&error];
+  XCTAssertNil(error);
+  XCTAssertEqualObjects(numbers[@"big"], @18446744073709551615ULL);
+  XCTAssertEqualObjects(numbers[@"neg"], @(LLONG_MIN));
+  XCTAssertEqualObjects(numbers[@"long"], @3.14159265358979323846);
+  XCTAssertEqualObjects(numbers[@"dup"], @2);
+
+  // Immutable containers
+  NSDictionary *immutable = [GTLJSONParser objectWithData:jsonData
+                                        mutableContainers:NO
+                                                    error:&error];
+  XCTAssertEqualObjects(immutable, obj);
+  XCTAssertFalse([immutable isKindOfClass:[NSMutableDictionary class]]);
+
+  // Malformed JSON
+  NSArray *badStrings = @[ @"{\"a\": 1", @"[1, 2,]", @"{\"a\" 1}", @"[tru]",
+                           @"\"fragment\"", @"{} []", @"[\"unterminated]",
+                           @"[01]", @"[1.]", @"[-]", @"[1e]", @"[\"tab\t\"]",
+                           @"{1: 2}", @"[\"\\x\"]", @"" ];
+  for (NSString *badStr in badStrings) {
+    NSData *badData = [badStr dataUsingEncoding:NSUTF8StringEncoding];
+    error = nil;
+    XCTAssertNil([GTLJSONParser objectWithData:badData error:&error], @"%@", badStr);
+    XCTAssertEqualObjects(error.domain, NSCocoaErrorDomain, @"%@", badStr);
+  }
+
+  // Invalid UTF-8: a truncated sequence, an overlong form, and a surrogate
+  const char *badUTF8[] = { "[\"\xC3\"]", "[\"\xC0\xAF\"]", "[\"\xED\xA0\x80\"]" };
+  for (size_t idx = 0; idx < sizeof(badUTF8) / sizeof(badUTF8[0]); idx++) {
+    NSData *badData = [NSData dataWithBytes:badUTF8[idx] length:strlen(badUTF8[idx])];
+    error = nil;
+    XCTAssertNil([GTLJSONParser objectWithData:badData error:&error]);
+    XCTAssertNotNil(error);
+  }
+}
+
+- (void)testJSONParsersAcceptTheSameTokens {
+  // The stream, lazy, and concurrent parsers accept exactly the strings and
+  // numbers which the decoder does.
+  const char *jsons[] = {
+    "[\"ok\", \"\\u00e8\\n\", \"caf\xC3\xA8\", 0, -0.5, 1e+2, 12.5E-1]",
+    "[\"tab\t\"]", "[\"\\x\"]", "[\"\\u12\"]", "[\"\\u12zz\"]",
+    "[\"\xC3\"]", "[\"\xC0\xAF\"]", "[\"\xED\xA0\x80\"]", "[\"\xFF\"]",
+    "[01]", "[-01]", "[+1]", "[1.]", "[.5]", "[-]", "[1e]", "[1e+]", "[0x1]",
+    "{\"\\q\": 1}", "{\"a\": 1.2.3}", "[1e400]", "[-1e400]", "[1e-400]",
+    "\xEF\xBB\xBF[1]", "[\xEF\xBB\xBF" "1]", " \xEF\xBB\xBF[1]"
+  };
+  for (size_t idx = 0; idx < sizeof(jsons) / sizeof(jsons[0]); idx++) {
+    NSData *data = [NSData dataWithBytes:jsons[idx] length:strlen(jsons[idx])];
+    NSError *error = nil;
+    id expected = [GTLJSONParser objectWithData:data error:&error];
+    XCTAssertEqual(expected == nil, error != nil, @"%s", jsons[idx]);
+
+    GTLJSONStreamParser *parser = [[[GTLJSONStreamParser alloc] init] autorelease];
+    [parser appendData:data];
+    id streamed = [parser finishWithError:&error];
+    id lazy = [GTLJSONParser lazyObjectWithData:data error:&error];
+    id concurrent = [GTLJSONParser concurrentObjectWithData:data error:&error];
+    for (id obj in @[ streamed ?: [NSNull null], lazy ?: [NSNull null],
+                      concurrent ?: [NSNull null] ]) {
+      XCTAssertEqualObjects(obj, expected ?: [NSNull null], @"%s", jsons[idx]);
+    }
+  }
+}
+
+- (void)testJSONInternedStrings {
+  NSString *key = [GTLJSONParser internedString:
+                   [NSMutableString stringWithString:@"gtlTestInternedKey"]];
+  NSString *value = [GTLJSONParser internedString:@"gtlTestInternedValue"];
+  XCTAssertTrue([GTLJSONParser internedString:@"gtlTestInternedKey"] == key);
+
+  // Strings differing only after an embedded NUL are interned separately.
+  NSString *nulStr1 = [NSString stringWithFormat:@"gtlTest%Cone", (unichar)0];
+  NSString *nulStr2 = [NSString stringWithFormat:@"gtlTest%Ctwo", (unichar)0];
+  XCTAssertEqualObjects([GTLJSONParser internedString:nulStr1], nulStr1);
+  XCTAssertEqualObjects([GTLJSONParser internedString:nulStr2], nulStr2);
+
+  NSString *jsonStr = @"[{\"gtlTestInternedKey\": \"gtlTestInternedValue\","
+                      @" \"other\": \"x\"}, {\"gtlTestInternedKey\": 1, \"other\": \"x\"}]";
+  NSData *jsonData = [jsonStr dataUsingEncoding:NSUTF8StringEncoding];
+
+  NSError *error = nil;
+  NSArray *decoded = [GTLJSONParser objectWithData:jsonData error:&error];
+  XCTAssertNil(error);
+  GTLJSONStreamParser *parser = [[[GTLJSONStreamParser alloc] init] autorelease];
+  [parser appendData:jsonData];
+  NSArray *streamed = [parser finishWithError:&error];
+  XCTAssertNil(error);
+
+  for (NSArray *array in @[ decoded, streamed ]) {
+    NSDictionary *dict = array[0];
+    XCTAssertTrue([[dict allKeysForObject:value] lastObject] == key);
+    XCTAssertTrue(dict[key] == value);
+  }
+
+  // Keys repeated within a response are shared even when not interned.
+  NSString *other0 = [[decoded[0] allKeysForObject:@"x"] lastObject];
+  NSString *other1 = [[decoded[1] allKeysForObject:@"x"] lastObject];
+  XCTAssertEqualObjects(other0, @"other");
+  XCTAssertTrue(other0 == other1);
+}
+
+- (NSArray *)recordedResponseData {
+  // The JSON responses recorded for the service tests
+  NSBundle *testBundle = [NSBundle bundleForClass:[self class]];
+  NSArray *paths = [testBundle pathsForResourcesOfType:@"txt" inDirectory:nil];
+  NSMutableArray *result = [NSMutableArray array];
+  for (NSString *path in paths) {
+    NSString *name = [path lastPathComponent];
+    if ([name hasSuffix:@".response.txt"] || [name hasSuffix:@".rest.txt"]) {
+      NSData *data = [NSData dataWithContentsOfFile:path];
+      if (data.length > 0) {
+        [result addObject:data];
+      }
+    }
+  }
+  return result;
+}
+
+- (void)testJSONDecoderRecordedResponses {
+  NSArray *responses = [self recordedResponseData];
+  XCTAssertTrue(responses.count > 0);
+
+  for (NSData *data in responses) {
+    NSError *error = nil;
+    id expected = [NSJSONSerialization JSONObjectWithData:data
+                                                  options:NSJSONReadingMutableContainers
+                                                    error:&error];
+    id obj = [GTLJSONParser objectWithData:data error:&error];
+    XCTAssertEqualObjects(obj, expected);
+  }
+}
+
+- (void)testJSONDecoderPerformance {
+  NSArray *responses = [self recordedResponseData];
+
+  [self measureBlock:^{
+    for (int idx = 0; idx < 1000; idx++) {
+      for (NSData *data in responses) {
+        @autoreleasepool {
+          [GTLJSONParser objectWithData:data error:NULL];
+        }
+      }
+    }
+  }];
+}
+
+- (void)testNSJSONSerializationPerformance {
+  // For comparison with testJSONDecoderPerformance
+  NSArray *responses = [self recordedResponseData];
+
+  [self measureBlock:^{
+    for (int idx = 0; idx < 1000; idx++) {
+      for (NSData *data in responses) {
+        @autoreleasepool {
+          [NSJSONSerialization JSONObjectWithData:data
+                                          options:NSJSONReadingMutableContainers
+                                            error:NULL];
+        }
+      }
+    }
+  }];
+}
+
+- (NSData *)largeResponseData {
+  // A response of a few megabytes, with large arrays nested in objects
+  NSMutableArray *items = [NSMutableArray array];
+  for (int idx = 0; idx < 20000; idx++) {
+    [items addObject:@{ @"kind" : @"test#item",
+                        @"id" : [NSString stringWithFormat:@"item%d", idx],
+                        @"size" : @(idx * 1000),
+                        @"ratio" : @(idx / 7.0),
+                        @"title" : @"A caf\u00e8 \"title\"",
+                        @"tags" : @[ @"a", @"b", @(idx % 2 == 0), [NSNull null] ] }];
+  }
+  NSMutableDictionary *groups = [NSMutableDictionary dictionary];
+  for (int idx = 0; idx < 100; idx++) {
+    NSString *key = [NSString stringWithFormat:@"group%d", idx];
+    groups[key] = [items subarrayWithRange:NSMakeRange(idx * 10, 10)];
+  }
+  NSDictionary *json = @{ @"kind" : @"test#list",
+                          @"items" : items,
+                          @"groups" : @{ @"all" : groups, @"empty" : @[] } };
+  return [NSJSONSerialization dataWithJSONObject:json options:0 error:NULL];
+}
+
+- (void)testJSONConcurrentDecoder {
+  NSData *data = [self largeResponseData];
+  XCTAssertTrue(data.length > 1024 * 1024);
+
+  NSError *error = nil;
+  id expected = [GTLJSONParser objectWithData:data error:&error];
+  XCTAssertNil(error);
+  id obj = [GTLJSONParser concurrentObjectWithData:data error:&error];
+  XCTAssertNil(error);
+  XCTAssertEqualObjects(obj, expected);
+  XCTAssertTrue([obj isKindOfClass:[NSMutableDictionary class]]);
+  XCTAssertTrue([obj[@"items"] isKindOfClass:[NSMutableArray class]]);
+  XCTAssertTrue([obj[@"items"][0] isKindOfClass:[NSMutableDictionary class]]);
+
+  // Small responses decode the same way
+  for (NSData *response in [self recordedResponseData]) {
+    expected = [GTLJSONParser objectWithData:response error:NULL];
+    obj = [GTLJSONParser concurrentObjectWithData:response error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(obj, expected);
+  }
+
+  // A key repeated in an object decoded concurrently keeps its last value
+  NSString *padding = [@"" stringByPaddingToLength:70000
+                                        withString:@"x"
+                                   startingAtIndex:0];
+  NSString *dupStr = [NSString stringWithFormat:
+                      @"{\"dup\": 1, \"padding\": \"%@\", \"dup\": 2}", padding];
+  NSData *dupData = [dupStr dataUsingEncoding:NSUTF8StringEncoding];
+  NSDictionary *dup = [GTLJSONParser concurrentObjectWithData:dupData error:&error];
+  XCTAssertNil(error);
+  XCTAssertEqual(dup.count, (NSUInteger)2);
+  XCTAssertEqualObjects(dup[@"dup"], @2);
+  XCTAssertEqualObjects(dup, [GTLJSONParser objectWithData:dupData error:NULL]);
+
+  // Malformed JSON within a large array reports the decoder's error
+  NSMutableData *badData = [[data mutableCopy] autorelease];
+  NSRange range = [badData rangeOfData:[@"item12345\"" dataUsingEncoding:NSUTF8StringEncoding]
+                               options:0
+                                 range:NSMakeRange(0, badData.length)];
+  XCTAssertNotEqual(range.location, (NSUInteger)NSNotFound);
+  const unsigned char invalidUTF8 = 0xFF;
+  [badData replaceBytesInRange:NSMakeRange(range.location, 1)
+                     withBytes:&invalidUTF8];
+
+  NSError *expectedError = nil;
+  expected = [GTLJSONParser objectWithData:badData error:&expectedError];
+  XCTAssertNil(expected);
+  obj = [GTLJSONParser concurrentObjectWithData:badData error:&error];
+  XCTAssertNil(obj);
+  XCTAssertEqualObjects(error, expectedError);
+
+  obj = [GTLJSONParser concurrentObjectWithData:[data subdataWithRange:NSMakeRange(0, data.length - 1)]
+                                          error:&error];
+  XCTAssertNil(obj);
+  XCTAssertEqual(error.code, NSPropertyListReadCorruptError);
+}
+
+- (void)testJSONDecoderCancellation {
+  NSData *data = [self largeResponseData];
+  NSError *error = nil;
+  id expected = [GTLJSONParser objectWithData:data error:NULL];
+
+  // Decoding for an operation which is not cancelled is unchanged
+  NSOperation *operation = [[[NSOperation alloc] init] autorelease];
+  id obj = [GTLJSONParser objectWithData:data
+                               operation:operation
+                                   error:&error];
+  XCTAssertNil(error);
+  XCTAssertEqualObjects(obj, expected);
+
+  obj = [GTLJSONParser concurrentObjectWithData:data
+                                      operation:operation
+                                          error:&error];
+  XCTAssertNil(error);
+  XCTAssertEqualObjects(obj, expected);
+
+  // Decoding for a cancelled operation stops
+  [operation cancel];
+  obj = [GTLJSONParser objectWithData:data
+                            operation:operation
+                                error:&error];
+  XCTAssertNil(obj);
+  XCTAssertEqualObjects(error.domain, NSCocoaErrorDomain);
+  XCTAssertEqual(error.code, NSUserCancelledError);
+
+  error = nil;
+  obj = [GTLJSONParser concurrentObjectWithData:data
+                                      operation:operation
+                                          error:&error];
+  XCTAssertNil(obj);
+  XCTAssertEqualObjects(error.domain, NSCocoaErrorDomain);
+  XCTAssertEqual(error.code, NSUserCancelledError);
+}
+
+- (void)testJSONConcurrentDecoderPerformance {
+  NSData *data = [self largeResponseData];
+
+  [self measureBlock:^{
+    for (int idx = 0; idx < 10; idx++) {
+      @autoreleasepool {
+        [GTLJSONParser concurrentObjectWithData:data error:NULL];
+      }
+    }
+  }];
+}
+
+- (void)testJSONLargeResponseDecoderPerformance {
+  // For comparison with testJSONConcurrentDecoderPerformance
+  NSData *data = [self largeResponseData];
+
+  [self measureBlock:^{
+    for (int idx = 0; idx < 10; idx++) {
+      @autoreleasepool {
+        [GTLJSONParser objectWithData:data error:NULL];
+      }
+    }
+  }];
+}
+
 - (void)doTestEqualAndDistinctElementsInDictionary:(NSDictionary *)testDict
                                  andDictionaryCopy:(NSDictionary *)copyDict {
 
@@ -29,10 +29,14 @@ typedef enum {
 @property (readonly, retain) GTLDiscoveryRpcDescription* api;
 @property (readonly, assign) NSUInteger verboseLevel;
 @property (readonly, assign) BOOL allowRootURLOverrides;
+// When YES, object classes get concrete property methods instead of @dynamic
+// properties that GTLRuntimeCommon wires up on first use.
+@property (readonly, assign) BOOL useStaticAccessors;
 
 + (instancetype)generatorForApi:(GTLDiscoveryRpcDescription *)api
                    verboseLevel:(NSUInteger)verboseLevel
           allowRootURLOverrides:(BOOL)allowRootURLOverrides
+                staticAccessors:(BOOL)staticAccessors
           formattedNameOverride:(NSString *)formattedNameOverride
                skipIfLikelyREST:(BOOL)skipIfLikelyREST;
 
@@ -174,6 +174,7 @@ typedef enum {
 - (instancetype)initWithApi:(GTLDiscoveryRpcDescription *)api
                verboseLevel:(NSUInteger)verboseLevel
       allowRootURLOverrides:(BOOL)allowRootURLOverrides
+            staticAccessors:(BOOL)staticAccessors
       formattedNameOverride:(NSString *)formattedNameOverride
            skipIfLikelyREST:(BOOL)skipIfLikelyREST;
 
@@ -198,6 +199,7 @@ typedef enum {
                                    forMode:(GeneratorMode)mode
                    includeClassDescription:(BOOL)includeClassDescription
                          extraClassComment:(NSString *)extraClassComment;
+- (NSString *)staticAccessorsForProperty:(GTLDiscoveryJsonSchema *)property;
 - (NSArray *)constantsBlocksForMode:(GeneratorMode)mode;
 - (NSString *)authorizationScopeToConstant:(NSString *)scope;
 
@@ -216,6 +218,26 @@ static NSArray *DictionaryObjectsSortedByKeys(NSDictionary *dict) {
   return result;
 }
 
+// Helper to get the class name to use for the items of an array property.
+static NSString *ArrayItemsObjCClassName(GTLDiscoveryJsonSchema *arraySchema) {
+  GTLDiscoveryJsonSchema *itemProperty =
+      [arraySchema itemsSchemaResolving:YES depth:NULL];
+  NSString *objcType = nil;
+  if (itemProperty == nil) {
+    // A warning is already printed when the header was generated.
+    objcType = @"id";
+  } else {
+    [itemProperty getObjectParamObjCType:&objcType
+                               asPointer:NULL
+                   objcPropertySemantics:NULL
+                                 comment:NULL];
+  }
+  if ([objcType isEqual:@"id"]) {
+    objcType = @"NSObject";
+  }
+  return objcType;
+}
+
 static NSString *ConstantName(NSString *grouping, NSString *name) {
   // Some constants are things like "@self", so remove the "@" for the name
   // we generated.
@@ -240,7 +262,8 @@ static NSString *ConstantName(NSString *grouping, NSString *name) {
 
 @synthesize api = api_,
             verboseLevel = verboseLevel_,
-            allowRootURLOverrides = allowRootURLOverrides_;
+            allowRootURLOverrides = allowRootURLOverrides_,
+            useStaticAccessors = useStaticAccessors_;
 
 @synthesize warnings = warnings_,
             infos = infos_;
@@ -248,11 +271,13 @@ static NSString *ConstantName(NSString *grouping, NSString *name) {
 + (instancetype)generatorForApi:(GTLDiscoveryRpcDescription *)api
                    verboseLevel:(NSUInteger)verboseLevel
           allowRootURLOverrides:(BOOL)allowRootURLOverrides
+                staticAccessors:(BOOL)staticAccessors
           formattedNameOverride:(NSString *)formattedNameOverride
                skipIfLikelyREST:(BOOL)skipIfLikelyREST {
   return [[[self alloc] initWithApi:api
                        verboseLevel:verboseLevel
               allowRootURLOverrides:allowRootURLOverrides
+                    staticAccessors:staticAccessors
               formattedNameOverride:formattedNameOverride
                    skipIfLikelyREST:skipIfLikelyREST] autorelease];
 }
@@ -260,6 +285,7 @@ static NSString *ConstantName(NSString *grouping, NSString *name) {
 - (instancetype)initWithApi:(GTLDiscoveryRpcDescription *)api
                verboseLevel:(NSUInteger)verboseLevel
       allowRootURLOverrides:(BOOL)allowRootURLOverrides
+            staticAccessors:(BOOL)staticAccessors
       formattedNameOverride:(NSString *)formattedNameOverride
            skipIfLikelyREST:(BOOL)skipIfLikelyREST {
   self = [super init];
@@ -267,6 +293,7 @@ static NSString *ConstantName(NSString *grouping, NSString *name) {
     api_ = [api retain];
     verboseLevel_ = verboseLevel;
     allowRootURLOverrides_ = allowRootURLOverrides;
+    useStaticAccessors_ = staticAccessors;
     formattedName_ = [formattedNameOverride copy];
     if (!api) {
       [self release];
@@ -815,6 +842,50 @@ static NSString *ConstantName(NSString *grouping, NSString *name) {
 
   [parts addObject:initializeMethod];
 
+  // List all the query and object classes, so GTLService can wire up their
+  // properties in one pass.
+  NSMutableString *objectClassesMethod = [NSMutableString string];
+  [objectClassesMethod appendString:@"+ (NSArray *)objectClasses {\n"];
+  [objectClassesMethod appendString:@"  NSArray *classes = @[\n"];
+  [objectClassesMethod appendFormat:@"    [%@ class]", self.objcQueryClassName];
+  for (GTLDiscoveryJsonSchema *schema in self.api.topLevelObjectSchemas) {
+    [objectClassesMethod appendFormat:@",\n    [%@ class]", schema.objcClassName];
+    for (GTLDiscoveryJsonSchema *subSchema in schema.childObjectSchemas) {
+      [objectClassesMethod appendFormat:@",\n    [%@ class]", subSchema.objcClassName];
+    }
+  }
+  [objectClassesMethod appendString:@"\n  ];\n"];
+  [objectClassesMethod appendString:@"  return classes;\n"];
+  [objectClassesMethod appendString:@"}\n"];
+
+  [parts addObject:objectClassesMethod];
+
+  // List the values of the API's constants, so GTLService can intern them
+  // for the JSON parser.
+  NSDictionary *enumsMap = self.api.enumsMap;
+  if ([enumsMap count] > 0) {
+    NSMutableString *constantStringsMethod = [NSMutableString string];
+    [constantStringsMethod appendString:@"+ (NSArray *)constantStrings {\n"];
+    [constantStringsMethod appendString:@"  NSArray *strings = @[\n"];
+    NSArray *constantsGroups =
+      [[enumsMap allKeys] sortedArrayUsingSelector:@selector(caseInsensitiveCompare:)];
+    NSString *separator = @"";
+    for (NSString *constantsGroup in constantsGroups) {
+      NSDictionary *enumGroup = [enumsMap objectForKey:constantsGroup];
+      NSArray *names =
+        [[enumGroup allKeys] sortedArrayUsingSelector:@selector(caseInsensitiveCompare:)];
+      for (NSString *name in names) {
+        [constantStringsMethod appendFormat:@"%@    %@", separator, name];
+        separator = @",\n";
+      }
+    }
+    [constantStringsMethod appendString:@"\n  ];\n"];
+    [constantStringsMethod appendString:@"  return strings;\n"];
+    [constantStringsMethod appendString:@"}\n"];
+
+    [parts addObject:constantStringsMethod];
+  }
+
   NSString *rpcURLString = [self.api builtRPCUrlString];
   NSString *rpcUploadUrlString = nil;
   if ([self.api hasMediaUploadMethods]) {
@@ -2200,21 +2271,7 @@ static NSString *MappedParamName(NSString *name) {
       for (GTLDiscoveryJsonSchema *property in properties) {
         GTLDiscoveryJsonSchema *resolvedProperty = property.resolvedSchema;
         if ([resolvedProperty.type isEqual:@"array"]) {
-          GTLDiscoveryJsonSchema *itemProperty =
-              [resolvedProperty itemsSchemaResolving:YES depth:NULL];
-          NSString *objcType = nil;
-          if (itemProperty == nil) {
-            // A warning is already printed when the header was generated.
-            objcType = @"id";
-          } else {
-            [itemProperty getObjectParamObjCType:&objcType
-                                       asPointer:NULL
-                           objcPropertySemantics:NULL
-                                         comment:NULL];
-          }
-          if ([objcType isEqual:@"id"]) {
-            objcType = @"NSObject";
-          }
+          NSString *objcType = ArrayItemsObjCClassName(resolvedProperty);
           NSString *getClassStr =
             [NSString stringWithFormat:@"[%@ class]", objcType];
           [pairs setObject:getClassStr forKey:property.name];
@@ -2227,6 +2284,16 @@ static NSString *MappedParamName(NSString *name) {
         [methodParts addObject:methodImpl];
       }
     }
+
+    // When asked, implement the accessors so the runtime doesn't have to build
+    // them.  The properties stay @dynamic above so GTLObject still treats
+    // them as declared properties (for additionalJSONKeys, etc.).
+    if ((mode == kGenerateImplementation) && self.useStaticAccessors) {
+      for (GTLDiscoveryJsonSchema *property in properties) {
+        NSString *accessors = [self staticAccessorsForProperty:property];
+        [methodParts addObject:accessors];
+      }
+    }
   }
 
   // Handle the 'kind' attribute for auto creating the right objects when
@@ -2322,6 +2389,68 @@ static NSString *MappedParamName(NSString *name) {
   return [parts componentsJoinedByString:@""];
 }
 
+- (NSString *)staticAccessorsForProperty:(GTLDiscoveryJsonSchema *)property {
+  NSString *objcType = nil;
+  BOOL asPtr = NO;
+  [property getObjectParamObjCType:&objcType
+                         asPointer:&asPtr
+             objcPropertySemantics:NULL
+                           comment:NULL];
+  NSString *propertyObjCName = property.objcName;
+  NSString *jsonKey = property.name;
+
+  NSString *getterName = propertyObjCName;
+  if ([useCustomerGetterPredicate_ evaluateWithObject:propertyObjCName]) {
+    getterName = [@"valueOf_" stringByAppendingString:propertyObjCName];
+  }
+  NSString *setterName =
+    [NSString stringWithFormat:@"set%@%@",
+     [[propertyObjCName substringToIndex:1] uppercaseString],
+     [propertyObjCName substringFromIndex:1]];
+  NSString *fullType = [NSString stringWithFormat:@"%@%@",
+                        objcType, (asPtr ? @" *" : @" ")];
+
+  // These match what GTLRuntimeCommon would provide for the properties.
+  NSString *getterBody, *setterBody;
+  GTLDiscoveryJsonSchema *resolvedProperty = property.resolvedSchema;
+  if ([resolvedProperty.type isEqual:@"array"]) {
+    NSString *itemsClassName = ArrayItemsObjCClassName(resolvedProperty);
+    getterBody =
+      [NSString stringWithFormat:@"[self JSONArrayForKey:@\"%@\" itemClass:[%@ class]]",
+       jsonKey, itemsClassName];
+    setterBody =
+      [NSString stringWithFormat:@"[self setJSONArray:value forKey:@\"%@\" itemClass:[%@ class]]",
+       jsonKey, itemsClassName];
+  } else if ([objcType isEqual:@"NSString"]) {
+    getterBody = [NSString stringWithFormat:@"[self JSONValueForKey:@\"%@\"]", jsonKey];
+    setterBody = [NSString stringWithFormat:@"[self setJSONString:value forKey:@\"%@\"]", jsonKey];
+  } else if ([objcType isEqual:@"NSNumber"]) {
+    getterBody = [NSString stringWithFormat:@"[self JSONNumberForKey:@\"%@\"]", jsonKey];
+    setterBody = [NSString stringWithFormat:@"[self setJSONValue:value forKey:@\"%@\"]", jsonKey];
+  } else if ([objcType isEqual:@"GTLDateTime"]) {
+    getterBody = [NSString stringWithFormat:@"[self JSONDateTimeForKey:@\"%@\"]", jsonKey];
+    setterBody = [NSString stringWithFormat:@"[self setJSONDateTime:value forKey:@\"%@\"]", jsonKey];
+  } else if ([objcType isEqual:@"id"]) {
+    getterBody = [NSString stringWithFormat:@"[self JSONAnyObjectForKey:@\"%@\"]", jsonKey];
+    setterBody = [NSString stringWithFormat:@"[self setJSONAnyObject:value forKey:@\"%@\"]", jsonKey];
+  } else {
+    getterBody =
+      [NSString stringWithFormat:@"[self JSONObjectForKey:@\"%@\" objectClass:[%@ class]]",
+       jsonKey, objcType];
+    setterBody = [NSString stringWithFormat:@"[self setJSONObject:value forKey:@\"%@\"]", jsonKey];
+  }
+
+  NSMutableString *result = [NSMutableString string];
+  [result appendFormat:@"- (%@)%@ {\n", fullType, getterName];
+  [result appendFormat:@"  return %@;\n", getterBody];
+  [result appendString:@"}\n"];
+  [result appendString:@"\n"];
+  [result appendFormat:@"- (void)%@:(%@)value {\n", setterName, fullType];
+  [result appendFormat:@"  %@;\n", setterBody];
+  [result appendString:@"}\n"];
+  return result;
+}
+
 - (NSArray *)constantsBlocksForMode:(GeneratorMode)mode {
   NSMutableArray *result = [NSMutableArray array];
 
@@ -91,6 +91,11 @@ static ArgInfo optionalFlags[] = {
     "Causes any API root URL for a Google sandbox server to be replaced with"
     " the googleapis.com root instead."
   },
+  { "--staticAccessors yes|no  Default: no",
+    "Causes the generated object classes to implement their property"
+    " getters and setters directly instead of having them created at runtime"
+    " from the @dynamic properties."
+  },
   { "--verbose",
     "Generate more verbose output.  Can be used more than once."
   },
@@ -166,6 +171,7 @@ typedef enum {
 @property (assign) BOOL removeUnknownFiles;
 @property (assign) BOOL includeGeneratedDir;
 @property (assign) BOOL rootURLOverrides;
+@property (assign) BOOL staticAccessors;
 @property (assign) NSUInteger verboseLevel;
 @property (retain) NSMutableDictionary *additionalHTTPHeaders;
 @property (retain) NSMutableDictionary *formattedNames;
@@ -233,6 +239,7 @@ static BOOL HaveFileStringsChanged(NSString *oldFile, NSString *newFile) {
             addServiceNameDir = addServiceNameDir_,
             removeUnknownFiles = removeUnknownFiles_,
             rootURLOverrides = rootURLOverrides_,
+            staticAccessors = staticAccessors_,
             includeGeneratedDir = includeGeneratedDir_,
             verboseLevel = verboseLevel_,
             additionalHTTPHeaders = additionalHTTPHeaders_,
@@ -452,6 +459,7 @@ static BOOL HaveFileStringsChanged(NSString *oldFile, NSString *newFile) {
     { "addServiceNameDir",  required_argument,  NULL,               'x' },
     { "removeUnknownFiles", required_argument,  NULL,               'y' },
     { "rootURLOverrides",   required_argument,  NULL,               'u' },
+    { "staticAccessors",    required_argument,  NULL,               's' },
     { "generatedDir",       required_argument,  NULL,               'z' },
     { "verbose",            no_argument,        NULL,               'v' },
     { "help",               no_argument,        &showUsage,         1 },
@@ -513,6 +521,9 @@ static BOOL HaveFileStringsChanged(NSString *oldFile, NSString *newFile) {
       case 'u':
         self.rootURLOverrides = [FHUtils boolFromArg:optarg];
         break;
+      case 's':
+        self.staticAccessors = [FHUtils boolFromArg:optarg];
+        break;
       case 'z':
         self.includeGeneratedDir = [FHUtils boolFromArg:optarg];
         break;
@@ -656,6 +667,7 @@ static BOOL HaveFileStringsChanged(NSString *oldFile, NSString *newFile) {
   printf("   + Remove unknown files: %s\n", [FHUtils strFromBool:self.removeUnknownFiles]);
   printf("   + Add 'Generated' directory: %s\n", [FHUtils strFromBool:self.includeGeneratedDir]);
   printf("   + Allow rootURL overrides: %s\n", [FHUtils strFromBool:self.rootURLOverrides]);
+  printf("   + Static property accessors: %s\n", [FHUtils strFromBool:self.staticAccessors]);
 
   NSMutableArray *urlStringsToFetch = [NSMutableArray array];
   NSMutableArray *filesToLoad = [NSMutableArray array];
@@ -949,6 +961,7 @@ static BOOL HaveFileStringsChanged(NSString *oldFile, NSString *newFile) {
       FHGenerator *aGenerator = [FHGenerator generatorForApi:api
                                                 verboseLevel:self.verboseLevel
                                        allowRootURLOverrides:self.rootURLOverrides
+                                             staticAccessors:self.staticAccessors
                                        formattedNameOverride:formattedNameOverride
                                             skipIfLikelyREST:fromDiscovery];
       if (fromDiscovery && [aGenerator likelyRESTOnlyAPI]) {
@@ -23,3 +23,35 @@ NSString *GTLEncodeBase64(NSData *data);
 
 NSData *GTLDecodeWebSafeBase64(NSString *base64Str);
 NSString *GTLEncodeWebSafeBase64(NSData *data);
+
+// GTLBase64Decoder decodes base64 supplied in pieces, such as the chunks of a
+// download or of a large string, appending the bytes to a mutable data or
+// writing them to a file handle as each piece is decoded.
+//
+// The input may omit padding.  Once input is found to be invalid, the
+// decoder ignores further input and the append methods and finish return NO.
+@interface GTLBase64Decoder : NSObject {
+ @private
+  NSMutableData *data_;
+  NSFileHandle *fileHandle_;
+  const void *alphabet_;
+  uint8_t pending_[4];      // characters of an incomplete group
+  NSUInteger pendingLength_;
+  BOOL hasPadding_;
+  BOOL isValid_;
+}
+
+- (instancetype)initWithMutableData:(NSMutableData *)data
+                            webSafe:(BOOL)isWebSafe;
+- (instancetype)initWithFileHandle:(NSFileHandle *)fileHandle
+                           webSafe:(BOOL)isWebSafe;
+
+- (BOOL)appendBytes:(const void *)bytes length:(NSUInteger)length;
+- (BOOL)appendData:(NSData *)data;
+- (BOOL)appendString:(NSString *)str;
+
+// Decodes any final characters held back from the appended input.
+- (BOOL)finish;
+
+@property (nonatomic, readonly, getter=isValid) BOOL valid;
+@end
@@ -17,123 +17,562 @@
 
 // Based on Cyrus Najmabadi's elegent little encoder and decoder from
 // http://www.cocoadev.com/index.pl?BaseSixtyFour
+//
+// Blocks of 12 bytes (SSSE3) or 48 bytes (NEON) are encoded and decoded with
+// vector instructions when the compiler targets them; the remainder, and
+// everything on other processors, is handled a group of 3 bytes at a time
+// with lookup tables.
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define GTL_BASE64_SSSE3 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define GTL_BASE64_NEON 1
+#endif
 
-static char gStandardEncodingTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-static char gWebSafeEncodingTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+static const char gStandardEncodingTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char gWebSafeEncodingTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+// Input to the streaming decoder is decoded in pieces of this many characters
+// when writing to a file.
+static const NSUInteger kFileDecodingPieceLength = 64 * 1024;
+
+typedef struct {
+  const char *encodingTable;      // the 64 characters of the alphabet
+  char pairEncodingTable[4096][2];  // the two characters for 12 bits
+  uint8_t decodingTable[256];     // 0xFF for characters not in the alphabet
+} GTLBase64Alphabet;
+
+static GTLBase64Alphabet gStandardAlphabet;
+static GTLBase64Alphabet gWebSafeAlphabet;
+
+static void InitAlphabet(GTLBase64Alphabet *alphabet, const char *encodingTable) {
+  alphabet->encodingTable = encodingTable;
+  for (unsigned int i = 0; i < 4096; i++) {
+    alphabet->pairEncodingTable[i][0] = encodingTable[i >> 6];
+    alphabet->pairEncodingTable[i][1] = encodingTable[i & 0x3F];
+  }
+  memset(alphabet->decodingTable, 0xFF, sizeof(alphabet->decodingTable));
+  for (unsigned int i = 0; i < 64; i++) {
+    alphabet->decodingTable[(uint8_t)encodingTable[i]] = (uint8_t)i;
+  }
+}
+
+static const GTLBase64Alphabet *AlphabetForWebSafe(BOOL isWebSafe) {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    InitAlphabet(&gStandardAlphabet, gStandardEncodingTable);
+    InitAlphabet(&gWebSafeAlphabet, gWebSafeEncodingTable);
+  });
+  return isWebSafe ? &gWebSafeAlphabet : &gStandardAlphabet;
+}
 
 #pragma mark Encode
 
-static NSString *EncodeBase64StringCommon(NSData *data, const char *table) {
-  if (data == nil) return nil;
+#if GTL_BASE64_SSSE3
+// Encodes blocks of 12 bytes, returning the number of bytes encoded.  Each
+// block is loaded with the 4 bytes following it, so at least 16 bytes must
+// remain to encode a block.
+static NSUInteger EncodeBase64BlocksSSSE3(const uint8_t *input, NSUInteger length,
+                                          char *output,
+                                          const GTLBase64Alphabet *alphabet) {
+  // Adding these to the 6-bit values of each range gives its characters:
+  // A-Z, a-z, 0-9, and the alphabet's two final characters.
+  const char *table = alphabet->encodingTable;
+  const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '0' - 52,
+                                        (char)(table[62] - 62),
+                                        (char)(table[63] - 63),
+                                        'A', 0, 0);
+  NSUInteger idx = 0;
+  while (length - idx >= 16) {
+    __m128i in = _mm_loadu_si128((const __m128i *)(input + idx));
 
-  const uint8_t* input = data.bytes;
-  NSUInteger length = data.length;
+    // Spread each 3 bytes across 4 bytes, and move each 6 bits into the low
+    // bits of its own byte.
+    in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+                                            7, 6, 8, 7, 10, 9, 11, 10));
+    __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+    __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+    __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    __m128i values = _mm_or_si128(t1, t3);
+
+    // Map 0-25 to 13, 26-51 to 0, 52-61 to 1-10, 62 to 11 and 63 to 12, and
+    // look up the offset for each.
+    __m128i ranges = _mm_subs_epu8(values, _mm_set1_epi8(51));
+    __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), values);
+    ranges = _mm_or_si128(ranges, _mm_and_si128(isUpper, _mm_set1_epi8(13)));
+    __m128i chars = _mm_add_epi8(values, _mm_shuffle_epi8(offsets, ranges));
 
-  NSUInteger bufferSize = ((length + 2) / 3) * 4;
-  NSMutableData* buffer = [NSMutableData dataWithLength:bufferSize];
+    _mm_storeu_si128((__m128i *)(output + idx / 3 * 4), chars);
+    idx += 12;
+  }
+  return idx;
+}
+#endif
 
-  int8_t *output = buffer.mutableBytes;
+#if GTL_BASE64_NEON
+// Encodes blocks of 48 bytes, returning the number of bytes encoded.
+static NSUInteger EncodeBase64BlocksNEON(const uint8_t *input, NSUInteger length,
+                                         char *output,
+                                         const GTLBase64Alphabet *alphabet) {
+  const uint8_t *table = (const uint8_t *)alphabet->encodingTable;
+  uint8x16x4_t lookup;
+  lookup.val[0] = vld1q_u8(table);
+  lookup.val[1] = vld1q_u8(table + 16);
+  lookup.val[2] = vld1q_u8(table + 32);
+  lookup.val[3] = vld1q_u8(table + 48);
+  const uint8x16_t mask = vdupq_n_u8(0x3F);
 
-  for (NSUInteger i = 0; i < length; i += 3) {
-    NSUInteger value = 0;
-    for (NSUInteger j = i; j < (i + 3); j++) {
-      value <<= 8;
+  NSUInteger idx = 0;
+  while (length - idx >= 48) {
+    uint8x16x3_t in = vld3q_u8(input + idx);
+    uint8x16x4_t values;
+    values.val[0] = vshrq_n_u8(in.val[0], 2);
+    values.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4),
+                                      vshrq_n_u8(in.val[1], 4)), mask);
+    values.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2),
+                                      vshrq_n_u8(in.val[2], 6)), mask);
+    values.val[3] = vandq_u8(in.val[2], mask);
 
-      if (j < length) {
-        value |= (0xFF & input[j]);
-      }
-    }
+    uint8x16x4_t chars;
+    chars.val[0] = vqtbl4q_u8(lookup, values.val[0]);
+    chars.val[1] = vqtbl4q_u8(lookup, values.val[1]);
+    chars.val[2] = vqtbl4q_u8(lookup, values.val[2]);
+    chars.val[3] = vqtbl4q_u8(lookup, values.val[3]);
+    vst4q_u8((uint8_t *)output + idx / 3 * 4, chars);
+    idx += 48;
+  }
+  return idx;
+}
+#endif
 
-    NSInteger idx = (i / 3) * 4;
-    output[idx + 0] =                    table[(value >> 18) & 0x3F];
-    output[idx + 1] =                    table[(value >> 12) & 0x3F];
-    output[idx + 2] = (i + 1) < length ? table[(value >> 6)  & 0x3F] : '=';
-    output[idx + 3] = (i + 2) < length ? table[(value >> 0)  & 0x3F] : '=';
+// Encodes the bytes, padding the final characters with '='.  The output
+// must have room for ((length + 2) / 3) * 4 characters.
+static void EncodeBase64Bytes(const uint8_t *input, NSUInteger length,
+                              char *output, const GTLBase64Alphabet *alphabet) {
+  NSUInteger idx = 0;
+#if GTL_BASE64_SSSE3
+  idx = EncodeBase64BlocksSSSE3(input, length, output, alphabet);
+#elif GTL_BASE64_NEON
+  idx = EncodeBase64BlocksNEON(input, length, output, alphabet);
+#endif
+
+  char *out = output + idx / 3 * 4;
+  for (; length - idx >= 3; idx += 3) {
+    uint32_t value = ((uint32_t)input[idx] << 16)
+                     | ((uint32_t)input[idx + 1] << 8)
+                     | input[idx + 2];
+    memcpy(out, alphabet->pairEncodingTable[value >> 12], 2);
+    memcpy(out + 2, alphabet->pairEncodingTable[value & 0xFFF], 2);
+    out += 4;
+  }
+
+  NSUInteger remaining = length - idx;
+  if (remaining > 0) {
+    const char *table = alphabet->encodingTable;
+    uint32_t value = (uint32_t)input[idx] << 16;
+    if (remaining > 1) {
+      value |= (uint32_t)input[idx + 1] << 8;
+    }
+    out[0] = table[(value >> 18) & 0x3F];
+    out[1] = table[(value >> 12) & 0x3F];
+    out[2] = (remaining > 1) ? table[(value >> 6) & 0x3F] : '=';
+    out[3] = '=';
   }
+}
 
-  NSString *result = [[[NSString alloc] initWithData:buffer
-                                            encoding:NSASCIIStringEncoding] autorelease];
+static NSString *EncodeBase64StringCommon(NSData *data, BOOL isWebSafe) {
+  if (data == nil) return nil;
+
+  NSUInteger length = data.length;
+  NSUInteger outputLength = ((length + 2) / 3) * 4;
+  if (outputLength == 0) return @"";
+
+  char *output = malloc(outputLength);
+  if (output == NULL) return nil;
+
+  EncodeBase64Bytes(data.bytes, length, output, AlphabetForWebSafe(isWebSafe));
+
+  NSString *result = [[[NSString alloc] initWithBytesNoCopy:output
+                                                     length:outputLength
+                                                   encoding:NSASCIIStringEncoding
+                                               freeWhenDone:YES] autorelease];
   return result;
 }
 
 NSString *GTLEncodeBase64(NSData *data) {
-  return EncodeBase64StringCommon(data, gStandardEncodingTable);
+  return EncodeBase64StringCommon(data, NO);
 }
 
 NSString *GTLEncodeWebSafeBase64(NSData *data) {
-  return EncodeBase64StringCommon(data, gWebSafeEncodingTable);
+  return EncodeBase64StringCommon(data, YES);
 }
 
 #pragma mark Decode
 
-static void CreateDecodingTable(const char *encodingTable,
-                                size_t encodingTableSize, char *decodingTable) {
-  memset(decodingTable, 0, 128);
-  for (unsigned int i = 0; i < encodingTableSize; i++) {
-    decodingTable[(unsigned int) encodingTable[i]] = (char)i;
+#if GTL_BASE64_SSSE3
+// Decodes blocks of 16 characters, returning the number of characters
+// decoded.  Each block is stored with 4 bytes of scratch following it, so
+// there must be room for 16 bytes of output.  Decoding stops before a block
+// with a character not in the alphabet, including padding.
+static NSUInteger DecodeBase64BlocksSSSE3(const uint8_t *input, NSUInteger length,
+                                          uint8_t *output,
+                                          const GTLBase64Alphabet *alphabet) {
+  const char *table = alphabet->encodingTable;
+  const __m128i char62 = _mm_set1_epi8(table[62]);
+  const __m128i char63 = _mm_set1_epi8(table[63]);
+  const __m128i offset62 = _mm_set1_epi8((char)(62 - table[62]));
+  const __m128i offset63 = _mm_set1_epi8((char)(63 - table[63]));
+
+  NSUInteger idx = 0;
+  // The last block is left to the scalar decoder so that the 16-byte store
+  // stays within the output.
+  while (length - idx >= 32) {
+    __m128i in = _mm_loadu_si128((const __m128i *)(input + idx));
+
+    // Characters from 0x80 up compare as negative, so are in no range.
+    __m128i isUpper = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('A' - 1)),
+                                    _mm_cmplt_epi8(in, _mm_set1_epi8('Z' + 1)));
+    __m128i isLower = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('a' - 1)),
+                                    _mm_cmplt_epi8(in, _mm_set1_epi8('z' + 1)));
+    __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)),
+                                    _mm_cmplt_epi8(in, _mm_set1_epi8('9' + 1)));
+    __m128i is62 = _mm_cmpeq_epi8(in, char62);
+    __m128i is63 = _mm_cmpeq_epi8(in, char63);
+    __m128i isValid = _mm_or_si128(_mm_or_si128(isUpper, isLower),
+                                   _mm_or_si128(isDigit,
+                                                _mm_or_si128(is62, is63)));
+    if (_mm_movemask_epi8(isValid) != 0xFFFF) break;
+
+    __m128i offsets = _mm_or_si128(
+      _mm_or_si128(_mm_and_si128(isUpper, _mm_set1_epi8(-'A')),
+                   _mm_and_si128(isLower, _mm_set1_epi8(26 - 'a'))),
+      _mm_or_si128(_mm_and_si128(isDigit, _mm_set1_epi8(52 - '0')),
+                   _mm_or_si128(_mm_and_si128(is62, offset62),
+                                _mm_and_si128(is63, offset63))));
+    __m128i values = _mm_add_epi8(in, offsets);
+
+    // Join pairs of 6-bit values into 12 bits, then pairs of those into 24,
+    // and pack the 3 bytes of each 32-bit lane together.
+    __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    __m128i bytes = _mm_shuffle_epi8(groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4,
+                                                           10, 9, 8, 14, 13, 12,
+                                                           -1, -1, -1, -1));
+    _mm_storeu_si128((__m128i *)(output + idx / 4 * 3), bytes);
+    idx += 16;
+  }
+  return idx;
+}
+#endif
+
+#if GTL_BASE64_NEON
+// Decodes blocks of 64 characters, returning the number of characters
+// decoded.  Decoding stops before a block with a character not in the
+// alphabet, including padding.
+static NSUInteger DecodeBase64BlocksNEON(const uint8_t *input, NSUInteger length,
+                                         uint8_t *output,
+                                         const GTLBase64Alphabet *alphabet) {
+  const uint8_t *table = alphabet->decodingTable;
+  uint8x16x4_t lowLookup, highLookup;
+  for (int i = 0; i < 4; i++) {
+    lowLookup.val[i] = vld1q_u8(table + 16 * i);
+    highLookup.val[i] = vld1q_u8(table + 64 + 16 * i);
+  }
+  const uint8x16_t sixtyFour = vdupq_n_u8(64);
+
+  NSUInteger idx = 0;
+  while (length - idx >= 64) {
+    uint8x16x4_t in = vld4q_u8(input + idx);
+    uint8x16x4_t values;
+    uint8x16_t invalid = vdupq_n_u8(0);
+    for (int i = 0; i < 4; i++) {
+      // Characters 0-63 are looked up in the low table, and 64-127 in the
+      // high one; characters from 0x80 up are invalid.
+      uint8x16_t value = vqtbl4q_u8(lowLookup, in.val[i]);
+      value = vqtbx4q_u8(value, highLookup, vsubq_u8(in.val[i], sixtyFour));
+      invalid = vorrq_u8(invalid, vorrq_u8(value, in.val[i]));
+      values.val[i] = value;
+    }
+    if (vmaxvq_u8(invalid) & 0x80) break;
+
+    uint8x16x3_t bytes;
+    bytes.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2),
+                            vshrq_n_u8(values.val[1], 4));
+    bytes.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4),
+                            vshrq_n_u8(values.val[2], 2));
+    bytes.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+    vst3q_u8(output + idx / 4 * 3, bytes);
+    idx += 64;
+  }
+  return idx;
+}
+#endif
+
+// Decodes groups of 4 characters, returning the number of characters
+// decoded.  The length must be a multiple of 4, and the output must have
+// room for 3 bytes per group.  Decoding stops before a group with a
+// character not in the alphabet, including padding.
+static NSUInteger DecodeBase64Quads(const uint8_t *input, NSUInteger length,
+                                    uint8_t *output,
+                                    const GTLBase64Alphabet *alphabet) {
+  NSUInteger idx = 0;
+#if GTL_BASE64_SSSE3
+  idx = DecodeBase64BlocksSSSE3(input, length, output, alphabet);
+#elif GTL_BASE64_NEON
+  idx = DecodeBase64BlocksNEON(input, length, output, alphabet);
+#endif
+
+  const uint8_t *table = alphabet->decodingTable;
+  uint8_t *out = output + idx / 4 * 3;
+  for (; idx < length; idx += 4) {
+    uint32_t v0 = table[input[idx]];
+    uint32_t v1 = table[input[idx + 1]];
+    uint32_t v2 = table[input[idx + 2]];
+    uint32_t v3 = table[input[idx + 3]];
+    if ((v0 | v1 | v2 | v3) & 0x80) break;
+
+    uint32_t value = (v0 << 18) | (v1 << 12) | (v2 << 6) | v3;
+    out[0] = (uint8_t)(value >> 16);
+    out[1] = (uint8_t)(value >> 8);
+    out[2] = (uint8_t)value;
+    out += 3;
+  }
+  return idx;
+}
+
+// Decodes the final 2 to 4 characters of the input, which may be padded with
+// '=', returning the number of bytes written to the output, or NSNotFound if
+// the characters are not a valid ending.
+static NSUInteger DecodeFinalBase64Characters(const uint8_t *input,
+                                              NSUInteger length,
+                                              uint8_t *output,
+                                              const GTLBase64Alphabet *alphabet) {
+  NSUInteger numberOfChars = length;
+  while (numberOfChars > 0 && input[numberOfChars - 1] == '=') {
+    numberOfChars--;
+  }
+  // A whole group without padding would have been decoded with the others.
+  if (numberOfChars < 2 || numberOfChars > 3) return NSNotFound;
+
+  const uint8_t *table = alphabet->decodingTable;
+  uint32_t v0 = table[input[0]];
+  uint32_t v1 = table[input[1]];
+  uint32_t v2 = (numberOfChars > 2) ? table[input[2]] : 0;
+  if ((v0 | v1 | v2) & 0x80) return NSNotFound;
+
+  uint32_t value = (v0 << 18) | (v1 << 12) | (v2 << 6);
+  output[0] = (uint8_t)(value >> 16);
+  if (numberOfChars > 2) {
+    output[1] = (uint8_t)(value >> 8);
   }
+  return numberOfChars - 1;
 }
 
-static NSData *DecodeBase64StringCommon(NSString *base64Str,
-                                        char *decodingTable) {
-  // The input string should be plain ASCII
-  const char *cString = [base64Str cStringUsingEncoding:NSASCIIStringEncoding];
-  if (cString == nil) return nil;
+@implementation GTLBase64Decoder
+
+@synthesize valid = isValid_;
 
-  NSInteger inputLength = (NSInteger)strlen(cString);
-  if (inputLength % 4 != 0) return nil;
-  if (inputLength == 0) return [NSData data];
+- (instancetype)initWithMutableData:(NSMutableData *)data
+                            webSafe:(BOOL)isWebSafe {
+  self = [super init];
+  if (self) {
+    data_ = [data retain];
+    alphabet_ = AlphabetForWebSafe(isWebSafe);
+    isValid_ = YES;
+  }
+  return self;
+}
 
-  while (inputLength > 0 && cString[inputLength - 1] == '=') {
-    inputLength--;
+- (instancetype)initWithFileHandle:(NSFileHandle *)fileHandle
+                           webSafe:(BOOL)isWebSafe {
+  self = [super init];
+  if (self) {
+    fileHandle_ = [fileHandle retain];
+    data_ = [[NSMutableData alloc] init];
+    alphabet_ = AlphabetForWebSafe(isWebSafe);
+    isValid_ = YES;
   }
+  return self;
+}
+
+- (instancetype)init {
+  return [self initWithMutableData:[NSMutableData data]
+                           webSafe:NO];
+}
+
+- (void)dealloc {
+  [data_ release];
+  [fileHandle_ release];
+  [super dealloc];
+}
 
-  NSInteger outputLength = inputLength * 3 / 4;
-  NSMutableData* data = [NSMutableData dataWithLength:(NSUInteger)outputLength];
-  uint8_t *output = data.mutableBytes;
+// Decodes whole groups of characters, which may end with a padded group.
+- (BOOL)decodeQuads:(const uint8_t *)input length:(NSUInteger)length {
+  while (length > 0) {
+    if (hasPadding_) return NO;
 
-  NSInteger inputPoint = 0;
-  NSInteger outputPoint = 0;
-  char *table = decodingTable;
+    NSUInteger pieceLength = length;
+    NSUInteger outputStart = data_.length;
+    if (fileHandle_) {
+      pieceLength = MIN(length, kFileDecodingPieceLength);
+      outputStart = 0;
+    }
+    [data_ setLength:outputStart + pieceLength / 4 * 3];
+    uint8_t *output = (uint8_t *)data_.mutableBytes + outputStart;
 
-  while (inputPoint < inputLength) {
-    int i0 = cString[inputPoint++];
-    int i1 = cString[inputPoint++];
-    int i2 = inputPoint < inputLength ? cString[inputPoint++] : 'A'; // 'A' will decode to \0
-    int i3 = inputPoint < inputLength ? cString[inputPoint++] : 'A';
+    NSUInteger decodedLength = DecodeBase64Quads(input, pieceLength, output,
+                                                 alphabet_);
+    NSUInteger outputLength = decodedLength / 4 * 3;
+    BOOL isValid = YES;
+    if (decodedLength < pieceLength) {
+      // Only the last group of the input may be padded.
+      NSUInteger finalLength = NSNotFound;
+      if (decodedLength + 4 == length) {
+        finalLength = DecodeFinalBase64Characters(input + decodedLength, 4,
+                                                  output + outputLength,
+                                                  alphabet_);
+      }
+      if (finalLength == NSNotFound) {
+        isValid = NO;
+      } else {
+        outputLength += finalLength;
+        hasPadding_ = YES;
+      }
+    }
+    [data_ setLength:outputStart + outputLength];
 
-    output[outputPoint++] = (uint8_t)((table[i0] << 2) | (table[i1] >> 4));
-    if (outputPoint < outputLength) {
-      output[outputPoint++] = (uint8_t)(((table[i1] & 0xF) << 4) | (table[i2] >> 2));
+    if (fileHandle_ && outputLength > 0) {
+      [fileHandle_ writeData:data_];
     }
-    if (outputPoint < outputLength) {
-      output[outputPoint++] = (uint8_t)(((table[i2] & 0x3) << 6) | table[i3]);
+    if (!isValid) return NO;
+
+    input += pieceLength;
+    length -= pieceLength;
+  }
+  return YES;
+}
+
+- (BOOL)appendBytes:(const void *)bytes length:(NSUInteger)length {
+  if (!isValid_) return NO;
+
+  const uint8_t *input = bytes;
+
+  // Complete the group begun by the previous bytes.
+  if (pendingLength_ > 0) {
+    NSUInteger numberOfBytes = MIN(4 - pendingLength_, length);
+    memcpy(pending_ + pendingLength_, input, numberOfBytes);
+    pendingLength_ += numberOfBytes;
+    input += numberOfBytes;
+    length -= numberOfBytes;
+    if (pendingLength_ < 4) return YES;
+
+    pendingLength_ = 0;
+    if (![self decodeQuads:pending_ length:4]) {
+      isValid_ = NO;
+      return NO;
     }
   }
 
-  return data;
+  NSUInteger wholeLength = length & ~(NSUInteger)3;
+  if (![self decodeQuads:input length:wholeLength]
+      || (hasPadding_ && length > wholeLength)) {
+    isValid_ = NO;
+    return NO;
+  }
+
+  pendingLength_ = length - wholeLength;
+  memcpy(pending_, input + wholeLength, pendingLength_);
+  return YES;
 }
 
-NSData *GTLDecodeBase64(NSString *base64Str) {
-  static char decodingTable[128];
-  static BOOL hasInited = NO;
+- (BOOL)appendData:(NSData *)data {
+  return [self appendBytes:data.bytes length:data.length];
+}
+
+- (BOOL)appendString:(NSString *)str {
+  if (!isValid_) return NO;
+
+  const char *cString = CFStringGetCStringPtr((CFStringRef)str,
+                                              kCFStringEncodingASCII);
+  NSUInteger length = str.length;
+  if (cString) {
+    return [self appendBytes:cString length:length];
+  }
 
-  if (!hasInited) {
-    CreateDecodingTable(gStandardEncodingTable, sizeof(gStandardEncodingTable),
-                        decodingTable);
-    hasInited = YES;
+  // Convert the string in pieces rather than copying all of it.
+  uint8_t buffer[4096];
+  NSRange remainingRange = NSMakeRange(0, length);
+  while (remainingRange.length > 0) {
+    NSUInteger usedLength = 0;
+    BOOL didConvert = [str getBytes:buffer
+                          maxLength:sizeof(buffer)
+                         usedLength:&usedLength
+                           encoding:NSASCIIStringEncoding
+                            options:0
+                              range:remainingRange
+                     remainingRange:&remainingRange];
+    if (!didConvert || usedLength == 0) {
+      // The string is not plain ASCII.
+      isValid_ = NO;
+      return NO;
+    }
+    if (![self appendBytes:buffer length:usedLength]) return NO;
   }
-  return DecodeBase64StringCommon(base64Str, decodingTable);
+  return YES;
 }
 
-NSData *GTLDecodeWebSafeBase64(NSString *base64Str) {
-  static char decodingTable[128];
-  static BOOL hasInited = NO;
+- (BOOL)finish {
+  if (!isValid_) return NO;
+
+  if (pendingLength_ > 0) {
+    // Input without padding may end with 2 or 3 characters.
+    uint8_t output[2];
+    NSUInteger outputLength = NSNotFound;
+    if (!hasPadding_) {
+      outputLength = DecodeFinalBase64Characters(pending_, pendingLength_,
+                                                 output, alphabet_);
+    }
+    pendingLength_ = 0;
+    if (outputLength == NSNotFound) {
+      isValid_ = NO;
+      return NO;
+    }
+    hasPadding_ = YES;
 
-  if (!hasInited) {
-    CreateDecodingTable(gWebSafeEncodingTable, sizeof(gWebSafeEncodingTable),
-                        decodingTable);
-    hasInited = YES;
+    if (fileHandle_) {
+      [fileHandle_ writeData:[NSData dataWithBytes:output
+                                            length:outputLength]];
+    } else {
+      [data_ appendBytes:output length:outputLength];
+    }
   }
-  return DecodeBase64StringCommon(base64Str, decodingTable);
+  return YES;
+}
+
+@end
+
+static NSData *DecodeBase64StringCommon(NSString *base64Str, BOOL isWebSafe) {
+  if (base64Str == nil) return nil;
+
+  NSUInteger length = base64Str.length;
+  if (length % 4 != 0) return nil;
+
+  NSMutableData *data = [NSMutableData dataWithCapacity:length / 4 * 3];
+  GTLBase64Decoder *decoder = [[GTLBase64Decoder alloc] initWithMutableData:data
+                                                                    webSafe:isWebSafe];
+  BOOL isValid = [decoder appendString:base64Str] && [decoder finish];
+  [decoder release];
+  return isValid ? data : nil;
+}
+
+NSData *GTLDecodeBase64(NSString *base64Str) {
+  return DecodeBase64StringCommon(base64Str, NO);
+}
+
+NSData *GTLDecodeWebSafeBase64(NSString *base64Str) {
+  return DecodeBase64StringCommon(base64Str, YES);
 }
@@ -17,8 +17,9 @@
 //  GTLJSONParser.h
 //
 
-// This class is a thin wrapper around the JSON parser.  It uses
-// NSJSONSerialization when available, and SBJSON otherwise.
+// This class is a thin wrapper around the JSON parser.  JSON is decoded by
+// a built-in decoder, and formatted with NSJSONSerialization when available,
+// and SBJSON otherwise.
 
 #import <Foundation/Foundation.h>
 
@@ -36,6 +37,91 @@
 + (id)objectWithString:(NSString *)jsonStr
                  error:(NSError **)error;
 
+// Returns mutable containers, as GTLObject requires.
 + (id)objectWithData:(NSData *)jsonData
                error:(NSError **)error;
+
+// Decodes into immutable containers when mutableContainers is NO, for JSON
+// which will only be read.  Numbers are parsed directly, strings are checked
+// to be valid UTF-8, and errors are reported the way NSJSONSerialization
+// reports them.
++ (id)objectWithData:(NSData *)jsonData
+   mutableContainers:(BOOL)mutableContainers
+               error:(NSError **)error;
+
+// Returns mutable containers backed by the JSON data rather than a fully
+// built object tree.  The JSON, including its strings and numbers, is
+// validated up front, and malformed JSON fails with the same error as
+// objectWithData:error:.  Each object's keys are indexed, and its values
+// created, only when the object is first accessed, and may be read from
+// several threads at once.  Modifying an object materializes its values.
+//
+// The returned containers retain the data, which must not be modified
+// afterwards.
++ (id)lazyObjectWithData:(NSData *)jsonData
+                   error:(NSError **)error;
+
+// Returns the same mutable containers as objectWithData:error:, decoding the
+// members of large objects and arrays on several threads.  This is faster
+// than objectWithData:error: for JSON of a megabyte or more.
++ (id)concurrentObjectWithData:(NSData *)jsonData
+                         error:(NSError **)error;
+
+// These check the operation for cancellation as decoding proceeds, and stop
+// soon after it is cancelled, returning nil with an NSUserCancelledError
+// error.
++ (id)objectWithData:(NSData *)jsonData
+           operation:(NSOperation *)operation
+               error:(NSError **)error;
++ (id)concurrentObjectWithData:(NSData *)jsonData
+                     operation:(NSOperation *)operation
+                         error:(NSError **)error;
+
+// The parsers return the interned instance for JSON keys and short string
+// values equal to an interned string, rather than allocating a new string
+// for every occurrence.  GTLObject interns the JSON keys of properties as
+// their methods are added and the kinds of registered classes, and
+// +[GTLService prepareObjectClasses] interns the API's constants.
+//
+// Interned strings are never released, so intern only strings that are
+// expected to recur.  internedString: returns the interned instance equal to
+// the string, interning it if needed.
++ (NSString *)internedString:(NSString *)str;
++ (void)internStrings:(NSArray *)strings;
+@end
+
+// GTLJSONStreamParser builds the same mutable container tree that
+// objectWithData:error: returns, but from data supplied in arbitrary chunks,
+// so parsing can proceed while a response is still downloading.
+//
+// Instances are not thread-safe; calls to appendData: and finishWithError:
+// must be serialized by the caller.
+@interface GTLJSONStreamParser : NSObject {
+ @private
+  NSMutableData *pendingData_;     // bytes of an incomplete trailing token
+  NSMutableArray *containerStack_; // open objects and arrays
+  NSString *pendingKey_;           // key awaiting its value
+  // How far the scan of a string token split across chunks got, so it
+  // resumes there rather than at the token's start.
+  NSUInteger pendingStringScanned_;
+  BOOL pendingStringHasEscapes_;
+  id rootObject_;
+  NSInteger state_;
+  NSError *error_;
+  unsigned long long consumedBytes_;
+  unsigned long long totalBytes_;
+}
+
+// Parses as much of the data as forms complete tokens, retaining only the
+// bytes of any token split across chunks.
+//
+// Returns NO once the data cannot be valid JSON; further data is ignored.
+- (BOOL)appendData:(NSData *)data;
+
+// Parses any remaining bytes and returns the top-level object, or returns nil
+// if the JSON is incomplete or malformed.
+- (id)finishWithError:(NSError **)error;
+
+@property (readonly, retain) NSError *error;
+@property (readonly) unsigned long long totalBytes;
 @end
@@ -17,6 +17,10 @@
 //  GTLJSONParser.m
 //
 
+#import <libkern/OSAtomic.h>
+#import <math.h>
+#import <pthread.h>
+
 #import "GTLJSONParser.h"
 
 // We can assume NSJSONSerialization is present on Mac OS X 10.7 and iOS 5
@@ -27,6 +31,12 @@
 #endif
 #endif
 
+// JSON is decoded by GTLJSONParser's own decoder unless this is defined as 0,
+// in which case NSJSONSerialization or SBJSON decodes it.
+#ifndef GTL_USE_NATIVE_JSON_DECODER
+#define GTL_USE_NATIVE_JSON_DECODER 1
+#endif
+
 // If GTMNSJSONSerialization is available, it is used for parsing and
 // formatting JSON
 #if !GTL_REQUIRES_NSJSONSERIALIZATION
@@ -43,8 +53,29 @@
 @end
 #endif // !GTL_REQUIRES_NSJSONSERIALIZATION
 
+static id NewLazyJSONObjectWithData(NSData *data, NSError **error);
+static id NewConcurrentJSONObjectWithData(NSData *data, NSOperation *operation,
+                                          NSError **error);
+static id NewJSONObjectWithData(NSData *data, BOOL mutableContainers,
+                                NSOperation *operation, NSError **error);
+static NSString *InternString(NSString *str);
+static NSError *JSONDecodingCancelledError(void);
+
 @implementation GTLJSONParser
 
++ (void)initialize {
+  if (self == [GTLJSONParser class]) {
+    // Keys common to most responses
+    NSArray *strings = @[ @"kind", @"id", @"etag", @"selfLink", @"items",
+                          @"nextPageToken", @"mimeType", @"title", @"name",
+                          @"description", @"created", @"updated", @"type",
+                          @"value", @"data", @"result", @"error", @"code",
+                          @"message", @"errors", @"domain", @"reason",
+                          @"jsonrpc", @"2.0" ];
+    [self internStrings:strings];
+  }
+}
+
 #if DEBUG && !GTL_REQUIRES_NSJSONSERIALIZATION
 // When compiling for iOS 4 compatibility, SBJSON must be available
 + (void)load {
@@ -117,7 +148,11 @@
 
 + (id)objectWithData:(NSData *)jsonData
                error:(NSError **)error {
-#if GTL_REQUIRES_NSJSONSERIALIZATION
+#if GTL_USE_NATIVE_JSON_DECODER
+  return [self objectWithData:jsonData
+            mutableContainers:YES
+                        error:error];
+#elif GTL_REQUIRES_NSJSONSERIALIZATION
   NSMutableDictionary *obj = [NSJSONSerialization JSONObjectWithData:jsonData
                                                              options:NSJSONReadingMutableContainers
                                                                error:error];
@@ -149,4 +184,2110 @@
 #endif
 }
 
++ (id)objectWithData:(NSData *)jsonData
+   mutableContainers:(BOOL)mutableContainers
+               error:(NSError **)error {
+  return [NewJSONObjectWithData(jsonData, mutableContainers, nil, error) autorelease];
+}
+
++ (id)objectWithData:(NSData *)jsonData
+           operation:(NSOperation *)operation
+               error:(NSError **)error {
+#if GTL_USE_NATIVE_JSON_DECODER
+  return [NewJSONObjectWithData(jsonData, YES, operation, error) autorelease];
+#else
+  id obj = [self objectWithData:jsonData
+                          error:error];
+  if (operation.isCancelled) {
+    if (error) *error = JSONDecodingCancelledError();
+    return nil;
+  }
+  return obj;
+#endif
+}
+
++ (id)lazyObjectWithData:(NSData *)jsonData
+                   error:(NSError **)error {
+  return [NewLazyJSONObjectWithData(jsonData, error) autorelease];
+}
+
++ (id)concurrentObjectWithData:(NSData *)jsonData
+                         error:(NSError **)error {
+  return [self concurrentObjectWithData:jsonData
+                              operation:nil
+                                  error:error];
+}
+
++ (id)concurrentObjectWithData:(NSData *)jsonData
+                     operation:(NSOperation *)operation
+                         error:(NSError **)error {
+  return [NewConcurrentJSONObjectWithData(jsonData, operation, error) autorelease];
+}
+
++ (NSString *)internedString:(NSString *)str {
+  if (str == nil) return nil;
+
+  return InternString(str);
+}
+
++ (void)internStrings:(NSArray *)strings {
+  for (NSString *str in strings) {
+    InternString(str);
+  }
+}
+
+@end
+
+#pragma mark -
+
+typedef NS_ENUM(NSInteger, GTLJSONStreamState) {
+  kGTLJSONStreamStateRoot = 0,     // expecting the top-level object or array
+  kGTLJSONStreamStateArrayFirst,   // after '[': a value or ']'
+  kGTLJSONStreamStateArrayValue,   // after ',' in an array: a value
+  kGTLJSONStreamStateArrayNext,    // after an array value: ',' or ']'
+  kGTLJSONStreamStateObjectFirst,  // after '{': a key or '}'
+  kGTLJSONStreamStateObjectKey,    // after ',' in an object: a key
+  kGTLJSONStreamStateObjectColon,  // after a key: ':'
+  kGTLJSONStreamStateObjectValue,  // after ':': a value
+  kGTLJSONStreamStateObjectNext,   // after an object value: ',' or '}'
+  kGTLJSONStreamStateDone
+};
+
+// Nesting beyond this is treated as malformed, to bound the recursion.
+static const NSUInteger kMaxJSONDepth = 512;
+
+static BOOL IsJSONWhitespace(unsigned char c) {
+  return (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+}
+
+static int HexDigitValue(unsigned char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Reads the four hex digits of a \u escape, returning -1 if they are invalid.
+static long UnicodeEscapeValue(const unsigned char *bytes) {
+  long value = 0;
+  for (int i = 0; i < 4; i++) {
+    int digit = HexDigitValue(bytes[i]);
+    if (digit < 0) return -1;
+    value = (value << 4) | digit;
+  }
+  return value;
+}
+
+static size_t AppendUTF8(unsigned char *buffer, unsigned long codePoint) {
+  if (codePoint < 0x80) {
+    buffer[0] = (unsigned char)codePoint;
+    return 1;
+  } else if (codePoint < 0x800) {
+    buffer[0] = (unsigned char)(0xC0 | (codePoint >> 6));
+    buffer[1] = (unsigned char)(0x80 | (codePoint & 0x3F));
+    return 2;
+  } else if (codePoint < 0x10000) {
+    buffer[0] = (unsigned char)(0xE0 | (codePoint >> 12));
+    buffer[1] = (unsigned char)(0x80 | ((codePoint >> 6) & 0x3F));
+    buffer[2] = (unsigned char)(0x80 | (codePoint & 0x3F));
+    return 3;
+  } else {
+    buffer[0] = (unsigned char)(0xF0 | (codePoint >> 18));
+    buffer[1] = (unsigned char)(0x80 | ((codePoint >> 12) & 0x3F));
+    buffer[2] = (unsigned char)(0x80 | ((codePoint >> 6) & 0x3F));
+    buffer[3] = (unsigned char)(0x80 | (codePoint & 0x3F));
+    return 4;
+  }
+}
+
+#pragma mark Interned strings
+
+// The interned strings are kept in an open-addressed hash table keyed by
+// their UTF-8 bytes, so the parsers can find a string before creating one.
+// Strings are added but never removed.
+
+// Longer strings are unlikely to be keys or enumerated values.
+static const NSUInteger kMaxInternedStringLength = 64;
+
+typedef struct {
+  uint32_t hash;
+  uint32_t length;
+  char *bytes;
+  NSString *string;  // nil for an empty slot
+} GTLInternedString;
+
+static GTLInternedString *gInternedStrings = NULL;
+static NSUInteger gInternedStringsCount = 0;
+static NSUInteger gInternedStringsCapacity = 0;  // zero or a power of two
+static pthread_rwlock_t gInternedStringsLock = PTHREAD_RWLOCK_INITIALIZER;
+
+static uint32_t HashStringBytes(const unsigned char *bytes, NSUInteger length) {
+  // FNV-1a
+  uint32_t hash = 2166136261U;
+  for (NSUInteger idx = 0; idx < length; idx++) {
+    hash ^= bytes[idx];
+    hash *= 16777619U;
+  }
+  return hash;
+}
+
+// Returns the slot holding the string with the bytes, or the empty slot where
+// it belongs, or NULL if the table has no slots.
+//
+// Must be called with the lock held.
+static GTLInternedString *InternedStringSlot(const unsigned char *bytes,
+                                             NSUInteger length,
+                                             uint32_t hash) {
+  if (gInternedStringsCapacity == 0) return NULL;
+
+  // The table is kept at most half full, so there is always an empty slot.
+  NSUInteger mask = gInternedStringsCapacity - 1;
+  for (NSUInteger idx = hash & mask; ; idx = (idx + 1) & mask) {
+    GTLInternedString *slot = &gInternedStrings[idx];
+    if (slot->string == nil
+        || (slot->hash == hash
+            && slot->length == length
+            && memcmp(slot->bytes, bytes, length) == 0)) {
+      return slot;
+    }
+  }
+}
+
+// Returns the interned string for the bytes, retained, or nil.
+static NSString *NewInternedStringForBytes(const unsigned char *bytes,
+                                           NSUInteger length,
+                                           uint32_t hash) {
+  NSString *result = nil;
+  pthread_rwlock_rdlock(&gInternedStringsLock);
+  GTLInternedString *slot = InternedStringSlot(bytes, length, hash);
+  if (slot != NULL) {
+    result = [slot->string retain];
+  }
+  pthread_rwlock_unlock(&gInternedStringsLock);
+  return result;
+}
+
+// Must be called with the lock held for writing.
+static BOOL GrowInternedStrings(void) {
+  NSUInteger oldCapacity = gInternedStringsCapacity;
+  NSUInteger newCapacity = (oldCapacity == 0) ? 256 : oldCapacity * 2;
+  GTLInternedString *newStrings = calloc(newCapacity, sizeof(GTLInternedString));
+  if (newStrings == NULL) return NO;
+
+  GTLInternedString *oldStrings = gInternedStrings;
+  gInternedStrings = newStrings;
+  gInternedStringsCapacity = newCapacity;
+  for (NSUInteger idx = 0; idx < oldCapacity; idx++) {
+    GTLInternedString *oldSlot = &oldStrings[idx];
+    if (oldSlot->string != nil) {
+      *InternedStringSlot((const unsigned char *)oldSlot->bytes,
+                          oldSlot->length, oldSlot->hash) = *oldSlot;
+    }
+  }
+  free(oldStrings);
+  return YES;
+}
+
+static NSString *InternString(NSString *str) {
+  // The key is all of the string's bytes, including any NULs.
+  NSData *utf8Data = [str dataUsingEncoding:NSUTF8StringEncoding];
+  if (utf8Data == nil) return str;
+
+  const unsigned char *utf8 = utf8Data.bytes;
+  NSUInteger length = utf8Data.length;
+  if (length > kMaxInternedStringLength) return str;
+
+  uint32_t hash = HashStringBytes(utf8, length);
+
+  NSString *result = str;
+  pthread_rwlock_wrlock(&gInternedStringsLock);
+  BOOL hasRoom = ((gInternedStringsCount + 1) * 2 <= gInternedStringsCapacity
+                  || GrowInternedStrings());
+  GTLInternedString *slot = InternedStringSlot(utf8, length, hash);
+  if (slot != NULL && slot->string != nil) {
+    result = slot->string;
+  } else if (slot != NULL && hasRoom) {
+    char *bytes = malloc(length > 0 ? length : 1);
+    if (bytes != NULL) {
+      memcpy(bytes, utf8, length);
+      slot->hash = hash;
+      slot->length = (uint32_t)length;
+      slot->bytes = bytes;
+      slot->string = [str copy];
+      gInternedStringsCount++;
+      result = slot->string;
+    }
+  }
+  pthread_rwlock_unlock(&gInternedStringsLock);
+  return result;
+}
+
+#pragma mark String and number tokens
+
+// The stream, lazy, and native parsers all scan string and number tokens
+// with these, so each accepts exactly the JSON that the others do.
+
+typedef NS_ENUM(NSInteger, GTLJSONTokenStatus) {
+  kGTLJSONTokenValid = 0,
+  kGTLJSONTokenIncomplete,  // the bytes end before the token does
+  kGTLJSONTokenInvalid
+};
+
+// Returns the error that NSJSONSerialization reports for malformed JSON.
+static NSError *JSONCorruptError(NSString *description) {
+  NSDictionary *userInfo = @{ @"NSDebugDescription" : description };
+  return [NSError errorWithDomain:NSCocoaErrorDomain
+                             code:NSPropertyListReadCorruptError
+                         userInfo:userInfo];
+}
+
+// Scanning strings a word at a time: these report whether any of the eight
+// bytes of a word is zero, or less than n (for n <= 128).
+static const uint64_t kJSONWordOnes = 0x0101010101010101ULL;
+static const uint64_t kJSONWordHighBits = 0x8080808080808080ULL;
+
+static inline uint64_t WordHasZeroByte(uint64_t word) {
+  return (word - kJSONWordOnes) & ~word & kJSONWordHighBits;
+}
+
+static inline uint64_t WordHasByteLessThan(uint64_t word, uint64_t n) {
+  return (word - kJSONWordOnes * n) & ~word & kJSONWordHighBits;
+}
+
+// Whether the word has a byte that ends the string, starts an escape, must
+// have been escaped, or is not ASCII.
+static inline BOOL WordNeedsStringScan(uint64_t word) {
+  return (WordHasZeroByte(word ^ (kJSONWordOnes * '"'))
+          | WordHasZeroByte(word ^ (kJSONWordOnes * '\\'))
+          | WordHasByteLessThan(word, 0x20)
+          | (word & kJSONWordHighBits)) != 0;
+}
+
+// Returns the length of the UTF-8 sequence which the byte leads, or zero if
+// it cannot lead one.
+static NSUInteger UTF8LeadByteLength(unsigned char lead) {
+  if (lead >= 0xC2 && lead <= 0xDF) return 2;
+  if (lead >= 0xE0 && lead <= 0xEF) return 3;
+  if (lead >= 0xF0 && lead <= 0xF4) return 4;
+  return 0;
+}
+
+// Returns the length of the well-formed UTF-8 sequence at the bytes, or zero
+// for an invalid, overlong, or surrogate sequence.
+static NSUInteger UTF8SequenceLength(const unsigned char *bytes,
+                                     NSUInteger available) {
+  unsigned char lead = bytes[0];
+  NSUInteger length = UTF8LeadByteLength(lead);
+  if (length == 0 || length > available) return 0;
+
+  unsigned char minSecond = 0x80, maxSecond = 0xBF;
+  if (lead == 0xE0) minSecond = 0xA0;
+  if (lead == 0xED) maxSecond = 0x9F;
+  if (lead == 0xF0) minSecond = 0x90;
+  if (lead == 0xF4) maxSecond = 0x8F;
+  if (bytes[1] < minSecond || bytes[1] > maxSecond) return 0;
+  for (NSUInteger idx = 2; idx < length; idx++) {
+    if ((bytes[idx] & 0xC0) != 0x80) return 0;
+  }
+  return length;
+}
+
+// Whether the escape starting at the backslash is valid.  The bytes must
+// extend to the end of a \u escape.
+static BOOL IsValidJSONEscape(const unsigned char *escape) {
+  switch (escape[1]) {
+    case '"':
+    case '\\':
+    case '/':
+    case 'b':
+    case 'f':
+    case 'n':
+    case 'r':
+    case 't':
+      return YES;
+    case 'u':
+      return (UnicodeEscapeValue(escape + 2) >= 0);
+    default:
+      return NO;
+  }
+}
+
+// The progress of a string token's scan.  A scan stopped by the end of the
+// bytes resumes where it stopped once more bytes follow.
+typedef struct {
+  NSUInteger idx;  // the next byte to scan
+  BOOL hasEscapes;
+  BOOL isASCII;
+} GTLJSONStringScan;
+
+static void BeginJSONStringScan(GTLJSONStringScan *scan,
+                                NSUInteger openingQuote) {
+  scan->idx = openingQuote + 1;
+  scan->hasEscapes = NO;
+  scan->isASCII = YES;
+}
+
+// Scans a string token up to its closing quote, checking its escapes, that
+// its control characters are escaped, and that it is well-formed UTF-8.
+//
+// When the token is valid, scan->idx is left at the closing quote, and when
+// it is invalid, at the offending byte.  When the bytes end first, scan->idx
+// is left at the start of any escape or UTF-8 sequence they cut short.
+static GTLJSONTokenStatus ScanJSONString(const unsigned char *bytes,
+                                         NSUInteger length,
+                                         GTLJSONStringScan *scan) {
+  NSUInteger idx = scan->idx;
+  GTLJSONTokenStatus status = kGTLJSONTokenIncomplete;
+  while (status == kGTLJSONTokenIncomplete) {
+    // Skip ordinary characters eight at a time.
+    while (idx + sizeof(uint64_t) <= length) {
+      uint64_t word;
+      memcpy(&word, bytes + idx, sizeof(word));
+      if (WordNeedsStringScan(word)) break;
+      idx += sizeof(word);
+    }
+    if (idx >= length) break;
+
+    unsigned char c = bytes[idx];
+    if (c == '"') {
+      status = kGTLJSONTokenValid;
+    } else if (c == '\\') {
+      NSUInteger escapeLength =
+        (idx + 1 < length && bytes[idx + 1] == 'u') ? 6 : 2;
+      if (idx + escapeLength > length) break;
+      if (!IsValidJSONEscape(bytes + idx)) {
+        status = kGTLJSONTokenInvalid;
+      } else {
+        scan->hasEscapes = YES;
+        idx += escapeLength;
+      }
+    } else if (c < 0x20) {
+      status = kGTLJSONTokenInvalid;
+    } else if (c >= 0x80) {
+      NSUInteger sequenceLength = UTF8SequenceLength(bytes + idx, length - idx);
+      if (sequenceLength > 0) {
+        scan->isASCII = NO;
+        idx += sequenceLength;
+      } else if (idx + UTF8LeadByteLength(c) <= length) {
+        status = kGTLJSONTokenInvalid;
+      } else {
+        break;
+      }
+    } else {
+      idx++;
+    }
+  }
+  scan->idx = idx;
+  return status;
+}
+
+// Describes why ScanJSONString found the byte at the index invalid.
+static NSString *JSONStringFailureReason(const unsigned char *bytes,
+                                         NSUInteger idx) {
+  unsigned char c = bytes[idx];
+  if (c == '\\') return @"Invalid escape";
+  if (c < 0x20) return @"Unescaped control character";
+  return @"Invalid UTF-8";
+}
+
+// Returns a new string for the contents of a JSON string token, excluding
+// the quotes, or nil if the escapes or the UTF-8 are invalid.
+static NSString *NewStringForJSONStringBytes(const unsigned char *bytes,
+                                             NSUInteger length,
+                                             BOOL hasEscapes) {
+  if (!hasEscapes) {
+    if (length <= kMaxInternedStringLength) {
+      NSString *interned =
+        NewInternedStringForBytes(bytes, length, HashStringBytes(bytes, length));
+      if (interned != nil) return interned;
+    }
+    return [[NSString alloc] initWithBytes:bytes
+                                    length:length
+                                  encoding:NSUTF8StringEncoding];
+  }
+
+  // Unescaped UTF-8 is never longer than the escaped form.
+  unsigned char *buffer = malloc(length > 0 ? length : 1);
+  if (buffer == NULL) return nil;
+
+  size_t outLength = 0;
+  NSUInteger idx = 0;
+  while (idx < length) {
+    unsigned char c = bytes[idx];
+    if (c != '\\') {
+      buffer[outLength++] = c;
+      idx++;
+      continue;
+    }
+    if (idx + 1 >= length) goto fail;
+
+    unsigned char escaped = bytes[idx + 1];
+    idx += 2;
+    switch (escaped) {
+      case '"':  buffer[outLength++] = '"';  break;
+      case '\\': buffer[outLength++] = '\\'; break;
+      case '/':  buffer[outLength++] = '/';  break;
+      case 'b':  buffer[outLength++] = '\b'; break;
+      case 'f':  buffer[outLength++] = '\f'; break;
+      case 'n':  buffer[outLength++] = '\n'; break;
+      case 'r':  buffer[outLength++] = '\r'; break;
+      case 't':  buffer[outLength++] = '\t'; break;
+      case 'u': {
+        if (idx + 4 > length) goto fail;
+        long codePoint = UnicodeEscapeValue(bytes + idx);
+        if (codePoint < 0) goto fail;
+        idx += 4;
+
+        if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+          // A high surrogate should be followed by an escaped low surrogate.
+          long lowSurrogate = -1;
+          if (idx + 6 <= length && bytes[idx] == '\\' && bytes[idx + 1] == 'u') {
+            lowSurrogate = UnicodeEscapeValue(bytes + idx + 2);
+          }
+          if (lowSurrogate >= 0xDC00 && lowSurrogate <= 0xDFFF) {
+            codePoint = 0x10000 + ((codePoint - 0xD800) << 10)
+                        + (lowSurrogate - 0xDC00);
+            idx += 6;
+          } else {
+            codePoint = 0xFFFD;
+          }
+        } else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+          codePoint = 0xFFFD;
+        }
+        outLength += AppendUTF8(buffer + outLength, (unsigned long)codePoint);
+        break;
+      }
+      default:
+        goto fail;
+    }
+  }
+
+  NSString *result = [[NSString alloc] initWithBytesNoCopy:buffer
+                                                    length:outLength
+                                                  encoding:NSUTF8StringEncoding
+                                              freeWhenDone:YES];
+  if (result == nil) {
+    free(buffer);
+  }
+  return result;
+
+fail:
+  free(buffer);
+  return nil;
+}
+
+// Powers of ten which doubles represent exactly.
+static const double kExactPowersOfTen[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static BOOL IsDigit(unsigned char c) {
+  return (c >= '0' && c <= '9');
+}
+
+
+// The parts of a number token found by ScanJSONNumber.
+typedef struct {
+  NSUInteger start;
+  NSUInteger end;                     // just past the token
+  uint64_t mantissa;                  // up to 19 digits of the integer and
+                                      // fraction parts
+  NSUInteger numberOfDigits;
+  NSUInteger numberOfFractionDigits;  // of those in the mantissa
+  long exponent;
+  BOOL isNegative;
+  BOOL isInteger;
+} GTLJSONNumberScan;
+
+// Scans the number token starting at idx, returning NO if it does not match
+// JSON's grammar for numbers, which excludes leading zeros and a leading '+'.
+//
+// scan->end is left just past the token, or at the offending byte.  A token
+// cut short by the end of the bytes leaves scan->end at the length, so a
+// caller expecting more bytes should wait for them in that case.
+static BOOL ScanJSONNumber(const unsigned char *bytes, NSUInteger idx,
+                           NSUInteger length, GTLJSONNumberScan *scan) {
+  memset(scan, 0, sizeof(*scan));
+  scan->start = idx;
+  scan->isInteger = YES;
+
+  scan->isNegative = (idx < length && bytes[idx] == '-');
+  if (scan->isNegative) idx++;
+  if (idx >= length || !IsDigit(bytes[idx])) goto fail;
+
+  if (bytes[idx] == '0') {
+    idx++;
+    scan->numberOfDigits = 1;
+  } else {
+    while (idx < length && IsDigit(bytes[idx])) {
+      if (scan->numberOfDigits < 19) {
+        scan->mantissa = scan->mantissa * 10 + (bytes[idx] - '0');
+      }
+      scan->numberOfDigits++;
+      idx++;
+    }
+  }
+
+  if (idx < length && bytes[idx] == '.') {
+    scan->isInteger = NO;
+    idx++;
+    if (idx >= length || !IsDigit(bytes[idx])) goto fail;
+    while (idx < length && IsDigit(bytes[idx])) {
+      if (scan->numberOfDigits < 19) {
+        scan->mantissa = scan->mantissa * 10 + (bytes[idx] - '0');
+        scan->numberOfFractionDigits++;
+      }
+      scan->numberOfDigits++;
+      idx++;
+    }
+  }
+
+  if (idx < length && (bytes[idx] == 'e' || bytes[idx] == 'E')) {
+    scan->isInteger = NO;
+    idx++;
+    BOOL isExponentNegative = NO;
+    if (idx < length && (bytes[idx] == '+' || bytes[idx] == '-')) {
+      isExponentNegative = (bytes[idx] == '-');
+      idx++;
+    }
+    if (idx >= length || !IsDigit(bytes[idx])) goto fail;
+    while (idx < length && IsDigit(bytes[idx])) {
+      if (scan->exponent < 100000) {
+        scan->exponent = scan->exponent * 10 + (bytes[idx] - '0');
+      }
+      idx++;
+    }
+    if (isExponentNegative) scan->exponent = -scan->exponent;
+  }
+  scan->end = idx;
+  return YES;
+
+fail:
+  scan->end = idx;
+  return NO;
+}
+
+// Returns a new number for a JSON number token, or nil if it is malformed.
+static NSNumber *NewNumberForJSONNumberBytes(const unsigned char *bytes,
+                                             NSUInteger length) {
+  char stackBuffer[64];
+  char *str = (length < sizeof(stackBuffer)) ? stackBuffer : malloc(length + 1);
+  if (str == NULL) return nil;
+  memcpy(str, bytes, length);
+  str[length] = '\0';
+
+  BOOL isInteger = YES;
+  for (NSUInteger idx = 0; idx < length; idx++) {
+    char c = str[idx];
+    if (c == '.' || c == 'e' || c == 'E') {
+      isInteger = NO;
+      break;
+    }
+  }
+
+  NSNumber *result = nil;
+  char *end = NULL;
+  if (isInteger) {
+    errno = 0;
+    long long value = strtoll(str, &end, 10);
+    if (errno != ERANGE) {
+      if (end == str + length) {
+        result = [[NSNumber alloc] initWithLongLong:value];
+      }
+    } else if (str[0] != '-') {
+      errno = 0;
+      unsigned long long uvalue = strtoull(str, &end, 10);
+      if (errno != ERANGE && end == str + length) {
+        result = [[NSNumber alloc] initWithUnsignedLongLong:uvalue];
+      }
+    }
+  }
+  if (result == nil) {
+    // As with NSJSONSerialization, a number too large for a double is
+    // invalid.
+    double value = strtod(str, &end);
+    if (end == str + length && length > 0 && isfinite(value)) {
+      result = [[NSNumber alloc] initWithDouble:value];
+    }
+  }
+
+  if (str != stackBuffer) {
+    free(str);
+  }
+  return result;
+}
+
+// Returns a new number for a token which ScanJSONNumber found valid.
+static NSNumber *NewNumberForJSONNumberScan(const unsigned char *bytes,
+                                            const GTLJSONNumberScan *scan) {
+  if (scan->isInteger && scan->numberOfDigits <= 18) {
+    long long value = (long long)scan->mantissa;
+    return [[NSNumber alloc] initWithLongLong:(scan->isNegative ? -value : value)];
+  }
+
+  // A double is exact when both the mantissa and the power of ten are, so
+  // the result is correctly rounded without strtod.
+  long power = scan->exponent - (long)scan->numberOfFractionDigits;
+  if (!scan->isInteger && scan->numberOfDigits <= 15
+      && power >= -22 && power <= 22) {
+    double value = (double)scan->mantissa;
+    if (power < 0) {
+      value /= kExactPowersOfTen[-power];
+    } else {
+      value *= kExactPowersOfTen[power];
+    }
+    return [[NSNumber alloc] initWithDouble:(scan->isNegative ? -value : value)];
+  }
+
+  // Long integers and other doubles.
+  return NewNumberForJSONNumberBytes(bytes + scan->start,
+                                     scan->end - scan->start);
+}
+
+@implementation GTLJSONStreamParser
+
+@synthesize error = error_,
+            totalBytes = totalBytes_;
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    pendingData_ = [[NSMutableData alloc] init];
+    containerStack_ = [[NSMutableArray alloc] init];
+    state_ = kGTLJSONStreamStateRoot;
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [pendingData_ release];
+  [containerStack_ release];
+  [pendingKey_ release];
+  [rootObject_ release];
+  [error_ release];
+  [super dealloc];
+}
+
+- (void)failWithReason:(NSString *)reason atOffset:(NSUInteger)offset {
+  if (error_ != nil) return;
+
+  NSString *desc = [NSString stringWithFormat:@"%@ around character %llu.",
+                    reason, consumedBytes_ + offset];
+  error_ = [JSONCorruptError(desc) retain];
+
+  // Drop the partial tree now rather than when the parser is released.
+  [containerStack_ removeAllObjects];
+  [rootObject_ release];
+  rootObject_ = nil;
+}
+
+- (BOOL)isExpectingValue {
+  return (state_ == kGTLJSONStreamStateArrayFirst
+          || state_ == kGTLJSONStreamStateArrayValue
+          || state_ == kGTLJSONStreamStateObjectValue);
+}
+
+// Adds a value to the innermost open container, or makes it the root.
+- (void)addValue:(id)value {
+  switch (state_) {
+    case kGTLJSONStreamStateRoot:
+      rootObject_ = [value retain];
+      state_ = kGTLJSONStreamStateDone;
+      break;
+    case kGTLJSONStreamStateArrayFirst:
+    case kGTLJSONStreamStateArrayValue:
+      [(NSMutableArray *)containerStack_.lastObject addObject:value];
+      state_ = kGTLJSONStreamStateArrayNext;
+      break;
+    case kGTLJSONStreamStateObjectValue:
+      [(NSMutableDictionary *)containerStack_.lastObject setObject:value
+                                                            forKey:pendingKey_];
+      [pendingKey_ release];
+      pendingKey_ = nil;
+      state_ = kGTLJSONStreamStateObjectNext;
+      break;
+    default:
+      GTL_DEBUG_ASSERT(0, @"unexpected state %ld", (long)state_);
+      break;
+  }
+}
+
+- (void)closeContainer {
+  [containerStack_ removeLastObject];
+
+  id parent = containerStack_.lastObject;
+  if (parent == nil) {
+    state_ = kGTLJSONStreamStateDone;
+  } else if ([parent isKindOfClass:[NSDictionary class]]) {
+    state_ = kGTLJSONStreamStateObjectNext;
+  } else {
+    state_ = kGTLJSONStreamStateArrayNext;
+  }
+}
+
+// Parses complete tokens from the bytes, and returns the number of bytes
+// consumed.  Unless isFinal is set, parsing stops at a token that may
+// continue in the next chunk.
+- (NSUInteger)parseBytes:(const unsigned char *)bytes
+                  length:(NSUInteger)length
+                 isFinal:(BOOL)isFinal {
+  NSUInteger idx = 0;
+  if (consumedBytes_ == 0 && state_ == kGTLJSONStreamStateRoot) {
+    // Skip a byte order mark at the start of the stream, as the other
+    // decoders do; the mark itself may be split between chunks.
+    NSUInteger markLength = MIN(length, (NSUInteger)3);
+    if (markLength > 0 && memcmp(bytes, "\xEF\xBB\xBF", markLength) == 0) {
+      if (markLength == 3) {
+        idx = 3;
+      } else if (!isFinal) {
+        return 0;
+      }
+    }
+  }
+  while (idx < length && error_ == nil) {
+    unsigned char c = bytes[idx];
+    if (IsJSONWhitespace(c)) {
+      idx++;
+      continue;
+    }
+
+    if (state_ == kGTLJSONStreamStateDone) {
+      [self failWithReason:@"Garbage at end" atOffset:idx];
+      break;
+    }
+
+    if (state_ == kGTLJSONStreamStateRoot && c != '{' && c != '[') {
+      [self failWithReason:@"JSON text did not start with array or object"
+                  atOffset:idx];
+      break;
+    }
+
+    switch (c) {
+      case '{':
+      case '[': {
+        if (state_ != kGTLJSONStreamStateRoot && ![self isExpectingValue]) {
+          [self failWithReason:@"Unexpected container" atOffset:idx];
+          break;
+        }
+        BOOL isObject = (c == '{');
+        id container = isObject ? [[NSMutableDictionary alloc] init]
+                                : [[NSMutableArray alloc] init];
+        [self addValue:container];
+        [containerStack_ addObject:container];
+        [container release];
+        state_ = isObject ? kGTLJSONStreamStateObjectFirst
+                          : kGTLJSONStreamStateArrayFirst;
+        idx++;
+        break;
+      }
+
+      case '}':
+        if (state_ != kGTLJSONStreamStateObjectFirst
+            && state_ != kGTLJSONStreamStateObjectNext) {
+          [self failWithReason:@"Unexpected '}'" atOffset:idx];
+          break;
+        }
+        [self closeContainer];
+        idx++;
+        break;
+
+      case ']':
+        if (state_ != kGTLJSONStreamStateArrayFirst
+            && state_ != kGTLJSONStreamStateArrayNext) {
+          [self failWithReason:@"Unexpected ']'" atOffset:idx];
+          break;
+        }
+        [self closeContainer];
+        idx++;
+        break;
+
+      case ':':
+        if (state_ != kGTLJSONStreamStateObjectColon) {
+          [self failWithReason:@"Unexpected ':'" atOffset:idx];
+          break;
+        }
+        state_ = kGTLJSONStreamStateObjectValue;
+        idx++;
+        break;
+
+      case ',':
+        if (state_ == kGTLJSONStreamStateArrayNext) {
+          state_ = kGTLJSONStreamStateArrayValue;
+        } else if (state_ == kGTLJSONStreamStateObjectNext) {
+          state_ = kGTLJSONStreamStateObjectKey;
+        } else {
+          [self failWithReason:@"Unexpected ','" atOffset:idx];
+          break;
+        }
+        idx++;
+        break;
+
+      case '"': {
+        BOOL isKey = (state_ == kGTLJSONStreamStateObjectFirst
+                      || state_ == kGTLJSONStreamStateObjectKey);
+        if (!isKey && ![self isExpectingValue]) {
+          [self failWithReason:@"Unexpected string" atOffset:idx];
+          break;
+        }
+
+        // A string split across chunks is the first token of the pending
+        // bytes, and its scan resumes where the previous chunk ended.
+        GTLJSONStringScan scan;
+        BeginJSONStringScan(&scan, idx);
+        if (idx == 0 && pendingStringScanned_ > 0) {
+          scan.idx = pendingStringScanned_;
+          scan.hasEscapes = pendingStringHasEscapes_;
+        }
+        pendingStringScanned_ = 0;
+
+        GTLJSONTokenStatus status = ScanJSONString(bytes, length, &scan);
+        if (status == kGTLJSONTokenInvalid) {
+          [self failWithReason:JSONStringFailureReason(bytes, scan.idx)
+                      atOffset:scan.idx];
+          break;
+        }
+        if (status == kGTLJSONTokenIncomplete) {
+          // The string continues in the next chunk.
+          if (isFinal) {
+            [self failWithReason:@"Unterminated string" atOffset:idx];
+          } else {
+            pendingStringScanned_ = scan.idx - idx;
+            pendingStringHasEscapes_ = scan.hasEscapes;
+          }
+          return idx;
+        }
+        NSUInteger end = scan.idx;
+
+        NSString *str = NewStringForJSONStringBytes(bytes + idx + 1,
+                                                    end - idx - 1,
+                                                    scan.hasEscapes);
+        if (str == nil) {
+          [self failWithReason:@"Invalid string" atOffset:idx];
+          break;
+        }
+        if (isKey) {
+          pendingKey_ = str;
+          state_ = kGTLJSONStreamStateObjectColon;
+        } else {
+          [self addValue:str];
+          [str release];
+        }
+        idx = end + 1;
+        break;
+      }
+
+      case 't':
+      case 'f':
+      case 'n': {
+        const char *literal = (c == 't') ? "true" : ((c == 'f') ? "false" : "null");
+        NSUInteger literalLength = strlen(literal);
+        if (idx + literalLength > length) {
+          if (isFinal) {
+            [self failWithReason:@"Unexpected end of literal" atOffset:idx];
+          }
+          return idx;
+        }
+        if (![self isExpectingValue]
+            || memcmp(bytes + idx, literal, literalLength) != 0) {
+          [self failWithReason:@"Invalid literal" atOffset:idx];
+          break;
+        }
+        id value;
+        if (c == 'n') {
+          value = [NSNull null];
+        } else {
+          value = (c == 't') ? (id)kCFBooleanTrue : (id)kCFBooleanFalse;
+        }
+        [self addValue:value];
+        idx += literalLength;
+        break;
+      }
+
+      default: {
+        if (c != '-' && !(c >= '0' && c <= '9')) {
+          [self failWithReason:@"Invalid value" atOffset:idx];
+          break;
+        }
+        if (![self isExpectingValue]) {
+          [self failWithReason:@"Unexpected number" atOffset:idx];
+          break;
+        }
+        GTLJSONNumberScan scan;
+        BOOL isValid = ScanJSONNumber(bytes, idx, length, &scan);
+        if (scan.end == length && !isFinal) {
+          // More digits may arrive in the next chunk.
+          return idx;
+        }
+        NSNumber *number = nil;
+        if (isValid) {
+          number = NewNumberForJSONNumberScan(bytes, &scan);
+        }
+        if (number == nil) {
+          [self failWithReason:@"Invalid number" atOffset:scan.end];
+          break;
+        }
+        [self addValue:number];
+        [number release];
+        idx = scan.end;
+        break;
+      }
+    }
+  }
+  return idx;
+}
+
+- (BOOL)appendData:(NSData *)data {
+  NSUInteger dataLength = data.length;
+  if (error_ != nil || dataLength == 0) return (error_ == nil);
+
+  totalBytes_ += dataLength;
+
+  NSUInteger consumed;
+  if (pendingData_.length == 0) {
+    // Parse directly from the chunk, saving only an incomplete last token.
+    consumed = [self parseBytes:data.bytes
+                         length:dataLength
+                        isFinal:NO];
+    if (error_ == nil && consumed < dataLength) {
+      [pendingData_ appendBytes:(const unsigned char *)data.bytes + consumed
+                         length:dataLength - consumed];
+    }
+  } else {
+    [pendingData_ appendData:data];
+    consumed = [self parseBytes:pendingData_.bytes
+                         length:pendingData_.length
+                        isFinal:NO];
+    [pendingData_ replaceBytesInRange:NSMakeRange(0, consumed)
+                            withBytes:NULL
+                               length:0];
+  }
+  consumedBytes_ += consumed;
+  return (error_ == nil);
+}
+
+- (id)finishWithError:(NSError **)error {
+  if (error_ == nil) {
+    NSUInteger length = pendingData_.length;
+    NSUInteger consumed = [self parseBytes:pendingData_.bytes
+                                    length:length
+                                   isFinal:YES];
+    pendingData_.length = 0;
+    if (error_ == nil
+        && (consumed < length || state_ != kGTLJSONStreamStateDone)) {
+      [self failWithReason:@"Unexpected end of data" atOffset:consumed];
+    }
+    consumedBytes_ += consumed;
+  }
+
+  if (error) *error = error_;
+  if (error_ != nil) return nil;
+
+  return [[rootObject_ retain] autorelease];
+}
+
 @end
+
+#pragma mark -
+
+// Lazily materialized JSON
+//
+// The offsets of an object's members are found only when the object is
+// first accessed, and each value is created only when it is first asked for.
+
+typedef struct {
+  NSUInteger keyStart;    // first byte after the key's opening quote
+  NSUInteger keyLength;
+  NSUInteger valueStart;
+  NSUInteger valueLength;
+  BOOL keyHasEscapes;
+} GTLLazyJSONEntry;
+
+static NSUInteger SkipJSONWhitespace(const unsigned char *bytes,
+                                     NSUInteger idx, NSUInteger length) {
+  while (idx < length && IsJSONWhitespace(bytes[idx])) {
+    idx++;
+  }
+  return idx;
+}
+
+// Returns the index just past the string starting at idx, or NSNotFound if
+// the string is malformed.
+static NSUInteger SkipJSONString(const unsigned char *bytes,
+                                 NSUInteger idx, NSUInteger length,
+                                 BOOL *outHasEscapes) {
+  if (idx >= length || bytes[idx] != '"') return NSNotFound;
+
+  GTLJSONStringScan scan;
+  BeginJSONStringScan(&scan, idx);
+  if (ScanJSONString(bytes, length, &scan) != kGTLJSONTokenValid) {
+    return NSNotFound;
+  }
+  if (outHasEscapes) *outHasEscapes = scan.hasEscapes;
+  return scan.idx + 1;
+}
+
+// Returns the index just past the value starting at idx, or NSNotFound if
+// the value is malformed.
+static NSUInteger SkipJSONValue(const unsigned char *bytes,
+                                NSUInteger idx, NSUInteger length,
+                                NSUInteger depth) {
+  if (idx >= length || depth > kMaxJSONDepth) return NSNotFound;
+
+  unsigned char c = bytes[idx];
+  switch (c) {
+    case '"':
+      return SkipJSONString(bytes, idx, length, NULL);
+
+    case '{':
+    case '[': {
+      BOOL isObject = (c == '{');
+      unsigned char closer = isObject ? '}' : ']';
+      idx = SkipJSONWhitespace(bytes, idx + 1, length);
+      if (idx < length && bytes[idx] == closer) return idx + 1;
+
+      while (idx < length) {
+        if (isObject) {
+          idx = SkipJSONString(bytes, idx, length, NULL);
+          if (idx == NSNotFound) return NSNotFound;
+          idx = SkipJSONWhitespace(bytes, idx, length);
+          if (idx >= length || bytes[idx] != ':') return NSNotFound;
+          idx = SkipJSONWhitespace(bytes, idx + 1, length);
+        }
+        idx = SkipJSONValue(bytes, idx, length, depth + 1);
+        if (idx == NSNotFound) return NSNotFound;
+
+        idx = SkipJSONWhitespace(bytes, idx, length);
+        if (idx >= length) return NSNotFound;
+        if (bytes[idx] == closer) return idx + 1;
+        if (bytes[idx] != ',') return NSNotFound;
+        idx = SkipJSONWhitespace(bytes, idx + 1, length);
+      }
+      return NSNotFound;
+    }
+
+    case 't':
+    case 'f':
+    case 'n': {
+      const char *literal = (c == 't') ? "true" : ((c == 'f') ? "false" : "null");
+      NSUInteger literalLength = strlen(literal);
+      if (idx + literalLength > length
+          || memcmp(bytes + idx, literal, literalLength) != 0) {
+        return NSNotFound;
+      }
+      return idx + literalLength;
+    }
+
+    default: {
+      GTLJSONNumberScan scan;
+      if (!ScanJSONNumber(bytes, idx, length, &scan)) return NSNotFound;
+      return scan.end;
+    }
+  }
+}
+
+// Finds the members of a validated JSON object, returning the number of
+// entries, or NSNotFound.  The caller frees *outEntries.
+static NSUInteger IndexJSONObject(const unsigned char *bytes, NSRange range,
+                                  GTLLazyJSONEntry **outEntries) {
+  *outEntries = NULL;
+
+  NSUInteger length = NSMaxRange(range);
+  NSUInteger idx = range.location;
+  if (idx >= length || bytes[idx] != '{') return NSNotFound;
+
+  NSUInteger count = 0;
+  NSUInteger capacity = 0;
+  GTLLazyJSONEntry *entries = NULL;
+
+  idx = SkipJSONWhitespace(bytes, idx + 1, length);
+  if (idx < length && bytes[idx] == '}') return 0;
+
+  while (idx < length) {
+    GTLLazyJSONEntry entry;
+    BOOL hasEscapes = NO;
+    NSUInteger keyEnd = SkipJSONString(bytes, idx, length, &hasEscapes);
+    if (keyEnd == NSNotFound) break;
+    entry.keyStart = idx + 1;
+    entry.keyLength = keyEnd - idx - 2;
+    entry.keyHasEscapes = hasEscapes;
+
+    idx = SkipJSONWhitespace(bytes, keyEnd, length);
+    if (idx >= length || bytes[idx] != ':') break;
+    idx = SkipJSONWhitespace(bytes, idx + 1, length);
+
+    NSUInteger valueEnd = SkipJSONValue(bytes, idx, length, 0);
+    if (valueEnd == NSNotFound) break;
+    entry.valueStart = idx;
+    entry.valueLength = valueEnd - idx;
+
+    if (count == capacity) {
+      capacity = (capacity == 0) ? 8 : capacity * 2;
+      GTLLazyJSONEntry *grown = realloc(entries, capacity * sizeof(GTLLazyJSONEntry));
+      if (grown == NULL) break;
+      entries = grown;
+    }
+    entries[count++] = entry;
+
+    idx = SkipJSONWhitespace(bytes, valueEnd, length);
+    if (idx >= length) break;
+    if (bytes[idx] == '}') {
+      *outEntries = entries;
+      return count;
+    }
+    if (bytes[idx] != ',') break;
+    idx = SkipJSONWhitespace(bytes, idx + 1, length);
+  }
+
+  free(entries);
+  return NSNotFound;
+}
+
+static id NewLazyJSONValue(NSData *data, NSUInteger start, NSUInteger length);
+
+// The members of a lazy dictionary, found on its first access.
+typedef struct {
+  NSUInteger count;
+  GTLLazyJSONEntry *entries;
+  NSString **keys;                 // parallel to entries
+  id *values;                      // parallel to entries, created on demand
+  CFMutableDictionaryRef indexes;  // key -> index of its last entry, plus one
+} GTLLazyJSONIndex;
+
+static void FreeLazyJSONIndex(GTLLazyJSONIndex *index) {
+  if (index == NULL) return;
+
+  for (NSUInteger idx = 0; idx < index->count; idx++) {
+    [index->keys[idx] release];
+    [index->values[idx] release];
+  }
+  free(index->keys);
+  free(index->values);
+  free(index->entries);
+  if (index->indexes) CFRelease(index->indexes);
+  free(index);
+}
+
+static GTLLazyJSONIndex *NewLazyJSONIndex(NSData *data, NSRange range) {
+  GTLLazyJSONIndex *index = calloc(1, sizeof(GTLLazyJSONIndex));
+  if (index == NULL) return NULL;
+
+  const unsigned char *bytes = data.bytes;
+  NSUInteger count = IndexJSONObject(bytes, range, &index->entries);
+  if (count == NSNotFound) {
+    // The data was validated when parsed, so this should not happen.
+    GTL_DEBUG_ASSERT(0, @"could not index JSON object");
+    count = 0;
+  }
+  index->keys = calloc(count + 1, sizeof(NSString *));
+  index->values = calloc(count + 1, sizeof(id));
+  index->indexes = CFDictionaryCreateMutable(kCFAllocatorDefault, (CFIndex)count,
+                                             &kCFTypeDictionaryKeyCallBacks,
+                                             NULL);
+  if (index->keys == NULL || index->values == NULL || index->indexes == NULL) {
+    FreeLazyJSONIndex(index);
+    return NULL;
+  }
+  index->count = count;
+
+  for (NSUInteger idx = 0; idx < count; idx++) {
+    GTLLazyJSONEntry *entry = &index->entries[idx];
+    NSString *key = NewStringForJSONStringBytes(bytes + entry->keyStart,
+                                                entry->keyLength,
+                                                entry->keyHasEscapes);
+    index->keys[idx] = key;
+    if (key) {
+      // A repeated key finds its last value, as with NSJSONSerialization.
+      CFDictionarySetValue(index->indexes, key, (const void *)(idx + 1));
+    }
+  }
+  return index;
+}
+
+// A mutable dictionary whose keys and values are found in the JSON data
+// when first needed.  Mutating the dictionary first materializes all of its
+// values into an ordinary mutable dictionary.
+//
+// Reading takes no lock.  The index of the keys, and each value, is
+// published with a compare-and-swap, so threads reading at once may each
+// create one, and all but the first are discarded.  As with any mutable
+// dictionary, it must not be mutated while another thread reads it.
+@interface GTLLazyJSONDictionary : NSMutableDictionary {
+ @private
+  NSData *data_;
+  NSRange range_;                       // the object's bytes, with the braces
+  GTLLazyJSONIndex * volatile index_;   // built on first access
+  NSMutableDictionary *dict_;           // replaces the index once mutated
+}
+- (instancetype)initWithData:(NSData *)data range:(NSRange)range;
+@end
+
+@implementation GTLLazyJSONDictionary
+
+- (instancetype)initWithData:(NSData *)data range:(NSRange)range {
+  self = [super init];
+  if (self) {
+    data_ = [data retain];
+    range_ = range;
+  }
+  return self;
+}
+
+- (void)dealloc {
+  FreeLazyJSONIndex(index_);
+  [data_ release];
+  [dict_ release];
+  [super dealloc];
+}
+
+// Archive as an ordinary mutable dictionary.
+- (Class)classForCoder {
+  return [NSMutableDictionary class];
+}
+
+- (GTLLazyJSONIndex *)index {
+  GTLLazyJSONIndex *index = index_;
+  if (index == NULL && data_ != nil) {
+    index = NewLazyJSONIndex(data_, range_);
+    if (!OSAtomicCompareAndSwapPtrBarrier(NULL, index, (void * volatile *)&index_)) {
+      FreeLazyJSONIndex(index);
+      index = index_;
+    }
+  }
+  return index;
+}
+
+- (id)valueAtIndex:(NSUInteger)idx ofIndex:(GTLLazyJSONIndex *)index {
+  id value = index->values[idx];
+  if (value == nil) {
+    GTLLazyJSONEntry *entry = &index->entries[idx];
+    value = NewLazyJSONValue(data_, entry->valueStart, entry->valueLength);
+    if (!OSAtomicCompareAndSwapPtrBarrier(nil, value,
+                                          (void * volatile *)&index->values[idx])) {
+      [value release];
+      value = index->values[idx];
+    }
+  }
+  return value;
+}
+
+- (void)materialize {
+  if (dict_) return;
+
+  GTLLazyJSONIndex *index = [self index];
+  NSUInteger count = index ? index->count : 0;
+  NSMutableDictionary *dict = [[NSMutableDictionary alloc] initWithCapacity:count];
+  for (NSUInteger idx = 0; idx < count; idx++) {
+    NSString *key = index->keys[idx];
+    id value = [self valueAtIndex:idx ofIndex:index];
+    if (key && value) {
+      [dict setObject:value forKey:key];
+    }
+  }
+  dict_ = dict;
+
+  index_ = NULL;
+  FreeLazyJSONIndex(index);
+  [data_ release];
+  data_ = nil;
+}
+
+- (NSUInteger)count {
+  if (dict_) return dict_.count;
+
+  GTLLazyJSONIndex *index = [self index];
+  if (index == NULL) return 0;
+
+  return (NSUInteger)CFDictionaryGetCount(index->indexes);
+}
+
+- (id)objectForKey:(id)key {
+  if (dict_) return [dict_ objectForKey:key];
+
+  GTLLazyJSONIndex *index = [self index];
+  if (index == NULL || key == nil) return nil;
+
+  NSUInteger position = (NSUInteger)CFDictionaryGetValue(index->indexes, key);
+  if (position == 0) return nil;
+
+  return [self valueAtIndex:position - 1 ofIndex:index];
+}
+
+- (NSEnumerator *)keyEnumerator {
+  if (dict_) return [dict_ keyEnumerator];
+
+  GTLLazyJSONIndex *index = [self index];
+  if (index == NULL) return [@[] objectEnumerator];
+
+  return [(NSDictionary *)index->indexes keyEnumerator];
+}
+
+- (void)setObject:(id)anObject forKey:(id<NSCopying>)aKey {
+  [self materialize];
+  [dict_ setObject:anObject forKey:aKey];
+}
+
+- (void)removeObjectForKey:(id)aKey {
+  [self materialize];
+  [dict_ removeObjectForKey:aKey];
+}
+
+@end
+
+static NSMutableArray *NewLazyJSONArray(NSData *data, NSUInteger start,
+                                        NSUInteger length) {
+  const unsigned char *bytes = data.bytes;
+  NSUInteger end = start + length;
+  NSMutableArray *array = [[NSMutableArray alloc] init];
+
+  NSUInteger idx = SkipJSONWhitespace(bytes, start + 1, end);
+  if (idx < end && bytes[idx] == ']') return array;
+
+  while (idx < end) {
+    NSUInteger valueEnd = SkipJSONValue(bytes, idx, end, 0);
+    if (valueEnd == NSNotFound) break;
+
+    id value = NewLazyJSONValue(data, idx, valueEnd - idx);
+    if (value) {
+      [array addObject:value];
+      [value release];
+    }
+
+    idx = SkipJSONWhitespace(bytes, valueEnd, end);
+    if (idx >= end || bytes[idx] != ',') break;
+    idx = SkipJSONWhitespace(bytes, idx + 1, end);
+  }
+  return array;
+}
+
+// Returns a new object for a validated JSON value.  Objects are returned as
+// lazy dictionaries, and arrays have their elements created immediately.
+static id NewLazyJSONValue(NSData *data, NSUInteger start, NSUInteger length) {
+  const unsigned char *bytes = data.bytes;
+  switch (bytes[start]) {
+    case '{':
+      return [[GTLLazyJSONDictionary alloc] initWithData:data
+                                                   range:NSMakeRange(start, length)];
+    case '[':
+      return NewLazyJSONArray(data, start, length);
+    case '"': {
+      BOOL hasEscapes = (memchr(bytes + start + 1, '\\', length - 2) != NULL);
+      return NewStringForJSONStringBytes(bytes + start + 1, length - 2, hasEscapes);
+    }
+    case 't':
+      return [(id)kCFBooleanTrue retain];
+    case 'f':
+      return [(id)kCFBooleanFalse retain];
+    case 'n':
+      return [[NSNull null] retain];
+    default: {
+      GTLJSONNumberScan scan;
+      if (!ScanJSONNumber(bytes, start, start + length, &scan)) return nil;
+      return NewNumberForJSONNumberScan(bytes, &scan);
+    }
+  }
+}
+
+static id NewLazyJSONObjectWithData(NSData *data, NSError **error) {
+  const unsigned char *bytes = data.bytes;
+  NSUInteger length = data.length;
+
+  NSUInteger start = 0;
+  if (length >= 3 && memcmp(bytes, "\xEF\xBB\xBF", 3) == 0) {
+    start = 3;
+  }
+  start = SkipJSONWhitespace(bytes, start, length);
+
+  if (start < length && (bytes[start] == '{' || bytes[start] == '[')) {
+    NSUInteger end = SkipJSONValue(bytes, start, length, 0);
+    if (end != NSNotFound && SkipJSONWhitespace(bytes, end, length) == length) {
+      if (error) *error = nil;
+      return NewLazyJSONValue(data, start, end - start);
+    }
+  }
+
+  // Decode the data to report where it is malformed.
+  return NewJSONObjectWithData(data, YES, nil, error);
+}
+
+#pragma mark -
+
+// Native decoding
+//
+// objectWithData:error: decodes in a single recursive pass over the bytes.
+// The elements of each container are collected on a scratch stack shared by
+// the whole decode, and the container is created from them at its final size.
+
+// When decoding for an operation, the operation is checked for cancellation
+// after the decoder advances by about this many bytes.
+static const NSUInteger kJSONCancellationCheckInterval = 64 * 1024;
+
+// Recently decoded short strings, so repeated keys and values within a
+// response share a single string.
+enum {
+  kDecodedStringCacheSize = 256  // a power of two
+};
+
+typedef struct {
+  uint32_t hash;
+  NSUInteger length;
+  const unsigned char *bytes;  // within the data being decoded
+  NSString *string;
+} GTLDecodedString;
+
+typedef struct {
+  const unsigned char *bytes;
+  NSUInteger length;
+  NSUInteger idx;
+  NSUInteger depth;
+  BOOL mutableContainers;
+  GTLDecodedString decodedStrings[kDecodedStringCacheSize];
+  NSString *failureReason;  // set by the first failure
+  NSUInteger failureOffset;
+
+  NSOperation *operation;  // decoding stops if this is cancelled
+  NSUInteger nextCancellationCheck;
+  BOOL isCancelled;
+
+  // Values, and object keys, not yet added to their containers.  Each
+  // element is retained.
+  id *values;
+  NSUInteger valuesCount;
+  NSUInteger valuesCapacity;
+  id *keys;
+  NSUInteger keysCount;
+  NSUInteger keysCapacity;
+} GTLJSONDecoder;
+
+static id DecodeJSONValue(GTLJSONDecoder *decoder);
+
+static id DecoderFailure(GTLJSONDecoder *decoder, NSString *reason) {
+  if (decoder->failureReason == nil) {
+    decoder->failureReason = reason;
+    decoder->failureOffset = decoder->idx;
+  }
+  return nil;
+}
+
+// Checks the decoder's operation once the decoder has moved far enough past
+// the last check, returning YES if decoding should stop.
+static BOOL IsDecodingCancelled(GTLJSONDecoder *decoder) {
+  if (decoder->idx < decoder->nextCancellationCheck) return NO;
+
+  decoder->nextCancellationCheck = decoder->idx + kJSONCancellationCheckInterval;
+  if (decoder->operation.isCancelled) {
+    decoder->isCancelled = YES;
+    DecoderFailure(decoder, @"Cancelled");
+    return YES;
+  }
+  return NO;
+}
+
+static void SkipDecoderWhitespace(GTLJSONDecoder *decoder) {
+  const unsigned char *bytes = decoder->bytes;
+  NSUInteger length = decoder->length;
+  NSUInteger idx = decoder->idx;
+  while (idx < length && IsJSONWhitespace(bytes[idx])) {
+    idx++;
+  }
+  decoder->idx = idx;
+}
+
+// Takes ownership of the retained value.
+static BOOL PushDecodedValue(id **stack, NSUInteger *count,
+                             NSUInteger *capacity, id value) {
+  if (*count == *capacity) {
+    NSUInteger newCapacity = (*capacity == 0) ? 64 : *capacity * 2;
+    id *grown = realloc(*stack, newCapacity * sizeof(id));
+    if (grown == NULL) {
+      [value release];
+      return NO;
+    }
+    *stack = grown;
+    *capacity = newCapacity;
+  }
+  (*stack)[(*count)++] = value;
+  return YES;
+}
+
+static void PopDecodedValues(id *stack, NSUInteger *count, NSUInteger base) {
+  for (NSUInteger idx = base; idx < *count; idx++) {
+    [stack[idx] release];
+  }
+  *count = base;
+}
+
+static NSString *NewStringForUnescapedBytes(const unsigned char *bytes,
+                                            NSUInteger length,
+                                            BOOL isASCII) {
+  CFStringEncoding encoding = isASCII ? kCFStringEncodingASCII
+                                      : kCFStringEncodingUTF8;
+  return (NSString *)CFStringCreateWithBytes(kCFAllocatorDefault, bytes,
+                                             (CFIndex)length, encoding, false);
+}
+
+// Returns a retained string for the bytes, preferring one already decoded
+// from the data, then an interned string, before creating a new one.
+static NSString *NewDecodedStringForBytes(GTLJSONDecoder *decoder,
+                                          const unsigned char *bytes,
+                                          NSUInteger length,
+                                          BOOL isASCII) {
+  uint32_t hash = HashStringBytes(bytes, length);
+  GTLDecodedString *cached =
+    &decoder->decodedStrings[hash & (kDecodedStringCacheSize - 1)];
+  if (cached->string != nil
+      && cached->hash == hash
+      && cached->length == length
+      && memcmp(cached->bytes, bytes, length) == 0) {
+    return [cached->string retain];
+  }
+
+  NSString *str = NewInternedStringForBytes(bytes, length, hash);
+  if (str == nil) {
+    str = NewStringForUnescapedBytes(bytes, length, isASCII);
+    if (str == nil) return nil;
+  }
+  [cached->string release];
+  cached->string = [str retain];
+  cached->hash = hash;
+  cached->length = length;
+  cached->bytes = bytes;
+  return str;
+}
+
+static NSString *DecodeJSONString(GTLJSONDecoder *decoder) {
+  const unsigned char *bytes = decoder->bytes;
+  NSUInteger start = decoder->idx + 1;
+  GTLJSONStringScan scan;
+  BeginJSONStringScan(&scan, decoder->idx);
+  GTLJSONTokenStatus status = ScanJSONString(bytes, decoder->length, &scan);
+  if (status != kGTLJSONTokenValid) {
+    if (scan.idx >= decoder->length) {
+      return DecoderFailure(decoder, @"Unterminated string");
+    }
+    decoder->idx = scan.idx;
+    return DecoderFailure(decoder, JSONStringFailureReason(bytes, scan.idx));
+  }
+
+  NSString *str;
+  NSUInteger strLength = scan.idx - start;
+  if (scan.hasEscapes) {
+    str = NewStringForJSONStringBytes(bytes + start, strLength, YES);
+  } else if (strLength <= kMaxInternedStringLength) {
+    str = NewDecodedStringForBytes(decoder, bytes + start, strLength,
+                                   scan.isASCII);
+  } else {
+    str = NewStringForUnescapedBytes(bytes + start, strLength, scan.isASCII);
+  }
+  if (str == nil) {
+    return DecoderFailure(decoder, @"Invalid string");
+  }
+  decoder->idx = scan.idx + 1;
+  return str;
+}
+
+static NSNumber *DecodeJSONNumber(GTLJSONDecoder *decoder) {
+  GTLJSONNumberScan scan;
+  if (!ScanJSONNumber(decoder->bytes, decoder->idx, decoder->length, &scan)) {
+    decoder->idx = scan.end;
+    return DecoderFailure(decoder, @"Invalid number");
+  }
+  NSNumber *number = NewNumberForJSONNumberScan(decoder->bytes, &scan);
+  if (number == nil) {
+    return DecoderFailure(decoder, @"Invalid number");
+  }
+  decoder->idx = scan.end;
+  return number;
+}
+
+static id DecodeJSONArray(GTLJSONDecoder *decoder) {
+  NSUInteger base = decoder->valuesCount;
+  decoder->idx++;
+  SkipDecoderWhitespace(decoder);
+  if (decoder->idx < decoder->length && decoder->bytes[decoder->idx] == ']') {
+    decoder->idx++;
+  } else {
+    for (;;) {
+      id value = DecodeJSONValue(decoder);
+      if (value == nil
+          || !PushDecodedValue(&decoder->values, &decoder->valuesCount,
+                               &decoder->valuesCapacity, value)
+          || IsDecodingCancelled(decoder)) {
+        goto fail;
+      }
+      SkipDecoderWhitespace(decoder);
+      if (decoder->idx >= decoder->length) {
+        DecoderFailure(decoder, @"Unterminated array");
+        goto fail;
+      }
+      unsigned char c = decoder->bytes[decoder->idx++];
+      if (c == ']') break;
+      if (c != ',') {
+        decoder->idx--;
+        DecoderFailure(decoder, @"Expected ',' or ']'");
+        goto fail;
+      }
+      SkipDecoderWhitespace(decoder);
+    }
+  }
+
+  NSUInteger count = decoder->valuesCount - base;
+  id *values = decoder->values + base;
+  id array;
+  if (decoder->mutableContainers) {
+    array = [[NSMutableArray alloc] initWithObjects:values count:count];
+  } else {
+    array = [[NSArray alloc] initWithObjects:values count:count];
+  }
+  PopDecodedValues(decoder->values, &decoder->valuesCount, base);
+  return array;
+
+fail:
+  PopDecodedValues(decoder->values, &decoder->valuesCount, base);
+  return nil;
+}
+
+static NSDictionary *NewJSONDictionary(id *values, id *keys, NSUInteger count,
+                                       BOOL mutableContainers) {
+  NSDictionary *dict;
+  if (mutableContainers) {
+    dict = [[NSMutableDictionary alloc] initWithObjects:values
+                                                forKeys:keys
+                                                  count:count];
+  } else {
+    dict = [[NSDictionary alloc] initWithObjects:values
+                                         forKeys:keys
+                                           count:count];
+  }
+  if (dict.count != count) {
+    // A key was repeated; as with NSJSONSerialization, the last value wins.
+    NSMutableDictionary *lastValues =
+      [[NSMutableDictionary alloc] initWithCapacity:count];
+    for (NSUInteger idx = 0; idx < count; idx++) {
+      [lastValues setObject:values[idx] forKey:keys[idx]];
+    }
+    [dict release];
+    if (mutableContainers) {
+      dict = lastValues;
+    } else {
+      dict = [lastValues copy];
+      [lastValues release];
+    }
+  }
+  return dict;
+}
+
+static id DecodeJSONObject(GTLJSONDecoder *decoder) {
+  NSUInteger valuesBase = decoder->valuesCount;
+  NSUInteger keysBase = decoder->keysCount;
+  decoder->idx++;
+  SkipDecoderWhitespace(decoder);
+  if (decoder->idx < decoder->length && decoder->bytes[decoder->idx] == '}') {
+    decoder->idx++;
+  } else {
+    for (;;) {
+      if (decoder->idx >= decoder->length
+          || decoder->bytes[decoder->idx] != '"') {
+        DecoderFailure(decoder, @"Expected a key");
+        goto fail;
+      }
+      NSString *key = DecodeJSONString(decoder);
+      if (key == nil
+          || !PushDecodedValue(&decoder->keys, &decoder->keysCount,
+                               &decoder->keysCapacity, key)) {
+        goto fail;
+      }
+      SkipDecoderWhitespace(decoder);
+      if (decoder->idx >= decoder->length
+          || decoder->bytes[decoder->idx] != ':') {
+        DecoderFailure(decoder, @"Expected ':'");
+        goto fail;
+      }
+      decoder->idx++;
+      SkipDecoderWhitespace(decoder);
+
+      id value = DecodeJSONValue(decoder);
+      if (value == nil
+          || !PushDecodedValue(&decoder->values, &decoder->valuesCount,
+                               &decoder->valuesCapacity, value)
+          || IsDecodingCancelled(decoder)) {
+        goto fail;
+      }
+      SkipDecoderWhitespace(decoder);
+      if (decoder->idx >= decoder->length) {
+        DecoderFailure(decoder, @"Unterminated object");
+        goto fail;
+      }
+      unsigned char c = decoder->bytes[decoder->idx++];
+      if (c == '}') break;
+      if (c != ',') {
+        decoder->idx--;
+        DecoderFailure(decoder, @"Expected ',' or '}'");
+        goto fail;
+      }
+      SkipDecoderWhitespace(decoder);
+    }
+  }
+
+  NSUInteger count = decoder->valuesCount - valuesBase;
+  id *values = decoder->values + valuesBase;
+  id *keys = decoder->keys + keysBase;
+  NSDictionary *dict = NewJSONDictionary(values, keys, count,
+                                         decoder->mutableContainers);
+  PopDecodedValues(decoder->values, &decoder->valuesCount, valuesBase);
+  PopDecodedValues(decoder->keys, &decoder->keysCount, keysBase);
+  return dict;
+
+fail:
+  PopDecodedValues(decoder->values, &decoder->valuesCount, valuesBase);
+  PopDecodedValues(decoder->keys, &decoder->keysCount, keysBase);
+  return nil;
+}
+
+// Returns a new object for the value at the decoder's index, or nil.
+static id DecodeJSONValue(GTLJSONDecoder *decoder) {
+  if (decoder->idx >= decoder->length) {
+    return DecoderFailure(decoder, @"Unexpected end of data");
+  }
+
+  const unsigned char *bytes = decoder->bytes;
+  unsigned char c = bytes[decoder->idx];
+  switch (c) {
+    case '{':
+    case '[': {
+      if (decoder->depth >= kMaxJSONDepth) {
+        return DecoderFailure(decoder, @"Too deeply nested");
+      }
+      decoder->depth++;
+      id container = (c == '{') ? DecodeJSONObject(decoder)
+                                : DecodeJSONArray(decoder);
+      decoder->depth--;
+      return container;
+    }
+
+    case '"':
+      return DecodeJSONString(decoder);
+
+    case 't':
+    case 'f':
+    case 'n': {
+      const char *literal = (c == 't') ? "true" : ((c == 'f') ? "false" : "null");
+      NSUInteger literalLength = strlen(literal);
+      if (decoder->idx + literalLength > decoder->length
+          || memcmp(bytes + decoder->idx, literal, literalLength) != 0) {
+        return DecoderFailure(decoder, @"Invalid literal");
+      }
+      decoder->idx += literalLength;
+      if (c == 'n') return [[NSNull null] retain];
+      return [(c == 't' ? (id)kCFBooleanTrue : (id)kCFBooleanFalse) retain];
+    }
+
+    default:
+      if (c != '-' && !IsDigit(c)) {
+        return DecoderFailure(decoder, @"Invalid value");
+      }
+      return DecodeJSONNumber(decoder);
+  }
+}
+
+static void InitJSONDecoder(GTLJSONDecoder *decoder,
+                            const unsigned char *bytes, NSUInteger length,
+                            BOOL mutableContainers, NSOperation *operation) {
+  memset(decoder, 0, sizeof(*decoder));
+  decoder->bytes = bytes;
+  decoder->length = length;
+  decoder->mutableContainers = mutableContainers;
+  decoder->operation = operation;
+  decoder->nextCancellationCheck = operation ? 0 : NSUIntegerMax;
+}
+
+static NSError *JSONDecodingCancelledError(void) {
+  return [NSError errorWithDomain:NSCocoaErrorDomain
+                             code:NSUserCancelledError
+                         userInfo:nil];
+}
+
+static void FinishJSONDecoder(GTLJSONDecoder *decoder) {
+  GTL_DEBUG_ASSERT(decoder->valuesCount == 0 && decoder->keysCount == 0,
+                   @"unbalanced JSON decoding");
+  free(decoder->values);
+  free(decoder->keys);
+  for (NSUInteger idx = 0; idx < kDecodedStringCacheSize; idx++) {
+    [decoder->decodedStrings[idx].string release];
+  }
+}
+
+static id NewJSONObjectWithData(NSData *data, BOOL mutableContainers,
+                                NSOperation *operation, NSError **error) {
+  GTLJSONDecoder decoder;
+  InitJSONDecoder(&decoder, data.bytes, data.length, mutableContainers,
+                  operation);
+
+  // Skip a byte order mark.
+  if (decoder.length >= 3 && memcmp(decoder.bytes, "\xEF\xBB\xBF", 3) == 0) {
+    decoder.idx = 3;
+  }
+  SkipDecoderWhitespace(&decoder);
+
+  id result = nil;
+  if (decoder.idx >= decoder.length
+      || (decoder.bytes[decoder.idx] != '{'
+          && decoder.bytes[decoder.idx] != '[')) {
+    DecoderFailure(&decoder, @"JSON text did not start with array or object");
+  } else {
+    result = DecodeJSONValue(&decoder);
+    if (result != nil) {
+      SkipDecoderWhitespace(&decoder);
+      if (decoder.idx != decoder.length) {
+        DecoderFailure(&decoder, @"Garbage at end");
+        [result release];
+        result = nil;
+      }
+    }
+  }
+  FinishJSONDecoder(&decoder);
+
+  if (error) {
+    *error = nil;
+    if (decoder.isCancelled) {
+      *error = JSONDecodingCancelledError();
+    } else if (result == nil) {
+      NSString *reason = decoder.failureReason ?: @"Could not decode JSON";
+      NSString *desc = [NSString stringWithFormat:@"%@ around character %lu.",
+                        reason,
+                        (unsigned long)decoder.failureOffset];
+      *error = JSONCorruptError(desc);
+    }
+  }
+  return result;
+}
+
+#pragma mark -
+
+// Concurrent decoding
+//
+// concurrentObjectWithData:error: validates the JSON and finds the members
+// of its large containers with the lazy parser's scanner, then decodes the
+// members on the global queue's threads.  Members are grouped into work items
+// of similar size; a thread which finishes its work items early takes up
+// the remaining ones, so one large member does not hold up the rest.
+
+// Containers shorter than this are decoded whole by a single thread.
+static const NSUInteger kMinConcurrentJSONLength = 64 * 1024;
+
+// The members of a split container are decoded in work items of about this
+// many bytes.
+static const NSUInteger kConcurrentJSONWorkItemLength = 32 * 1024;
+
+static id NewConcurrentJSONValue(GTLJSONDecoder *decoder,
+                                 NSUInteger start, NSUInteger length);
+
+// Returns a new object for the JSON value in the range, or nil if the value
+// is malformed.
+static id NewDecodedJSONValueInRange(GTLJSONDecoder *decoder,
+                                     NSUInteger start, NSUInteger length) {
+  decoder->idx = start;
+  decoder->length = start + length;
+  id value = DecodeJSONValue(decoder);
+  if (value != nil && decoder->idx != start + length) {
+    [value release];
+    value = nil;
+  }
+  return value;
+}
+
+// Decodes the values in the ranges into the values array, returning NO if
+// any is malformed.  The values array is filled with retained objects or nil.
+static BOOL DecodeJSONValuesConcurrently(GTLJSONDecoder *decoder,
+                                         const NSRange *ranges,
+                                         NSUInteger count,
+                                         id *values) {
+  // Group the values into work items.
+  NSUInteger *firstIndexes = malloc((count + 1) * sizeof(NSUInteger));
+  if (firstIndexes == NULL) return NO;
+
+  NSUInteger numberOfWorkItems = 0;
+  NSUInteger workItemLength = 0;
+  for (NSUInteger idx = 0; idx < count; idx++) {
+    if (workItemLength == 0) {
+      firstIndexes[numberOfWorkItems++] = idx;
+    }
+    workItemLength += ranges[idx].length;
+    if (workItemLength >= kConcurrentJSONWorkItemLength) {
+      workItemLength = 0;
+    }
+  }
+  firstIndexes[numberOfWorkItems] = count;
+
+  if (numberOfWorkItems < 2) {
+    for (NSUInteger idx = 0; idx < count; idx++) {
+      values[idx] = NewConcurrentJSONValue(decoder, ranges[idx].location,
+                                           ranges[idx].length);
+    }
+  } else {
+    const unsigned char *bytes = decoder->bytes;
+    BOOL mutableContainers = decoder->mutableContainers;
+    NSOperation *operation = decoder->operation;
+    dispatch_queue_t queue =
+      dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+    dispatch_apply(numberOfWorkItems, queue, ^(size_t workItem) {
+      // Work items not yet started when the operation is cancelled are
+      // skipped, leaving their values nil.
+      if (operation.isCancelled) return;
+
+      @autoreleasepool {
+        GTLJSONDecoder workItemDecoder;
+        InitJSONDecoder(&workItemDecoder, bytes, 0, mutableContainers,
+                        operation);
+        for (NSUInteger idx = firstIndexes[workItem];
+             idx < firstIndexes[workItem + 1];
+             idx++) {
+          values[idx] = NewConcurrentJSONValue(&workItemDecoder,
+                                               ranges[idx].location,
+                                               ranges[idx].length);
+        }
+        FinishJSONDecoder(&workItemDecoder);
+      }
+    });
+  }
+  free(firstIndexes);
+
+  for (NSUInteger idx = 0; idx < count; idx++) {
+    if (values[idx] == nil) return NO;
+  }
+  return YES;
+}
+
+static void ReleaseJSONValues(id *values, NSUInteger count) {
+  if (values == NULL) return;
+
+  for (NSUInteger idx = 0; idx < count; idx++) {
+    [values[idx] release];
+  }
+  free(values);
+}
+
+static id NewConcurrentJSONArray(GTLJSONDecoder *decoder,
+                                 NSUInteger start, NSUInteger length) {
+  const unsigned char *bytes = decoder->bytes;
+  NSUInteger end = start + length;
+
+  NSRange *ranges = NULL;
+  NSUInteger count = 0;
+  NSUInteger capacity = 0;
+
+  NSUInteger idx = SkipJSONWhitespace(bytes, start + 1, end);
+  if (idx < end && bytes[idx] != ']') {
+    while (idx < end) {
+      NSUInteger valueEnd = SkipJSONValue(bytes, idx, end, 0);
+      if (valueEnd == NSNotFound) break;
+
+      if (count == capacity) {
+        capacity = (capacity == 0) ? 64 : capacity * 2;
+        NSRange *grown = realloc(ranges, capacity * sizeof(NSRange));
+        if (grown == NULL) break;
+        ranges = grown;
+      }
+      ranges[count++] = NSMakeRange(idx, valueEnd - idx);
+
+      idx = SkipJSONWhitespace(bytes, valueEnd, end);
+      if (idx >= end || bytes[idx] != ',') break;
+      idx = SkipJSONWhitespace(bytes, idx + 1, end);
+    }
+  }
+
+  id array = nil;
+  id *values = calloc(count + 1, sizeof(id));
+  if (values != NULL
+      && DecodeJSONValuesConcurrently(decoder, ranges, count, values)) {
+    if (decoder->mutableContainers) {
+      array = [[NSMutableArray alloc] initWithObjects:values count:count];
+    } else {
+      array = [[NSArray alloc] initWithObjects:values count:count];
+    }
+  }
+  ReleaseJSONValues(values, count);
+  free(ranges);
+  return array;
+}
+
+static id NewConcurrentJSONObject(GTLJSONDecoder *decoder,
+                                  NSUInteger start, NSUInteger length) {
+  const unsigned char *bytes = decoder->bytes;
+  GTLLazyJSONEntry *entries = NULL;
+  NSUInteger count = IndexJSONObject(bytes, NSMakeRange(start, length),
+                                     &entries);
+  if (count == NSNotFound) return nil;
+
+  id dict = nil;
+  NSRange *ranges = malloc((count + 1) * sizeof(NSRange));
+  id *values = calloc(count + 1, sizeof(id));
+  id *keys = calloc(count + 1, sizeof(id));
+  if (ranges != NULL && values != NULL && keys != NULL) {
+    BOOL hasKeys = YES;
+    for (NSUInteger idx = 0; idx < count; idx++) {
+      GTLLazyJSONEntry *entry = &entries[idx];
+      ranges[idx] = NSMakeRange(entry->valueStart, entry->valueLength);
+      keys[idx] = NewStringForJSONStringBytes(bytes + entry->keyStart,
+                                              entry->keyLength,
+                                              entry->keyHasEscapes);
+      if (keys[idx] == nil) hasKeys = NO;
+    }
+
+    if (hasKeys
+        && DecodeJSONValuesConcurrently(decoder, ranges, count, values)) {
+      dict = NewJSONDictionary(values, keys, count, decoder->mutableContainers);
+    }
+  }
+  ReleaseJSONValues(values, count);
+  ReleaseJSONValues(keys, count);
+  free(ranges);
+  free(entries);
+  return dict;
+}
+
+// Returns a new object for the JSON value in the range, or nil if the value
+// is malformed.
+static id NewConcurrentJSONValue(GTLJSONDecoder *decoder,
+                                 NSUInteger start, NSUInteger length) {
+  if (length >= kMinConcurrentJSONLength) {
+    unsigned char c = decoder->bytes[start];
+    if (c == '{') return NewConcurrentJSONObject(decoder, start, length);
+    if (c == '[') return NewConcurrentJSONArray(decoder, start, length);
+  }
+  return NewDecodedJSONValueInRange(decoder, start, length);
+}
+
+static id NewConcurrentJSONObjectWithData(NSData *data, NSOperation *operation,
+                                          NSError **error) {
+  const unsigned char *bytes = data.bytes;
+  NSUInteger length = data.length;
+
+  NSUInteger start = 0;
+  if (length >= 3 && memcmp(bytes, "\xEF\xBB\xBF", 3) == 0) {
+    start = 3;
+  }
+  start = SkipJSONWhitespace(bytes, start, length);
+
+  id result = nil;
+  if (start < length && (bytes[start] == '{' || bytes[start] == '[')) {
+    NSUInteger end = SkipJSONValue(bytes, start, length, 0);
+    if (end != NSNotFound && SkipJSONWhitespace(bytes, end, length) == length) {
+      GTLJSONDecoder decoder;
+      InitJSONDecoder(&decoder, bytes, length, YES, operation);
+      result = NewConcurrentJSONValue(&decoder, start, end - start);
+      FinishJSONDecoder(&decoder);
+    }
+  }
+
+  if (result == nil) {
+    if (operation.isCancelled) {
+      if (error) *error = JSONDecodingCancelledError();
+      return nil;
+    }
+    // Decode the data on this thread to report where it is malformed.
+    return NewJSONObjectWithData(data, YES, nil, error);
+  }
+  if (error) *error = nil;
+  return result;
+}